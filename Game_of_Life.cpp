@@ -7,7 +7,9 @@
  * @date March, 2020
  */
 
+#include <algorithm>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 // Uses cxxopts from https://github.com/jarro2783/cxxopts under the MIT license
@@ -16,6 +18,12 @@
 #include "grid.h"
 #include "world.h"
 #include "zoo.h"
+#include "hashlife.h"
+#include "unbounded_world.h"
+#include "larger_than_life.h"
+#include "ensemble.h"
+#include "soup.h"
+#include "census.h"
 
 int main(int argc, char *argv[]) {
 
@@ -24,11 +32,27 @@ int main(int argc, char *argv[]) {
 
     // Declare the valid command line arguments and their types and default values.
     options.add_options()
-            ("f,file", "Load an ascii file from the provided path.",  cxxopts::value<std::string>())
-            ("o,output", "Save an ascii file to the provided path.",  cxxopts::value<std::string>())
+            ("f,file", "Load an ascii file from the provided path, or a binary file if it ends in .bgol or an RLE file if it ends in .rle.",  cxxopts::value<std::string>())
+            ("o,output", "Save an ascii file to the provided path, or a binary file with the rule and generation if it ends in .bgol or an RLE file with the rule if it ends in .rle.",  cxxopts::value<std::string>())
             ("s,steps","The number of steps to simulate the world.", cxxopts::value<int>()->default_value("10"))
             ("e,every","Print world to the console every N steps. 0 disables printing.", cxxopts::value<int>()->default_value("0"))
             ("t,toroidal", "Simulate the Game of Life on a torus.", cxxopts::value<bool>()->default_value("false"))
+            ("g,engine", "Step engine to simulate with: reference, halo, table, columns, bytewise, bitwise, tiled or temporal.", cxxopts::value<std::string>()->default_value("reference"))
+            ("r,rule", "Life-like rule to simulate as a B/S rulestring, e.g. B36/S23 for HighLife.", cxxopts::value<std::string>()->default_value("B3/S23"))
+            ("j,threads", "Number of threads to step with. 0 uses every hardware thread.", cxxopts::value<unsigned int>()->default_value("1"))
+            ("l,hashlife", "Advance all steps at once with HashLife on the infinite plane, cropped back to the input's size. "
+                           "With --toroidal the world must be a power of two square.", cxxopts::value<bool>()->default_value("false"))
+            ("u,unbounded", "Simulate on the infinite plane, growing the world to follow its live cells.", cxxopts::value<bool>()->default_value("false"))
+            ("c,cycles", "Watch the last N generations for the world repeating, report when it stabilizes and skip the rest of the steps. "
+                         "0 disables.", cxxopts::value<unsigned int>()->default_value("0"))
+            ("soup", "Instead of simulating one world, run random WxH soups until they settle and print a census of the outcomes, e.g. 16x16. "
+                     "--steps bounds each soup, defaulting to " + std::to_string(SOUP_MAX_GENERATIONS) + ", --cycles defaults to "
+                     + std::to_string(SOUP_CYCLE_WINDOW) + " and --threads to every hardware thread.", cxxopts::value<std::string>())
+            ("density", "Probability of each cell of a soup starting alive.", cxxopts::value<double>()->default_value("0.5"))
+            ("seed", "Seed of the soups, soup i of a seed is always the same.", cxxopts::value<std::uint64_t>()->default_value("1"))
+            ("count", "Number of soups to run.", cxxopts::value<std::uint64_t>()->default_value("1000"))
+            ("census", "Print a census of the objects in the final state, such as blocks, blinkers and gliders.", cxxopts::value<bool>()->default_value("false"))
+            ("ltl", "Simulate a Larger than Life rule in Golly's notation instead, e.g. R5,C0,M1,S34..58,B34..45,NM.", cxxopts::value<std::string>())
             ("h,help", "Print usage.");
 
     // Actually parse the command line arguments
@@ -44,14 +68,119 @@ int main(int argc, char *argv[]) {
     const int  steps    = result["steps"].as<int>();
     const int  every    = result["every"].as<int>();
     const bool toroidal = result["toroidal"].as<bool>();
+    const unsigned int threads = result["threads"].as<unsigned int>();
+    const bool hashlife = result["hashlife"].as<bool>();
+    const bool unbounded = result["unbounded"].as<bool>();
+    const bool ltl = result.count("ltl") > 0;
+    const unsigned int cycles = result["cycles"].as<unsigned int>();
+
+    if (unbounded && (toroidal || hashlife)) {
+        std::cerr << "--unbounded cannot be combined with --toroidal or --hashlife" << std::endl;
+        std::exit(-1);
+    }
+
+    if (result.count("soup") && (hashlife || unbounded || ltl || result.count("file") || result.count("output") || result["census"].as<bool>())) {
+        std::cerr << "--soup cannot be combined with --hashlife, --unbounded, --ltl, --file, --output or --census" << std::endl;
+        std::exit(-1);
+    }
+
+    if (ltl && (hashlife || unbounded || result["census"].as<bool>())) {
+        std::cerr << "--ltl cannot be combined with --hashlife, --unbounded or --census" << std::endl;
+        std::exit(-1);
+    }
+
+    if (cycles > 0 && (hashlife || unbounded || ltl)) {
+        std::cerr << "--cycles cannot be combined with --hashlife, --unbounded or --ltl" << std::endl;
+        std::exit(-1);
+    }
+
+    // Look up the requested step engine and rule
+    StepEngine engine;
+    Rule rule;
+    LargerThanLifeRule ltl_rule;
+    try {
+        engine = parse_step_engine(result["engine"].as<std::string>());
+        rule = Rule::parse(result["rule"].as<std::string>());
+        if (ltl) {
+            ltl_rule = LargerThanLifeRule::parse(result["ltl"].as<std::string>());
+        }
+    }
+    catch (const std::exception &ex) {
+        std::cerr << ex.what() << std::endl;
+        std::exit(-1);
+    }
+
+    // Run a census of random soups in place of a single world
+    if (result.count("soup")) {
+        unsigned int width = 0, height = 0;
+        char separator = 0;
+        std::istringstream size(result["soup"].as<std::string>());
+
+        if (!(size >> width >> separator >> height) || separator != 'x' || !size.eof() || width == 0 || height == 0) {
+            std::cerr << "--soup expects a size such as 16x16, not " << result["soup"].as<std::string>() << std::endl;
+            std::exit(-1);
+        }
+
+        const std::uint64_t count = result["count"].as<std::uint64_t>();
+
+        // Run the soups through one reused ensemble so memory stays bounded however many there are
+        Ensemble soups(width, height, (unsigned int)std::min<std::uint64_t>(std::max<std::uint64_t>(count, 1), SOUP_BATCH));
+        soups.set_rule(rule);
+        soups.set_cycle_window(result.count("cycles") ? cycles : SOUP_CYCLE_WINDOW);
+        soups.set_threads(result.count("threads") ? threads : 0);
+
+        try {
+            SoupCensus census = Soup::run(soups, result["density"].as<double>(), result["seed"].as<std::uint64_t>(), count,
+                                          result.count("steps") ? (unsigned int)std::max(steps, 0) : SOUP_MAX_GENERATIONS, toroidal);
+            std::cout << census;
+        }
+        catch (const std::exception &ex) {
+            std::cerr << ex.what() << std::endl;
+            std::exit(-1);
+        }
+
+        return 0;
+    }
 
     // Start with an empty grid
     Grid grid;
+    std::uint64_t generation = 0;
+
+    // The packed engines step a BitGrid, so a binary file is mapped straight into one rather than unpacked
+    bool const packed = engine == StepEngine::Bitwise || engine == StepEngine::Tiled || engine == StepEngine::Temporal;
+    BitGrid bits;
+    bool mapped = false;
 
-    // Attempt to read in and parse the input file as an ascii .gol file if a path was given
+    // Binary and RLE files are told apart from ascii ones by their extension
+    auto const has_extension = [](std::string const & path, std::string const & extension) {
+        return path.size() >= extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+    };
+
+    // Attempt to read in and parse the input file if a path was given, a binary .bgol or RLE .rle file also giving
+    // the rule to simulate unless one was asked for, and a binary file the generation to count on from
     if (result.count("file")) {
         try {
-            grid = Zoo::load_ascii(result["file"].as<std::string>());
+            std::string const path = result["file"].as<std::string>();
+
+            if (has_extension(path, ".bgol") && packed) {
+                Rule file_rule;
+                bits = Zoo::map_binary(path, file_rule, generation);
+                mapped = true;
+                rule = result.count("rule") ? rule : file_rule;
+            }
+            else if (has_extension(path, ".bgol")) {
+                Rule file_rule;
+                grid = Zoo::load_binary(path, file_rule, generation);
+                rule = result.count("rule") ? rule : file_rule;
+            }
+            else if (has_extension(path, ".rle")) {
+                Rule file_rule;
+                grid = Zoo::load_rle(path, file_rule);
+                rule = result.count("rule") ? rule : file_rule;
+            }
+            else {
+                grid = Zoo::load_ascii(path);
+            }
         }
         catch (const std::exception &ex) {
             std::cerr << ex.what() << std::endl;
@@ -59,34 +188,129 @@ int main(int argc, char *argv[]) {
         }
     }
 
-    // Construct a world from the parsed grid
-    World world(grid);
+    // HashLife and the unbounded world only simulate Conway's Game of Life
+    if ((hashlife || unbounded) && rule != Rule::conway()) {
+        std::cerr << "--hashlife and --unbounded only support the rule B3/S23" << std::endl;
+        std::exit(-1);
+    }
+
+    // Construct a world from the parsed grid, or from the mapped file without copying it
+    World world = mapped ? World(std::move(bits)) : World(grid);
+    world.set_engine(engine);
+    world.set_rule(rule);
+    world.set_threads(threads);
+    world.set_cycle_window(cycles);
+    world.set_fast_forward(true);
+
+    // A packed world prints from its bits, as World::get_state() would unpack it to a byte per cell
+    auto const print_world = [&world, packed]() {
+        if (packed) {
+            std::cout << world.get_packed_state() << std::endl;
+        }
+        else {
+            std::cout << world.get_state() << std::endl;
+        }
+    };
 
     // Print the initial state of the grid
-    std::cout << "Initial state..." << std::endl
-              << "Alive " << world.get_alive_cells() << " | Dead " << world.get_dead_cells()  << std::endl
-              << world.get_state() << std::endl;
+    std::cout << "Initial state..." << (generation ? " (generation " + std::to_string(generation) + ")" : std::string()) << std::endl
+              << "Alive " << world.get_alive_cells() << " | Dead " << world.get_dead_cells()  << std::endl;
+    print_world();
+
+    // Jump straight to the last step with HashLife, which cannot print the steps in between
+    if (hashlife && steps > 0) {
+        try {
+            HashLife life(world.get_state(), toroidal);
+            life.advance((unsigned long long)steps);
+            world = World(life.to_grid());
+        }
+        catch (const std::exception &ex) {
+            std::cerr << ex.what() << std::endl;
+            std::exit(-1);
+        }
+    }
+
+    // An unbounded world is printed cropped to the bounding box of its live cells
+    UnboundedWorld plane = unbounded ? UnboundedWorld(world.get_state()) : UnboundedWorld();
+    plane.set_threads(threads);
+    auto const crop = [&plane]() {
+        std::int64_t x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+        plane.get_bounds(x0, y0, x1, y1);
+        return plane.to_grid(x0, y0, (unsigned int)(x1 - x0), (unsigned int)(y1 - y0));
+    };
+
+    // A Larger than Life world steps on its own grid, which is copied back at the end
+    LargerThanLifeWorld ltl_world = ltl ? LargerThanLifeWorld(world.get_state(), ltl_rule) : LargerThanLifeWorld();
 
     // Perform the requested number of update steps
-    for (int step = 0; step < steps; step++) {
-        world.step(toroidal);
+    for (int step = 0; step < steps && !hashlife; step++) {
+        if (unbounded) {
+            plane.step();
+        }
+        else if (ltl) {
+            ltl_world.step(toroidal);
+        }
+        else {
+            world.step(toroidal);
+
+            // Once the world repeats itself the remaining steps only go round the cycle, so skip them
+            if (world.is_stable()) {
+                std::cout << "Stabilized at generation " << world.get_stable_generation()
+                          << " with period " << world.get_period() << std::endl;
+                world.advance(steps - step - 1, toroidal);
+                break;
+            }
+        }
 
         // Print the state of the grid every N steps
         if ((every > 0) && (step % every == 0)) {
-            std::cout << "Step " << (step + 1) << " of " << steps << std::endl
-                      << world.get_state() << std::endl;
+            std::cout << "Step " << (step + 1) << " of " << steps << std::endl;
+
+            if (unbounded || ltl) {
+                std::cout << (unbounded ? crop() : ltl_world.get_state()) << std::endl;
+            }
+            else {
+                print_world();
+            }
         }
     }
 
+    if (unbounded) {
+        world = World(crop());
+    }
+    else if (ltl) {
+        world = World(ltl_world.get_state());
+    }
+
     // Print the final state of the grid
     std::cout << "Final state..." << std::endl
-              << "Alive " << world.get_alive_cells() << " | Dead " << world.get_dead_cells()  << std::endl
-              << world.get_state() << std::endl;
+              << "Alive " << world.get_alive_cells() << " | Dead " << world.get_dead_cells()  << std::endl;
+    print_world();
+
+    // Name the objects left in the final state, stepping unknown ones under the same rule to classify them
+    if (result["census"].as<bool>()) {
+        ObjectCensus census(rule);
+        census.count(world.get_state());
+        std::cout << census << std::endl;
+    }
 
     // Attempt to save to the output directory if a path was given
     if (result.count("output")) {
         try {
-            Zoo::save_ascii(result["output"].as<std::string>(), world.get_state());
+            std::string const path = result["output"].as<std::string>();
+
+            if (has_extension(path, ".bgol") && packed) {
+                Zoo::save_binary(path, world.get_packed_state(), rule, generation + (std::uint64_t)std::max(steps, 0));
+            }
+            else if (has_extension(path, ".bgol")) {
+                Zoo::save_binary(path, world.get_state(), rule, generation + (std::uint64_t)std::max(steps, 0));
+            }
+            else if (has_extension(path, ".rle")) {
+                Zoo::save_rle(path, world.get_state(), rule);
+            }
+            else {
+                Zoo::save_ascii(path, world.get_state());
+            }
         }
         catch (const std::exception &ex) {
             std::cerr << ex.what() << std::endl;
@@ -0,0 +1,142 @@
+/**
+ * Times World::advance on large random worlds, and counts its branch misses where perf events are available.
+ * Run with -h or --help to print the usage message.
+ * i.e.
+ * ./Game_of_Life_benchmark --size 4096 --steps 4
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Uses cxxopts from https://github.com/jarro2783/cxxopts under the MIT license
+#include "cxxopts/cxxopts.hxx"
+
+#include "grid.h"
+#include "world.h"
+#include "cpu_features.h"
+#include "perf_counter.h"
+
+/**
+ * Fill a square grid with a reproducible random soup of the given density.
+ * If patch is non zero only a centred patch x patch square is filled, the rest of the world starts dead.
+ */
+static Grid random_grid(unsigned int size, unsigned int patch, double density, unsigned int seed)
+{
+    Grid grid(size);
+
+    std::mt19937 rng(seed);
+    std::bernoulli_distribution alive(density);
+
+    unsigned int const edge = (patch == 0 || patch > size) ? size : patch;
+    unsigned int const offset = (size - edge) / 2;
+
+    for(unsigned int y = offset; y < offset + edge; y++)
+    {
+        for(unsigned int x = offset; x < offset + edge; x++)
+        {
+            if(alive(rng))
+            {
+                grid.set(x, y, Cell::ALIVE);
+            }
+        }
+    }
+
+    return grid;
+}
+
+int main(int argc, char *argv[]) {
+
+    cxxopts::Options options("Game_of_Life_benchmark",
+            "Benchmarks World::advance on large randomly seeded worlds.");
+
+    options.add_options()
+            ("z,size", "Edge sizes of the square worlds to time.", cxxopts::value<std::vector<unsigned int> >()->default_value("1024,4096"))
+            ("s,steps", "The number of steps to advance each world.", cxxopts::value<unsigned int>()->default_value("4"))
+            ("d,density", "Probability of a cell starting alive.", cxxopts::value<double>()->default_value("0.3"))
+            ("p,patch", "Only seed a centred square of this edge size, 0 seeds the whole world.", cxxopts::value<unsigned int>()->default_value("0"))
+            ("t,toroidal", "Simulate the Game of Life on a torus.", cxxopts::value<bool>()->default_value("false"))
+            ("g,engine", "Step engines to time.", cxxopts::value<std::vector<std::string> >()->default_value("reference,halo,table,columns,bytewise,bitwise,tiled,temporal"))
+            ("r,rule", "Life-like rule to step as a B/S rulestring.", cxxopts::value<std::string>()->default_value("B3/S23"))
+            ("j,threads", "Thread counts to time each engine with.", cxxopts::value<std::vector<unsigned int> >()->default_value("1"))
+            ("simd", "Widest instruction set the kernels may use: scalar, avx2 or avx512.", cxxopts::value<std::string>()->default_value("avx512"))
+            ("h,help", "Print usage.");
+
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        std::exit(0);
+    }
+
+    const std::vector<unsigned int> sizes = result["size"].as<std::vector<unsigned int> >();
+    const unsigned int steps    = result["steps"].as<unsigned int>();
+    const unsigned int patch    = result["patch"].as<unsigned int>();
+    const double       density  = result["density"].as<double>();
+    const bool         toroidal = result["toroidal"].as<bool>();
+    const std::vector<std::string> engines = result["engine"].as<std::vector<std::string> >();
+    const std::vector<unsigned int> thread_counts = result["threads"].as<std::vector<unsigned int> >();
+
+    const Rule         rule     = Rule::parse(result["rule"].as<std::string>());
+
+    set_simd_level(parse_simd_level(result["simd"].as<std::string>()));
+    std::cout << "SIMD level " << to_string(active_simd_level()) << " | rule " << rule.to_string() << std::endl;
+
+    for (unsigned int size : sizes) {
+        Grid initial = random_grid(size, patch, density, 1234);
+
+        for (const std::string &engine : engines) {
+            for (unsigned int threads : thread_counts) {
+                // Open the counter before the world so the world's threads inherit it
+                PerfCounter misses(PerfEvent::BranchMisses);
+                std::ostringstream report;
+
+                {
+                    World world(initial);
+                    world.set_engine(parse_step_engine(engine));
+                    world.set_rule(rule);
+                    world.set_threads(threads);
+
+                    // Take one untimed step so converting to the engine's layout is not counted
+                    world.step(toroidal);
+
+                    misses.start();
+                    auto start = std::chrono::steady_clock::now();
+                    world.advance(steps, toroidal);
+                    auto end = std::chrono::steady_clock::now();
+                    misses.stop();
+
+                    double seconds = std::chrono::duration<double>(end - start).count();
+                    double cells_per_second = (double(size) * size * steps) / seconds;
+
+                    report << std::setw(10) << engine << " | " << size << "x" << size
+                           << " | threads " << world.get_threads()
+                           << " | steps " << steps
+                           << " | " << (seconds * 1000.0 / steps) << " ms/step"
+                           << " | " << (cells_per_second / 1e6) << " Mcells/s"
+                           << " | alive " << world.get_alive_cells()
+                           << " | active tiles " << world.get_active_tiles() << "/" << world.get_tiles();
+                }
+
+                // The world's threads have exited, so their branch misses are now included
+                if (misses.is_available()) {
+                    report << " | branch misses/Kcell " << (misses.read() * 1000.0 / (double(size) * size * steps));
+                }
+                else {
+                    report << " | branch misses n/a";
+                }
+
+                std::cout << report.str() << std::endl;
+            }
+        }
+    }
+
+    return 0;
+}
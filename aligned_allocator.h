@@ -0,0 +1,94 @@
+/**
+ * Declares a minimal C++11 allocator returning storage aligned to a fixed boundary.
+ *
+ * Used by Grid (and the other cell containers) so that every buffer starts on a cache line,
+ * which in turn lets each row start on a cache line when the row stride is a multiple of the alignment.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+/**
+ * The alignment in bytes used for all cell buffers, the size of a cache line on the machines we run on.
+ */
+#define CACHE_LINE_SIZE 64
+
+/**
+ * Allocator for STL containers that aligns every allocation to Alignment bytes.
+ * Alignment must be a power of two and a multiple of sizeof(void *).
+ */
+template <typename T, std::size_t Alignment = CACHE_LINE_SIZE>
+class AlignedAllocator
+{
+public:
+
+    typedef T value_type;
+    typedef T * pointer;
+    typedef T const * const_pointer;
+    typedef T & reference;
+    typedef T const & const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind { typedef AlignedAllocator<U, Alignment> other; };
+
+    AlignedAllocator() {}
+
+    template <typename U>
+    AlignedAllocator(AlignedAllocator<U, Alignment> const &) {}
+
+    T * allocate(std::size_t n)
+    {
+        if(n == 0)
+        {
+            return nullptr;
+        }
+
+        if(n > std::size_t(-1) / sizeof(T))
+        {
+            throw std::bad_alloc();
+        }
+
+        void * p = nullptr;
+
+#ifdef _WIN32
+        p = _aligned_malloc(n * sizeof(T), Alignment);
+#else
+        if(posix_memalign(&p, Alignment, n * sizeof(T)) != 0)
+        {
+            p = nullptr;
+        }
+#endif
+        if(p == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        return static_cast<T *>(p);
+    }
+
+    void deallocate(T * p, std::size_t)
+    {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        free(p);
+#endif
+    }
+};
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator==(AlignedAllocator<T, Alignment> const &, AlignedAllocator<U, Alignment> const &) { return true; }
+
+template <typename T, typename U, std::size_t Alignment>
+bool operator!=(AlignedAllocator<T, Alignment> const &, AlignedAllocator<U, Alignment> const &) { return false; }
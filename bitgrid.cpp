@@ -0,0 +1,691 @@
+/**
+ * Implements a class representing a 2d grid of cells packed one bit per cell.
+ *      - New cells are initialized to Cell::DEAD.
+ *      - BitGrids can be converted to and from a Grid.
+ *      - BitGrids can be resized while retaining their contents in the remaining area.
+ *      - BitGrids can be rotated, cropped, and merged together.
+ *      - BitGrids can return counts of the alive and dead cells.
+ *      - BitGrids can be serialized directly to an ascii std::ostream in the same format as a Grid.
+ *      - BitGrids can borrow their words instead of owning them, so a grid can be stepped straight out of
+ *        a memory mapped file without its cells ever being copied, see Zoo::map_binary().
+ *
+ *      - Cells are packed 64 to a std::uint64_t word, an eighth of the memory a Grid needs.
+ *          - Each row starts on a new word, cell x of a row is bit (x % 64) of word (x / 64).
+ *          - A 1 bit is Cell::ALIVE, a 0 bit is Cell::DEAD.
+ *          - Bits past the width in the last word of each row are always kept at 0, so whole words
+ *            can be counted, compared and stepped without masking.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#include "bitgrid.h"
+
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+
+/**
+ * Reads the 64 bits starting at bit offset pos of a row that is words long.
+ * Bits past the end of the row read as 0.
+ */
+static inline std::uint64_t read_bits(std::uint64_t const * row, unsigned int words, unsigned int pos)
+{
+    unsigned int const index = pos / BITGRID_WORD_BITS;
+    unsigned int const shift = pos % BITGRID_WORD_BITS;
+
+    std::uint64_t bits = (index < words) ? (row[index] >> shift) : 0;
+
+    if(shift != 0 && index + 1 < words)
+    {
+        bits |= row[index + 1] << (BITGRID_WORD_BITS - shift);
+    }
+
+    return bits;
+}
+
+/**
+ * Writes the low count bits of bits into a row starting at bit offset pos.
+ * If alive_only is true the bits are OR'ed in, so existing 1 bits are never cleared.
+ */
+static inline void write_bits(std::uint64_t * row, unsigned int pos, std::uint64_t bits, unsigned int count, bool alive_only)
+{
+    std::uint64_t const mask = (count >= BITGRID_WORD_BITS) ? ~std::uint64_t(0) : ((std::uint64_t(1) << count) - 1);
+    bits &= mask;
+
+    unsigned int const index = pos / BITGRID_WORD_BITS;
+    unsigned int const shift = pos % BITGRID_WORD_BITS;
+
+    if(!alive_only)
+    {
+        row[index] &= ~(mask << shift);
+    }
+    row[index] |= bits << shift;
+
+    if(shift != 0 && shift + count > BITGRID_WORD_BITS)
+    {
+        if(!alive_only)
+        {
+            row[index + 1] &= ~(mask >> (BITGRID_WORD_BITS - shift));
+        }
+        row[index + 1] |= bits >> (BITGRID_WORD_BITS - shift);
+    }
+}
+
+
+/**
+ * BitGrid::BitGrid()
+ *
+ * Construct an empty bit grid of size 0x0.
+ */
+BitGrid::BitGrid()
+    : BitGrid(0)
+{
+
+}
+
+
+/**
+ * BitGrid::BitGrid(square_size)
+ *
+ * Construct a bit grid with the desired size filled with dead cells.
+ *
+ * @param square_size
+ *      The edge size to use for the width and height of the grid.
+ */
+BitGrid::BitGrid(unsigned int const & square_size)
+    : BitGrid(square_size, square_size)
+{
+
+}
+
+
+/**
+ * BitGrid::BitGrid(width, height)
+ *
+ * Construct a bit grid with the desired size filled with dead cells.
+ *
+ * @example
+ *
+ *      // Make a 32768x32768 grid in 128MB, a Grid of the same size would need 1GB
+ *      BitGrid grid(32768, 32768);
+ *
+ * @param width
+ *      The width of the grid.
+ *
+ * @param height
+ *      The height of the grid.
+ */
+BitGrid::BitGrid(unsigned int const & width, unsigned int const & height)
+    : m_width(width), m_height(height),
+      m_words_per_row((unsigned int)((std::size_t(width) + BITGRID_WORD_BITS - 1) / BITGRID_WORD_BITS)),
+      m_words(std::size_t(m_words_per_row) * height, 0)
+{
+
+}
+
+
+/**
+ * BitGrid::BitGrid(grid)
+ *
+ * Construct a bit grid holding the same cells as a Grid.
+ *
+ * @example
+ *
+ *      // Pack a glider
+ *      BitGrid packed(Zoo::glider());
+ *
+ * @param grid
+ *      The grid to pack.
+ */
+BitGrid::BitGrid(Grid const & grid)
+    : BitGrid(grid.get_width(), grid.get_height())
+{
+    for(unsigned int y = 0; y < m_height; y++)
+    {
+        Cell const * source = grid.row(y);
+        std::uint64_t * target = row(y);
+
+        for(unsigned int w = 0; w < m_words_per_row; w++)
+        {
+            unsigned int const x0 = w * BITGRID_WORD_BITS;
+            unsigned int const count = std::min(m_width - x0, (unsigned int)BITGRID_WORD_BITS);
+
+            std::uint64_t word = 0;
+            for(unsigned int i = 0; i < count; i++)
+            {
+                word |= std::uint64_t(source[x0 + i] == Cell::ALIVE) << i;
+            }
+            target[w] = word;
+        }
+    }
+}
+
+
+/**
+ * BitGrid::BitGrid(width, height, words)
+ *
+ * Construct a bit grid over words it borrows rather than allocates. The grid reads and writes the words in place,
+ * and keeps its share of them alive until it is destroyed or assigned to.
+ *
+ * The bits past the width are never checked, as that would read every row up front. They are ignored when the grid
+ * is counted or compared, and cleared when it is copied, so a set bit there never becomes a cell.
+ *
+ * @example
+ *
+ *      // Step a world straight out of a memory mapped file
+ *      World world(Zoo::map_binary("path/to/file.bgol", rule, generation));
+ *
+ * @param width
+ *      The width of the grid.
+ *
+ * @param height
+ *      The height of the grid.
+ *
+ * @param words
+ *      The grid's words, (width + 63) / 64 to a row for height rows.
+ *      They should be 64 byte aligned for the vectorized kernels to load them at full speed.
+ *
+ * @throws
+ *      std::invalid_argument if words is empty and the grid has cells.
+ */
+BitGrid::BitGrid(unsigned int const & width, unsigned int const & height, std::shared_ptr<std::uint64_t> words)
+    : m_width(width), m_height(height),
+      m_words_per_row((unsigned int)((std::size_t(width) + BITGRID_WORD_BITS - 1) / BITGRID_WORD_BITS)),
+      m_external(std::move(words))
+{
+    if(!m_external && get_word_count() > 0)
+    {
+        throw std::invalid_argument("A bit grid cannot borrow words from a null pointer");
+    }
+}
+
+
+/**
+ * BitGrid::BitGrid(other)
+ *
+ * Copy a bit grid. The copy always owns its words, even when the original borrows them, so writing to
+ * one never changes the other.
+ */
+BitGrid::BitGrid(BitGrid const & other)
+    : m_width(other.m_width), m_height(other.m_height), m_words_per_row(other.m_words_per_row),
+      m_words(other.words(), other.words() + other.get_word_count())
+{
+    //Borrowed words may have bits set past the width, which owned words never do
+    if(other.is_external() && m_words_per_row > 0)
+    {
+        std::uint64_t const mask = last_word_mask();
+
+        for(unsigned int y = 0; y < m_height; y++)
+        {
+            row(y)[m_words_per_row - 1] &= mask;
+        }
+    }
+}
+
+
+/**
+ * BitGrid::operator=(other)
+ *
+ * Copy a bit grid into this one, which then owns its words, see BitGrid(other).
+ */
+BitGrid & BitGrid::operator=(BitGrid const & other)
+{
+    if(this != &other)
+    {
+        BitGrid copy(other);
+        std::swap(*this, copy);
+    }
+
+    return *this;
+}
+
+
+/**
+ * BitGrid::is_external()
+ *
+ * Whether the grid borrows its words rather than owning them, see BitGrid(width, height, words).
+ */
+bool BitGrid::is_external() const { return bool(m_external); }
+
+
+/**
+ * BitGrid::to_grid()
+ *
+ * Unpack the bit grid into a Grid of the same size holding the same cells.
+ *
+ * @return
+ *      A Grid with one Cell per bit.
+ */
+Grid BitGrid::to_grid() const
+{
+    Grid grid(m_width, m_height);
+
+    for(unsigned int y = 0; y < m_height; y++)
+    {
+        std::uint64_t const * source = row(y);
+        Cell * target = grid.row(y);
+
+        for(unsigned int x = 0; x < m_width; x++)
+        {
+            target[x] = ((source[x / BITGRID_WORD_BITS] >> (x % BITGRID_WORD_BITS)) & 1) ? Cell::ALIVE : Cell::DEAD;
+        }
+    }
+
+    return grid;
+}
+
+
+/**
+ * BitGrid::get_index(x, y)
+ *
+ * Private helper function to determine the index of the word holding a cell.
+ */
+std::size_t BitGrid::get_index(unsigned int x, unsigned int y) const
+{
+    return (std::size_t(m_words_per_row) * y) + (x / BITGRID_WORD_BITS);
+}
+
+
+/**
+ * BitGrid::get_word_count()
+ *
+ * Private helper function to determine the number of words holding the whole grid.
+ */
+std::size_t BitGrid::get_word_count() const { return std::size_t(m_words_per_row) * m_height; }
+
+
+/**
+ * BitGrid::words()
+ *
+ * Private helper function to get the first word of the grid, borrowed or owned.
+ */
+std::uint64_t * BitGrid::words() { return m_external ? m_external.get() : m_words.data(); }
+
+std::uint64_t const * BitGrid::words() const { return m_external ? m_external.get() : m_words.data(); }
+
+
+/**
+ * BitGrid::get(x, y)
+ *
+ * Returns the value of the cell at the desired coordinate.
+ *
+ * @param x
+ *      The x coordinate of the cell.
+ *
+ * @param y
+ *      The y coordinate of the cell.
+ *
+ * @return
+ *      Cell::ALIVE if the bit is set, otherwise Cell::DEAD.
+ *
+ * @throws
+ *      coord_exception if x,y is not a valid coordinate within the grid.
+ */
+Cell BitGrid::get(unsigned int x, unsigned int y) const
+{
+    if((x < m_width) && (y < m_height))
+    {
+        return ((words()[get_index(x, y)] >> (x % BITGRID_WORD_BITS)) & 1) ? Cell::ALIVE : Cell::DEAD;
+    }
+    else
+    {
+        throw coord_exception(x, y, m_width, m_height);
+    }
+}
+
+
+/**
+ * BitGrid::set(x, y, value)
+ *
+ * Overwrites the value at the desired coordinate.
+ *
+ * @param x
+ *      The x coordinate of the cell to update.
+ *
+ * @param y
+ *      The y coordinate of the cell to update.
+ *
+ * @param value
+ *      The value to be written to the selected cell.
+ *
+ * @throws
+ *      coord_exception if x,y is not a valid coordinate within the grid.
+ */
+void BitGrid::set(unsigned int x, unsigned int y, Cell value)
+{
+    if((x < m_width) && (y < m_height))
+    {
+        std::uint64_t const bit = std::uint64_t(1) << (x % BITGRID_WORD_BITS);
+        std::uint64_t & word = words()[get_index(x, y)];
+
+        word = (value == Cell::ALIVE) ? (word | bit) : (word & ~bit);
+    }
+    else
+    {
+        throw coord_exception(x, y, m_width, m_height);
+    }
+}
+
+
+unsigned int const & BitGrid::get_width() const { return m_width; }
+
+unsigned int const & BitGrid::get_height() const { return m_height; }
+
+
+/**
+ * BitGrid::get_words_per_row()
+ *
+ * Gets the number of words each row occupies, the width divided by 64 rounded up.
+ */
+unsigned int const & BitGrid::get_words_per_row() const { return m_words_per_row; }
+
+
+/**
+ * BitGrid::row(y)
+ *
+ * Gets a pointer to the first word of a row, for kernels which process a whole word of cells at once.
+ * The coordinate is not checked, y must be less than the height.
+ * Writers must keep the bits past the width in the last word at 0, see BitGrid::last_word_mask().
+ *
+ * @param y
+ *      The y coordinate of the row.
+ *
+ * @return
+ *      A pointer to the word holding cells 0 to 63 of row y.
+ */
+std::uint64_t * BitGrid::row(unsigned int y) { return words() + std::size_t(m_words_per_row) * y; }
+
+std::uint64_t const * BitGrid::row(unsigned int y) const { return words() + std::size_t(m_words_per_row) * y; }
+
+
+/**
+ * BitGrid::last_word_mask()
+ *
+ * Gets the mask of the bits in the last word of each row which hold cells inside the width.
+ */
+std::uint64_t BitGrid::last_word_mask() const
+{
+    unsigned int const used = m_width % BITGRID_WORD_BITS;
+
+    return (used == 0) ? ~std::uint64_t(0) : ((std::uint64_t(1) << used) - 1);
+}
+
+
+unsigned int const BitGrid::get_total_cells() const { return m_width * m_height; }
+
+
+/**
+ * BitGrid::get_alive_cells()
+ *
+ * Counts how many cells in the grid are alive with one popcount per word, ignoring the bits past the width.
+ */
+unsigned int const BitGrid::get_alive_cells() const
+{
+    std::uint64_t const mask = last_word_mask();
+    unsigned int count = 0;
+
+    for(unsigned int y = 0; y < m_height && m_words_per_row > 0; y++)
+    {
+        std::uint64_t const * const data = row(y);
+
+        for(unsigned int w = 0; w + 1 < m_words_per_row; w++)
+        {
+            count += popcount64(data[w]);
+        }
+        count += popcount64(data[m_words_per_row - 1] & mask);
+    }
+
+    return count;
+}
+
+
+unsigned int const BitGrid::get_dead_cells() const { return get_total_cells() - get_alive_cells(); }
+
+
+/**
+ * BitGrid::clear()
+ *
+ * Sets every cell to Cell::DEAD without changing the size.
+ */
+void BitGrid::clear()
+{
+    std::fill(words(), words() + get_word_count(), 0);
+}
+
+
+/**
+ * BitGrid::resize(square_size)
+ *
+ * Resize the grid to a new square size, keeping the content in the retained region.
+ */
+void BitGrid::resize(unsigned int const & square_size)
+{
+    BitGrid::resize(square_size, square_size);
+}
+
+
+/**
+ * BitGrid::resize(new_width, new_height)
+ *
+ * Resize the grid to a new width and height. The content of the grid is preserved
+ * within the kept region and padded with Cell::DEAD if new cells are added.
+ *
+ * @param new_width
+ *      The new width for the grid.
+ *
+ * @param new_height
+ *      The new height for the grid.
+ */
+void BitGrid::resize(unsigned int const & new_width, unsigned int const & new_height)
+{
+    BitGrid resized(new_width, new_height);
+
+    unsigned int const kept_height = std::min(m_height, new_height);
+    unsigned int const kept_words = std::min(m_words_per_row, resized.m_words_per_row);
+
+    for(unsigned int y = 0; y < kept_height; y++)
+    {
+        std::memcpy(resized.row(y), row(y), kept_words * sizeof(std::uint64_t));
+
+        if(kept_words > 0)
+        {
+            resized.row(y)[kept_words - 1] &= (new_width < m_width) ? resized.last_word_mask() : last_word_mask();
+        }
+    }
+
+    std::swap(*this, resized);
+}
+
+
+/**
+ * BitGrid::crop(x0, y0, x1, y1)
+ *
+ * Extract a sub-grid spanning the range [x0, x1) by [y0, y1), a word at a time.
+ *
+ * @return
+ *      A new bit grid of the cropped size containing the values extracted from the original grid.
+ *
+ * @throws
+ *      coord_exception if x1,y1 lie outside the grid, or
+ *      std::out_of_range if the crop window has a negative or zero size.
+ */
+BitGrid BitGrid::crop(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1) const
+{
+    if(x1 > m_width || y1 > m_height)
+    {
+        throw coord_exception(x1, y1, m_width, m_height);
+    }
+    else if(x0 >= x1 || y0 >= y1)
+    {
+        throw std::out_of_range("Illegal Coordinates provided");
+    }
+
+    BitGrid cropped(x1 - x0, y1 - y0);
+
+    for(unsigned int y = y0, i = 0; y < y1; y++, i++)
+    {
+        std::uint64_t * target = cropped.row(i);
+
+        for(unsigned int w = 0; w < cropped.m_words_per_row; w++)
+        {
+            target[w] = read_bits(row(y), m_words_per_row, x0 + w * BITGRID_WORD_BITS);
+        }
+        target[cropped.m_words_per_row - 1] &= cropped.last_word_mask();
+    }
+
+    return cropped;
+}
+
+
+/**
+ * BitGrid::merge(other, x0, y0, alive_only = false)
+ *
+ * Overlay another bit grid on this one with its top left corner at x0,y0, a word at a time.
+ * If alive_only is true then only alive cells are copied, dead cells in other leave the existing value.
+ *
+ * @throws
+ *      coord_exception if x0,y0 lies outside the grid, or
+ *      std::out_of_range if the other grid does not fit within the bounds of the current grid.
+ */
+void BitGrid::merge(BitGrid const & other, unsigned int x0, unsigned int y0, bool alive_only)
+{
+    if(x0 > m_width || y0 > m_height)
+    {
+        throw coord_exception(x0, y0, m_width, m_height);
+    }
+    else if((x0 + other.m_width) > m_width || (y0 + other.m_height) > m_height)
+    {
+        throw std::out_of_range("Grid too large to merge.");
+    }
+
+    for(unsigned int y = 0; y < other.m_height; y++)
+    {
+        std::uint64_t const * source = other.row(y);
+        std::uint64_t * target = row(y0 + y);
+
+        for(unsigned int w = 0; w < other.m_words_per_row; w++)
+        {
+            unsigned int const count = std::min(other.m_width - w * BITGRID_WORD_BITS, (unsigned int)BITGRID_WORD_BITS);
+
+            write_bits(target, x0 + w * BITGRID_WORD_BITS, source[w], count, alive_only);
+        }
+    }
+}
+
+
+/**
+ * BitGrid::rotate(rotation)
+ *
+ * Create a copy of the grid that is rotated clockwise by a multiple of 90 degrees,
+ * matching Grid::rotate(rotation).
+ *
+ * @param rotation
+ *      An positive or negative integer to rotate by in 90 intervals.
+ *
+ * @return
+ *      Returns a copy of the grid that has been rotated.
+ */
+BitGrid BitGrid::rotate(int rotation) const
+{
+    int turns = (4 * abs(rotation) + rotation) % 4;
+
+    if(turns == 0)
+    {
+        return *this;
+    }
+
+    bool const quarter = (turns % 2) == 1;
+    BitGrid rotated(quarter ? m_height : m_width, quarter ? m_width : m_height);
+
+    for(unsigned int y = 0; y < m_height; y++)
+    {
+        std::uint64_t const * source = row(y);
+
+        for(unsigned int x = 0; x < m_width; x++)
+        {
+            if((source[x / BITGRID_WORD_BITS] >> (x % BITGRID_WORD_BITS)) & 1)
+            {
+                //Where cell (x, y) lands after the rotation.
+                unsigned int nx, ny;
+                switch(turns)
+                {
+                    case 1:  nx = m_height - y - 1; ny = x;                  break;
+                    case 2:  nx = m_width - x - 1;  ny = m_height - y - 1;   break;
+                    default: nx = y;                ny = m_width - x - 1;    break;
+                }
+                rotated.row(ny)[nx / BITGRID_WORD_BITS] |= std::uint64_t(1) << (nx % BITGRID_WORD_BITS);
+            }
+        }
+    }
+
+    return rotated;
+}
+
+
+/**
+ * BitGrid::operator==(other)
+ *
+ * Two bit grids are equal if they have the same size and the same cells, whatever the bits past the width hold.
+ */
+bool BitGrid::operator==(BitGrid const & other) const
+{
+    if(m_width != other.m_width || m_height != other.m_height)
+    {
+        return false;
+    }
+
+    std::uint64_t const mask = last_word_mask();
+
+    for(unsigned int y = 0; y < m_height && m_words_per_row > 0; y++)
+    {
+        std::uint64_t const * const a = row(y);
+        std::uint64_t const * const b = other.row(y);
+
+        if(!std::equal(a, a + m_words_per_row - 1, b) || ((a[m_words_per_row - 1] ^ b[m_words_per_row - 1]) & mask) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool BitGrid::operator!=(BitGrid const & other) const { return !(*this == other); }
+
+
+/**
+ * operator<<(output_stream, grid)
+ *
+ * Serializes a bit grid to an ascii output stream in the same bordered format as a Grid.
+ * Rows are unpacked straight into a buffer written out whenever it holds GRID_WRITE_BLOCK_BYTES,
+ * so a grid of any size prints without ever being unpacked whole.
+ */
+std::ostream & operator <<(std::ostream & output, const BitGrid & grid)
+{
+    unsigned int const width = grid.get_width();
+    std::string const border = "+" + std::string(width, '-') + "+\n";
+    std::string buffer = border;
+
+    for(unsigned int y = 0; y < grid.get_height(); y++)
+    {
+        std::uint64_t const * source = grid.row(y);
+
+        buffer += '|';
+        for(unsigned int x = 0; x < width; x++)
+        {
+            buffer += ((source[x / BITGRID_WORD_BITS] >> (x % BITGRID_WORD_BITS)) & 1) ? char(Cell::ALIVE) : char(Cell::DEAD);
+        }
+        buffer += "|\n";
+
+        if(buffer.size() >= GRID_WRITE_BLOCK_BYTES)
+        {
+            output.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+
+    buffer += border;
+    return output.write(buffer.data(), buffer.size());
+}
@@ -0,0 +1,110 @@
+/**
+ * Declares a class representing a 2d grid of cells packed one bit per cell.
+ * Rich documentation for the api and behaviour the BitGrid class can be found in bitgrid.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <iostream>
+
+#include "aligned_allocator.h"
+#include "grid.h"
+
+/**
+ * Number of cells packed into each storage word of a BitGrid.
+ */
+#define BITGRID_WORD_BITS 64
+
+/**
+ * Counts the set bits in a word, the alive cells in 64 packed cells.
+ */
+inline unsigned int popcount64(std::uint64_t word)
+{
+#if defined(__GNUC__)
+    return (unsigned int)__builtin_popcountll(word);
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (unsigned int)((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * Declare the structure of the BitGrid class for representing a 2d grid of cells packed 64 to a word.
+ *
+ * A BitGrid exposes the same get/set/crop/merge/rotate api as Grid, and converts to and from Grid.
+ * Each row occupies a whole number of std::uint64_t words, cell x of a row is bit (x % 64) of word (x / 64).
+ * Bits past the width in the last word of a row are always 0 in words the grid owns. Borrowed words may have them set,
+ * and they are ignored, see BitGrid(width, height, words).
+ *
+ * The words are normally owned by the grid, but can instead be borrowed from elsewhere, such as a memory mapped file,
+ * see BitGrid(width, height, words). Copying a grid that borrows its words copies them into words of its own.
+ */
+class BitGrid {
+
+private:
+
+    unsigned int m_width, m_height;
+    unsigned int m_words_per_row;
+
+    std::vector<std::uint64_t, AlignedAllocator<std::uint64_t> > m_words;
+    std::shared_ptr<std::uint64_t> m_external;     //Borrowed words used instead of m_words when set.
+
+    std::size_t get_index(unsigned int x, unsigned int y) const;
+    std::size_t get_word_count() const;
+
+    std::uint64_t * words();
+    std::uint64_t const * words() const;
+
+public:
+
+    BitGrid();
+    explicit BitGrid(unsigned int const & square_size);
+    BitGrid(unsigned int const & width, unsigned int const & height);
+    explicit BitGrid(Grid const & grid);
+    BitGrid(unsigned int const & width, unsigned int const & height, std::shared_ptr<std::uint64_t> words);
+
+    BitGrid(BitGrid const & other);
+    BitGrid(BitGrid && other) = default;
+    BitGrid & operator=(BitGrid const & other);
+    BitGrid & operator=(BitGrid && other) = default;
+
+    bool is_external() const;
+
+    Grid to_grid() const;
+
+    Cell get(unsigned int x, unsigned int y) const;
+    void set(unsigned int x, unsigned int y, Cell value);
+
+    unsigned int const & get_width() const;
+    unsigned int const & get_height() const;
+    unsigned int const & get_words_per_row() const;
+
+    std::uint64_t * row(unsigned int y);
+    std::uint64_t const * row(unsigned int y) const;
+    std::uint64_t last_word_mask() const;
+
+    unsigned int const get_total_cells() const;
+    unsigned int const get_alive_cells() const;
+    unsigned int const get_dead_cells() const;
+
+    void clear();
+
+    void resize(unsigned int const & square_size);
+    void resize(unsigned int const & new_width, unsigned int const & new_height);
+
+    BitGrid crop(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1) const;
+    void merge(BitGrid const & other, unsigned int x0, unsigned int y0, bool alive_only = false);
+    BitGrid rotate(int rotation) const;
+
+    bool operator==(BitGrid const & other) const;
+    bool operator!=(BitGrid const & other) const;
+
+    friend std::ostream & operator << (std::ostream & output, const BitGrid & grid);
+};
@@ -1,5 +1,5 @@
 set -x
 cd "${0%/*}"
 rm ../bin/Game_of_Life 2> /dev/null
-g++ --std=c++11 -Wall ../Game_of_Life.cpp ../grid.cpp ../world.cpp ../zoo.cpp -o ../bin/Game_of_Life
+g++ --std=c++11 -Wall -pthread ../Game_of_Life.cpp ../grid.cpp ../bitgrid.cpp ../cpu_features.cpp ../step_kernels.cpp ../rule.cpp ../thread_pool.cpp ../world.cpp ../zoo.cpp ../generations.cpp ../hashlife.cpp ../unbounded_world.cpp ../larger_than_life.cpp ../ensemble.cpp ../soup.cpp ../census.cpp -o ../bin/Game_of_Life
 ../bin/Game_of_Life --help
@@ -0,0 +1,5 @@
+set -x
+cd "${0%/*}"
+rm ../bin/Game_of_Life_benchmark 2> /dev/null
+g++ --std=c++11 -Wall -pthread -O2 ../Game_of_Life_benchmark.cpp ../grid.cpp ../bitgrid.cpp ../cpu_features.cpp ../step_kernels.cpp ../rule.cpp ../thread_pool.cpp ../world.cpp ../perf_counter.cpp -o ../bin/Game_of_Life_benchmark
+../bin/Game_of_Life_benchmark
@@ -1,5 +1,5 @@
 set -x
 cd "${0%/*}"
 rm ../bin/Game_of_Life_simple 2> /dev/null
-g++ --std=c++11 -Wall ../Game_of_Life_simple.cpp ../grid.cpp ../world.cpp ../zoo.cpp -o ../bin/Game_of_Life_simple
+g++ --std=c++11 -Wall -pthread ../Game_of_Life_simple.cpp ../grid.cpp ../bitgrid.cpp ../cpu_features.cpp ../step_kernels.cpp ../rule.cpp ../thread_pool.cpp ../world.cpp ../zoo.cpp ../generations.cpp -o ../bin/Game_of_Life_simple
 ../bin/Game_of_Life_simple
@@ -1,5 +1,5 @@
 set -x
 cd "${0%/*}"
 rm ../bin/test_14 2> /dev/null
-g++ --std=c++11 -Wall ../tests/test_14.cpp ../grid.cpp ../zoo.cpp ../bin/catch.o -o ../bin/test_14
+g++ --std=c++11 -Wall ../tests/test_14.cpp ../grid.cpp ../bitgrid.cpp ../cpu_features.cpp ../step_kernels.cpp ../rule.cpp ../zoo.cpp ../generations.cpp ../bin/catch.o -o ../bin/test_14
 ../bin/test_14
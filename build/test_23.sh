@@ -0,0 +1,5 @@
+set -x
+cd "${0%/*}"
+rm ../bin/test_23 2> /dev/null
+g++ --std=c++11 -Wall ../tests/test_23.cpp ../grid.cpp ../bin/catch.o -o ../bin/test_23
+../bin/test_23
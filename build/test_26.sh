@@ -0,0 +1,5 @@
+set -x
+cd "${0%/*}"
+rm ../bin/test_26 2> /dev/null
+g++ --std=c++11 -Wall -pthread ../tests/test_26.cpp ../grid.cpp ../bitgrid.cpp ../cpu_features.cpp ../step_kernels.cpp ../rule.cpp ../thread_pool.cpp ../world.cpp ../bin/catch.o -o ../bin/test_26
+../bin/test_26
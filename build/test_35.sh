@@ -0,0 +1,5 @@
+set -x
+cd "${0%/*}"
+rm ../bin/test_35 2> /dev/null
+g++ --std=c++11 -Wall -pthread ../tests/test_35.cpp ../grid.cpp ../bitgrid.cpp ../cpu_features.cpp ../step_kernels.cpp ../rule.cpp ../thread_pool.cpp ../world.cpp ../larger_than_life.cpp ../bin/catch.o -o ../bin/test_35
+../bin/test_35
@@ -0,0 +1,5 @@
+set -x
+cd "${0%/*}"
+rm ../bin/test_47 2> /dev/null
+g++ --std=c++11 -Wall ../tests/test_47.cpp ../grid.cpp ../bitgrid.cpp ../cpu_features.cpp ../step_kernels.cpp ../rule.cpp ../zoo.cpp ../generations.cpp ../bin/catch.o -o ../bin/test_47
+../bin/test_47
@@ -1,10 +1,15 @@
 set -x
 cd "${0%/*}"
 rm ../bin/test_all_monolithic 2> /dev/null
-g++ --std=c++11 -Wall ../tests/test_1.cpp  ../tests/test_2.cpp  ../tests/test_3.cpp  ../tests/test_4.cpp  \
-                      ../tests/test_5.cpp  ../tests/test_6.cpp  ../tests/test_7.cpp  ../tests/test_8.cpp  \
-                      ../tests/test_9.cpp  ../tests/test_10.cpp ../tests/test_11.cpp ../tests/test_12.cpp \
-                      ../tests/test_13.cpp ../tests/test_14.cpp ../tests/test_15.cpp ../tests/test_16.cpp \
-                      ../tests/test_17.cpp ../tests/test_18.cpp ../tests/test_19.cpp ../tests/test_20.cpp \
-                      ../tests/test_21.cpp ../grid.cpp ../world.cpp ../zoo.cpp ../bin/catch.o -o ../bin/test_all_monolithic
+g++ --std=c++11 -Wall -pthread ../tests/test_1.cpp  ../tests/test_2.cpp  ../tests/test_3.cpp  ../tests/test_4.cpp  \
+                               ../tests/test_5.cpp  ../tests/test_6.cpp  ../tests/test_7.cpp  ../tests/test_8.cpp  \
+                               ../tests/test_9.cpp  ../tests/test_10.cpp ../tests/test_11.cpp ../tests/test_12.cpp \
+                               ../tests/test_13.cpp ../tests/test_14.cpp ../tests/test_15.cpp ../tests/test_16.cpp \
+                               ../tests/test_17.cpp ../tests/test_18.cpp ../tests/test_19.cpp ../tests/test_20.cpp \
+                               ../tests/test_21.cpp ../tests/test_23.cpp ../tests/test_24.cpp ../tests/test_25.cpp \
+                               ../tests/test_26.cpp ../tests/test_27.cpp ../tests/test_28.cpp ../tests/test_29.cpp \
+                               ../tests/test_30.cpp ../tests/test_31.cpp ../tests/test_32.cpp ../tests/test_33.cpp \
+                               ../tests/test_34.cpp ../tests/test_35.cpp ../tests/test_36.cpp ../tests/test_37.cpp \
+                               ../tests/test_38.cpp ../tests/test_39.cpp ../tests/test_40.cpp ../tests/test_41.cpp ../tests/test_42.cpp ../tests/test_43.cpp ../tests/test_44.cpp ../tests/test_45.cpp ../tests/test_46.cpp ../tests/test_47.cpp \
+                               ../grid.cpp ../bitgrid.cpp ../cpu_features.cpp ../step_kernels.cpp ../rule.cpp ../thread_pool.cpp ../world.cpp ../zoo.cpp ../generations.cpp ../hashlife.cpp ../unbounded_world.cpp ../larger_than_life.cpp ../ensemble.cpp ../soup.cpp ../census.cpp ../perf_counter.cpp ../bin/catch.o -o ../bin/test_all_monolithic
 ../bin/test_all_monolithic
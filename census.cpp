@@ -0,0 +1,597 @@
+/**
+ * Implements a class that takes a census of the objects in a grid, such as blocks, blinkers and gliders.
+ *
+ *      - A grid is split into objects with a union-find over its live cells.
+ *          - Only live cells are visited, each row's live cells found with std::find, so sparse grids are quick.
+ *          - Each live cell is joined to the live cells within CENSUS_RADIUS of it in the rows above and to its left,
+ *            found by binary search in those rows' lists of live cells.
+ *          - An object whose phases come apart by more than CENSUS_RADIUS, as some of the pentadecathlon's do,
+ *            is counted as its separate parts in those phases.
+ *
+ *      - Objects are looked up by their canonical form, so an object is recognised in any orientation.
+ *          - The canonical form is the least of the object's eight images under Grid::rotate and Grid::reflect,
+ *            written as its size then its cells row by row.
+ *
+ *      - The table of known objects is seeded with the lifeforms in the Zoo and the commonest still lifes and oscillators.
+ *          - Each is stepped on its own until it repeats, every phase it passes through being added to the table,
+ *            which also tells still lifes, oscillators and spaceships apart by their period and whether they moved.
+ *          - Objects not in the table are stepped the same way the first time they are seen, then added under
+ *            a name describing them, so later copies are found by a single lookup.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#include "census.h"
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+
+#include "bitgrid.h"
+#include "world.h"
+#include "zoo.h"
+
+/**
+ * The commonest still lifes and oscillators from random soups, as rows of cells separated by '/'.
+ */
+static char const * const COMMON_OBJECTS[][2] = {
+    { "block",   "##/##" },
+    { "beehive", " ## /#  #/ ## " },
+    { "loaf",    " ## /#  #/ # #/  # " },
+    { "boat",    "## /# #/ # " },
+    { "ship",    "## /# #/ ##" },
+    { "tub",     " # /# #/ # " },
+    { "pond",    " ## /#  #/#  #/ ## " },
+    { "blinker", "###" },
+    { "toad",    " ###/### " },
+    { "beacon",  "##  /##  /  ##/  ##" }
+};
+
+
+/**
+ * Make a grid from rows of cells separated by '/', '#' alive and anything else dead.
+ */
+static Grid parse_rows(std::string const & rows)
+{
+    std::vector<std::string> lines(1);
+    for(char c : rows)
+    {
+        if(c == '/')
+        {
+            lines.emplace_back();
+        }
+        else
+        {
+            lines.back().push_back(c);
+        }
+    }
+
+    std::size_t width = 0;
+    for(std::string const & line : lines)
+    {
+        width = std::max(width, line.size());
+    }
+
+    Grid grid((unsigned int)width, (unsigned int)lines.size());
+    for(unsigned int y = 0; y < lines.size(); y++)
+    {
+        for(unsigned int x = 0; x < lines[y].size(); x++)
+        {
+            grid.set(x, y, (lines[y][x] == '#') ? Cell::ALIVE : Cell::DEAD);
+        }
+    }
+
+    return grid;
+}
+
+
+/**
+ * Crop a grid to the bounding box of its live cells, giving the box's top left corner.
+ * A grid with no live cells crops to a 0x0 grid.
+ */
+static Grid crop_to_live(Grid const & grid, unsigned int & x0, unsigned int & y0)
+{
+    unsigned int x1 = 0, y1 = 0;
+    x0 = grid.get_width();
+    y0 = grid.get_height();
+
+    for(unsigned int y = 0; y < grid.get_height(); y++)
+    {
+        Cell const * row = grid.row(y);
+        Cell const * end = row + grid.get_width();
+        Cell const * first = std::find(row, end, Cell::ALIVE);
+
+        if(first == end)
+        {
+            continue;
+        }
+
+        Cell const * last = std::find(std::reverse_iterator<Cell const *>(end), std::reverse_iterator<Cell const *>(row), Cell::ALIVE).base() - 1;
+
+        x0 = std::min(x0, (unsigned int)(first - row));
+        x1 = std::max(x1, (unsigned int)(last - row) + 1);
+        y0 = std::min(y0, y);
+        y1 = y + 1;
+    }
+
+    if(x0 >= x1)
+    {
+        x0 = y0 = 0;
+        return Grid(0, 0);
+    }
+
+    return grid.crop(x0, y0, x1, y1);
+}
+
+
+/**
+ * to_string(kind)
+ *
+ * Gets the name of an object kind, as printed in a census.
+ *
+ * @param kind
+ *      The kind of object.
+ *
+ * @return
+ *      "still life", "oscillator", "spaceship" or "other".
+ */
+std::string to_string(ObjectKind kind)
+{
+    switch(kind)
+    {
+        case ObjectKind::StillLife:  return "still life";
+        case ObjectKind::Oscillator: return "oscillator";
+        case ObjectKind::Spaceship:  return "spaceship";
+        default:                     return "other";
+    }
+}
+
+
+/**
+ * ObjectCensus::ObjectCensus(rule)
+ *
+ * Construct an empty census that knows the Zoo lifeforms and the commonest still lifes and oscillators.
+ * Every object is stepped under the census's rule to learn its phases, so the seeds are only what
+ * their names say under Conway's Game of Life, but unknown objects are classified correctly under any rule.
+ *
+ * @example
+ *
+ *      // Count what a soup settled into
+ *      ObjectCensus census;
+ *      census.count(world.get_state());
+ *      std::cout << census << std::endl;
+ *
+ * @param rule
+ *      Optional parameter. The life-like rule objects are stepped with. Defaults to Conway's Game of Life.
+ */
+ObjectCensus::ObjectCensus(Rule const & rule)
+    : m_rule(rule)
+{
+    for(auto const & common : COMMON_OBJECTS)
+    {
+        add_known(common[0], parse_rows(common[1]));
+    }
+
+    add_known("glider", Zoo::glider());
+    add_known("lightweight spaceship", Zoo::light_weight_spaceship());
+    add_known("r-pentomino", Zoo::r_pentomino());
+}
+
+
+/**
+ * ObjectCensus::get_rule()
+ *
+ * Gets the rule objects are stepped with.
+ */
+Rule const & ObjectCensus::get_rule() const { return m_rule; }
+
+
+/**
+ * ObjectCensus::learn(object, name)
+ *
+ * Private helper stepping an object on its own to find its kind and period, adding an entry for it and
+ * indexing every phase it passes through under that entry. An object that does not repeat within
+ * CENSUS_MAX_PERIOD generations only has the phase given indexed, as its descendants may be anything.
+ * Phases already indexed keep their entry.
+ *
+ * @return
+ *      The index of the new entry.
+ */
+std::size_t ObjectCensus::learn(Grid const & object, std::string const & name)
+{
+    //Leave room for a spaceship at c/2, as fast as they come in the Game of Life, to fly for CENSUS_MAX_PERIOD generations.
+    unsigned int const margin = CENSUS_MAX_PERIOD / 2 + CENSUS_RADIUS;
+
+    Grid padded(object.get_width() + 2 * margin, object.get_height() + 2 * margin);
+    padded.merge(object, margin, margin);
+
+    World world(padded);
+    world.set_rule(m_rule);
+    world.set_engine(StepEngine::Bitwise);
+
+    BitGrid const initial(object);
+    std::vector<std::string> phases(1, canonical(object));
+    ObjectKind kind = ObjectKind::Other;
+    unsigned int period = 0;
+
+    for(unsigned int generation = 1; generation <= CENSUS_MAX_PERIOD; generation++)
+    {
+        world.step();
+
+        unsigned int x0 = 0, y0 = 0;
+        Grid phase = crop_to_live(world.get_state(), x0, y0);
+
+        if(phase.get_total_cells() == 0)
+        {
+            break;
+        }
+
+        if(BitGrid(phase) == initial)
+        {
+            period = generation;
+            kind = (x0 != margin || y0 != margin) ? ObjectKind::Spaceship
+                 : (period == 1) ? ObjectKind::StillLife : ObjectKind::Oscillator;
+            break;
+        }
+
+        phases.push_back(canonical(phase));
+    }
+
+    if(period == 0)
+    {
+        phases.resize(1);
+    }
+
+    CensusEntry entry;
+    entry.name = name;
+    entry.kind = kind;
+    entry.period = period;
+    entry.object = object;
+    entry.count = 0;
+
+    if(entry.name.empty())
+    {
+        entry.name = "unnamed " + ((period > 1) ? "p" + std::to_string(period) + " " : std::string())
+                   + to_string(kind) + " (" + std::to_string(object.get_alive_cells()) + " cells)";
+    }
+
+    m_entries.push_back(entry);
+
+    for(std::string const & phase : phases)
+    {
+        m_index.emplace(phase, m_entries.size() - 1);
+    }
+
+    return m_entries.size() - 1;
+}
+
+
+/**
+ * ObjectCensus::add_known(name, lifeform)
+ *
+ * Teach the census an object by name, in every phase it passes through. If the object is already known,
+ * such as one found unnamed by an earlier count, its entry is renamed.
+ *
+ * @example
+ *
+ *      census.add_known("pentadecathlon", Zoo::load_ascii("pentadecathlon.gol"));
+ *
+ * @param name
+ *      The name the object is counted under.
+ *
+ * @param lifeform
+ *      One phase of the object, with any dead border.
+ */
+void ObjectCensus::add_known(std::string const & name, Grid const & lifeform)
+{
+    unsigned int x0 = 0, y0 = 0;
+    Grid const object = crop_to_live(lifeform, x0, y0);
+
+    auto const known = m_index.find(canonical(object));
+    if(known != m_index.end())
+    {
+        m_entries[known->second].name = name;
+        return;
+    }
+
+    learn(object, name);
+}
+
+
+/**
+ * ObjectCensus::count(grid)
+ *
+ * Split a grid into objects and count each one under its entry, learning any object not seen before.
+ * Counts add up over calls, so several grids can be counted into one census.
+ *
+ * @example
+ *
+ *      // Count the objects left in a thousand soups
+ *      for(Grid const & soup : settled_soups)
+ *      {
+ *          census.count(soup);
+ *      }
+ *
+ * @param grid
+ *      The grid to count the objects in.
+ */
+void ObjectCensus::count(Grid const & grid)
+{
+    for(Grid const & object : components(grid))
+    {
+        std::string const key = canonical(object);
+        auto const known = m_index.find(key);
+
+        std::size_t const entry = (known != m_index.end()) ? known->second : learn(object, "");
+        m_entries[entry].count++;
+    }
+}
+
+
+/**
+ * ObjectCensus::clear_counts()
+ *
+ * Set every count back to zero, keeping the objects learned.
+ */
+void ObjectCensus::clear_counts()
+{
+    for(CensusEntry & entry : m_entries)
+    {
+        entry.count = 0;
+    }
+}
+
+
+/**
+ * ObjectCensus::get_entries()
+ *
+ * Gets the entries that have been counted at least once, most common first.
+ */
+std::vector<CensusEntry> ObjectCensus::get_entries() const
+{
+    std::vector<CensusEntry> entries;
+    std::copy_if(m_entries.begin(), m_entries.end(), std::back_inserter(entries),
+                 [](CensusEntry const & entry) { return entry.count > 0; });
+
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](CensusEntry const & a, CensusEntry const & b) { return a.count > b.count; });
+
+    return entries;
+}
+
+
+/**
+ * ObjectCensus::get_count(name)
+ *
+ * Gets how many objects have been counted under a name, in any phase and orientation.
+ *
+ * @example
+ *
+ *      unsigned int blocks = census.get_count("block");
+ *
+ * @param name
+ *      The name of the object.
+ *
+ * @return
+ *      The count, 0 if no object of that name has been counted or the name is not known.
+ */
+std::uint64_t ObjectCensus::get_count(std::string const & name) const
+{
+    std::uint64_t count = 0;
+    for(CensusEntry const & entry : m_entries)
+    {
+        count += (entry.name == name) ? entry.count : 0;
+    }
+
+    return count;
+}
+
+
+/**
+ * ObjectCensus::get_total()
+ *
+ * Gets how many objects have been counted in all.
+ */
+std::uint64_t ObjectCensus::get_total() const
+{
+    return std::accumulate(m_entries.begin(), m_entries.end(), std::uint64_t(0),
+                           [](std::uint64_t total, CensusEntry const & entry) { return total + entry.count; });
+}
+
+
+/**
+ * ObjectCensus::components(grid)
+ *
+ * Split the live cells of a grid into objects, live cells within CENSUS_RADIUS cells of each other in x and y
+ * being part of the same object.
+ *
+ * @example
+ *
+ *      // A block and a glider far apart are two objects
+ *      std::vector<Grid> objects = ObjectCensus::components(world.get_state());
+ *
+ * @param grid
+ *      The grid to split.
+ *
+ * @return
+ *      Each object cropped to its bounding box with only its own cells alive, in the order of their first
+ *      cell row by row.
+ */
+std::vector<Grid> ObjectCensus::components(Grid const & grid)
+{
+    unsigned int const width = grid.get_width();
+    unsigned int const height = grid.get_height();
+
+    //The live cells row by row, and where each row's cells start
+    std::vector<unsigned int> xs, ys;
+    std::vector<std::size_t> row_start(height + 1, 0);
+
+    for(unsigned int y = 0; y < height; y++)
+    {
+        row_start[y] = xs.size();
+
+        Cell const * row = grid.row(y);
+        Cell const * end = row + width;
+
+        for(Cell const * cell = std::find(row, end, Cell::ALIVE); cell != end; cell = std::find(cell + 1, end, Cell::ALIVE))
+        {
+            xs.push_back((unsigned int)(cell - row));
+            ys.push_back(y);
+        }
+    }
+    row_start[height] = xs.size();
+
+    std::vector<std::size_t> parent(xs.size());
+    std::iota(parent.begin(), parent.end(), 0);
+
+    auto const find = [&parent](std::size_t i)
+    {
+        while(parent[i] != i)
+        {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    //Join each cell to the cells near it that come before it, in its own row and the rows above
+    for(std::size_t i = 0; i < xs.size(); i++)
+    {
+        unsigned int const x = xs[i], y = ys[i];
+        unsigned int const left = (x >= CENSUS_RADIUS) ? x - CENSUS_RADIUS : 0;
+
+        for(unsigned int dy = 0; dy <= CENSUS_RADIUS && dy <= y; dy++)
+        {
+            std::size_t const begin = row_start[y - dy];
+            std::size_t const end = (dy == 0) ? i : row_start[y - dy + 1];
+
+            for(std::size_t j = std::lower_bound(xs.begin() + begin, xs.begin() + end, left) - xs.begin();
+                j < end && xs[j] <= x + CENSUS_RADIUS; j++)
+            {
+                parent[find(i)] = find(j);
+            }
+        }
+    }
+
+    //Gather each object's cells and bounding box, numbering objects by their first cell
+    std::vector<std::size_t> object_of(xs.size());
+    std::vector<std::size_t> root_object(xs.size(), std::size_t(-1));
+    std::vector<unsigned int> x0s, y0s, x1s, y1s;
+
+    for(std::size_t i = 0; i < xs.size(); i++)
+    {
+        std::size_t const root = find(i);
+
+        if(root_object[root] == std::size_t(-1))
+        {
+            root_object[root] = x0s.size();
+            x0s.push_back(xs[i]);
+            y0s.push_back(ys[i]);
+            x1s.push_back(xs[i] + 1);
+            y1s.push_back(ys[i] + 1);
+        }
+
+        std::size_t const object = root_object[root];
+        object_of[i] = object;
+        x0s[object] = std::min(x0s[object], xs[i]);
+        x1s[object] = std::max(x1s[object], xs[i] + 1);
+        y1s[object] = ys[i] + 1;
+    }
+
+    std::vector<Grid> objects;
+    objects.reserve(x0s.size());
+    for(std::size_t object = 0; object < x0s.size(); object++)
+    {
+        objects.emplace_back(x1s[object] - x0s[object], y1s[object] - y0s[object]);
+    }
+
+    for(std::size_t i = 0; i < xs.size(); i++)
+    {
+        std::size_t const object = object_of[i];
+        objects[object](xs[i] - x0s[object], ys[i] - y0s[object]) = Cell::ALIVE;
+    }
+
+    return objects;
+}
+
+
+/**
+ * ObjectCensus::canonical(object)
+ *
+ * Gets the canonical form of an object, the same for all eight of its rotations and reflections.
+ *
+ * @example
+ *
+ *      // A glider and its mirror image are the same object
+ *      ObjectCensus::canonical(Zoo::glider()) == ObjectCensus::canonical(Zoo::glider().reflect());
+ *
+ * @param object
+ *      The object, cropped to its bounding box.
+ *
+ * @return
+ *      The least of the eight images' sizes and cells, as a string.
+ */
+std::string ObjectCensus::canonical(Grid const & object)
+{
+    Grid const reflected = object.reflect();
+    std::string best;
+
+    for(int rotation = 0; rotation < 4; rotation++)
+    {
+        for(Grid const * image : { &object, &reflected })
+        {
+            Grid const turned = image->rotate(rotation);
+            std::string key = std::to_string(turned.get_width()) + "x" + std::to_string(turned.get_height()) + ":";
+
+            for(unsigned int y = 0; y < turned.get_height(); y++)
+            {
+                key.append(reinterpret_cast<char const *>(turned.row(y)), turned.get_width());
+            }
+
+            if(best.empty() || key < best)
+            {
+                best.swap(key);
+            }
+        }
+    }
+
+    return best;
+}
+
+
+/**
+ * operator<<(os, census)
+ *
+ * Write the objects counted, most common first, one to a line with their kind and period.
+ *
+ * @example
+ *
+ *      std::cout << census << std::endl;
+ *
+ * @param os
+ *      The stream to write to.
+ *
+ * @param census
+ *      The census to write.
+ *
+ * @return
+ *      The stream, for chaining.
+ */
+std::ostream & operator<<(std::ostream & os, ObjectCensus const & census)
+{
+    os << "Objects " << census.get_total() << std::endl;
+
+    for(CensusEntry const & entry : census.get_entries())
+    {
+        os << entry.count << " | " << entry.name << " | " << to_string(entry.kind);
+
+        if(entry.period > 1)
+        {
+            os << " p" << entry.period;
+        }
+
+        os << std::endl;
+    }
+
+    return os;
+}
@@ -0,0 +1,93 @@
+/**
+ * Declares a class that takes a census of the objects in a grid, such as blocks, blinkers and gliders.
+ * Rich documentation for the api and behaviour of the ObjectCensus class can be found in census.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "grid.h"
+#include "rule.h"
+
+/**
+ * Live cells up to this many cells apart in x and y are part of the same object. Cells two apart share a neighbour,
+ * so they can affect each other's next generation, while cells further apart evolve independently.
+ */
+#define CENSUS_RADIUS 2
+
+/**
+ * The longest period an object is stepped for to find whether it repeats.
+ */
+#define CENSUS_MAX_PERIOD 64
+
+/**
+ * What an object does when stepped on its own.
+ *      - StillLife never changes.
+ *      - Oscillator returns to the same cells in the same place after its period.
+ *      - Spaceship returns to the same cells moved along after its period.
+ *      - Other does not repeat within CENSUS_MAX_PERIOD generations, because it grows, dies or is still settling.
+ */
+enum class ObjectKind {
+    StillLife,
+    Oscillator,
+    Spaceship,
+    Other
+};
+
+std::string to_string(ObjectKind kind);
+
+/**
+ * One kind of object and how many times it has been counted.
+ */
+struct CensusEntry {
+    std::string name;
+    ObjectKind kind;
+    unsigned int period;        //0 for ObjectKind::Other.
+    Grid object;                //The phase first seen, cropped to its bounding box.
+    std::uint64_t count;
+};
+
+/**
+ * Declare the structure of the ObjectCensus class.
+ *
+ * Objects are recognised in any phase and any of the eight orientations: each phase of a known object is stored
+ * in a hash table under its canonical form, the least of its eight rotations and reflections.
+ */
+class ObjectCensus {
+
+private:
+
+    Rule m_rule;
+
+    std::unordered_map<std::string, std::size_t> m_index;   //Canonical form of each phase seen to its entry.
+    std::vector<CensusEntry> m_entries;
+
+    std::size_t learn(Grid const & object, std::string const & name);
+
+public:
+
+    explicit ObjectCensus(Rule const & rule = Rule::conway());
+
+    Rule const & get_rule() const;
+
+    void add_known(std::string const & name, Grid const & lifeform);
+
+    void count(Grid const & grid);
+    void clear_counts();
+
+    std::vector<CensusEntry> get_entries() const;
+    std::uint64_t get_count(std::string const & name) const;
+    std::uint64_t get_total() const;
+
+    static std::vector<Grid> components(Grid const & grid);
+    static std::string canonical(Grid const & object);
+};
+
+std::ostream & operator<<(std::ostream & os, ObjectCensus const & census);
@@ -0,0 +1,145 @@
+/**
+ * Implements runtime detection of the SIMD instruction sets the step kernels can use.
+ *      - The CPU is queried once, the first time a level is asked for.
+ *      - The active level defaults to the widest detected level, and can be lowered with
+ *        set_simd_level(level) to compare kernels on the same machine.
+ *      - Non x86 builds always run the scalar kernels.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#include "cpu_features.h"
+
+#include <stdexcept>
+
+#if defined(_MSC_VER) && SIMD_X86
+#include <intrin.h>
+#endif
+
+/**
+ * Queries the CPU (and on MSVC the OS's saved register state) for the widest usable level.
+ */
+static SimdLevel query_simd_level()
+{
+#if SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+
+    if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    {
+        return SimdLevel::AVX512;
+    }
+    else if(__builtin_cpu_supports("avx2"))
+    {
+        return SimdLevel::AVX2;
+    }
+#elif SIMD_X86
+    int info[4];
+    __cpuid(info, 1);
+
+    bool const osxsave = (info[2] & (1 << 27)) != 0;
+    if(!osxsave)
+    {
+        return SimdLevel::Scalar;
+    }
+
+    unsigned long long const xcr0 = _xgetbv(0);
+    __cpuidex(info, 7, 0);
+
+    bool const ymm = (xcr0 & 0x6) == 0x6;
+    bool const zmm = (xcr0 & 0xE6) == 0xE6;
+
+    if(zmm && (info[1] & (1 << 16)) && (info[1] & (1 << 30)))
+    {
+        return SimdLevel::AVX512;
+    }
+    else if(ymm && (info[1] & (1 << 5)))
+    {
+        return SimdLevel::AVX2;
+    }
+#endif
+    return SimdLevel::Scalar;
+}
+
+/**
+ * detected_simd_level()
+ *
+ * The widest instruction set this CPU supports.
+ */
+SimdLevel detected_simd_level()
+{
+    static SimdLevel const detected = query_simd_level();
+    return detected;
+}
+
+static SimdLevel & active_level()
+{
+    static SimdLevel active = detected_simd_level();
+    return active;
+}
+
+/**
+ * active_simd_level()
+ *
+ * The instruction set the step kernels currently dispatch to.
+ */
+SimdLevel active_simd_level()
+{
+    return active_level();
+}
+
+/**
+ * set_simd_level(level)
+ *
+ * Choose the instruction set the step kernels dispatch to.
+ * Levels wider than the CPU supports are clamped to the detected level.
+ *
+ * @param level
+ *      The widest level the kernels may use.
+ */
+void set_simd_level(SimdLevel level)
+{
+    active_level() = ((int)level > (int)detected_simd_level()) ? detected_simd_level() : level;
+}
+
+/**
+ * parse_simd_level(name)
+ *
+ * Look up a level by the name used on the command line, one of "scalar", "avx2" or "avx512".
+ *
+ * @throws
+ *      std::invalid_argument if the name is not a known level.
+ */
+SimdLevel parse_simd_level(std::string const & name)
+{
+    if(name == "scalar")
+    {
+        return SimdLevel::Scalar;
+    }
+    else if(name == "avx2")
+    {
+        return SimdLevel::AVX2;
+    }
+    else if(name == "avx512")
+    {
+        return SimdLevel::AVX512;
+    }
+    else
+    {
+        throw std::invalid_argument("Unknown SIMD level: " + name);
+    }
+}
+
+/**
+ * to_string(level)
+ *
+ * The command line name of a level, the inverse of parse_simd_level(name).
+ */
+std::string to_string(SimdLevel level)
+{
+    switch(level)
+    {
+        case SimdLevel::AVX512: return "avx512";
+        case SimdLevel::AVX2:   return "avx2";
+        default:                return "scalar";
+    }
+}
@@ -0,0 +1,45 @@
+/**
+ * Declares runtime detection of the SIMD instruction sets the step kernels can use.
+ * Rich documentation can be found in cpu_features.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <string>
+
+/**
+ * The instruction sets the step kernels are written for, from narrowest to widest.
+ *      - Scalar is portable C++ and always available.
+ *      - AVX2 processes 256 bits at a time.
+ *      - AVX512 processes 512 bits at a time and needs both AVX-512F and AVX-512BW.
+ */
+enum class SimdLevel {
+    Scalar,
+    AVX2,
+    AVX512
+};
+
+SimdLevel detected_simd_level();
+SimdLevel active_simd_level();
+void set_simd_level(SimdLevel level);
+
+SimdLevel parse_simd_level(std::string const & name);
+std::string to_string(SimdLevel level);
+
+/**
+ * Kernels using intrinsics are compiled for their instruction set function by function,
+ * so the rest of the program still runs on CPUs without it.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define SIMD_X86 1
+    #define TARGET_AVX2 __attribute__((target("avx2")))
+    #define TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+    #define SIMD_X86 1
+    #define TARGET_AVX2
+    #define TARGET_AVX512
+#else
+    #define SIMD_X86 0
+#endif
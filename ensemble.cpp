@@ -0,0 +1,711 @@
+/**
+ * Implements a class stepping many small worlds of the same size together, such as a batch of random soups.
+ *
+ *      - Worlds are bit sliced, ENSEMBLE_LANES to a group.
+ *          - Each cell of a group is one 64 bit word whose bit k is that cell of world k of the group.
+ *          - The neighbours of a cell are then the words either side of it and in the rows above and below,
+ *            and one generation of all 64 worlds is the packed kernels' full adders run on those words,
+ *            vectorized across the cells of a row with the widest SIMD the CPU has, see step_sliced in step_kernels.cpp.
+ *          - A group of 16x16 worlds is 324 words with its halo, so a group and its recent generations stay in L1 cache.
+ *          - There are no per world objects or allocations, an Ensemble of a million worlds is a few large arrays.
+ *
+ *      - Groups are independent, so they are spread over threads by a persistent ThreadPool.
+ *          - Each task advances one group by every step asked for, rather than every group stepping in lock step.
+ *
+ *      - Worlds that settle into a still life or oscillator are found by comparing states, not hashes.
+ *          - Each group keeps its last window + 1 generations in a ring of frames, the step writing over the oldest.
+ *          - After a step the new frame is XORed with each of the last window frames and the differences ORed over
+ *            every cell, leaving a word whose clear bits are the worlds equal to that earlier generation.
+ *          - Each world records the first generation and period of the first repeat found, see Ensemble::get_period(world).
+ *
+ *      - Populations are counted bit sliced too, each cell word added into a ripple carry counter per bit of the count.
+ *
+ *      - The worlds follow the same life-like rule and topology, and match World::step bit for bit.
+ *          - On a torus 1 cell wide or high the halo holds copies of each cell, which World never counts as its own
+ *            neighbours. They add the same count to every live cell, so the rule's survival counts are raised to match.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#include "ensemble.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "step_kernels.h"
+
+/**
+ * The index of the lowest set bit of a non zero word.
+ */
+static inline unsigned int lowest_bit(std::uint64_t word)
+{
+#if defined(__GNUC__)
+    return (unsigned int)__builtin_ctzll(word);
+#else
+    return popcount64((word & (~word + 1)) - 1);
+#endif
+}
+
+
+/**
+ * Ensemble::Ensemble()
+ *
+ * Construct an ensemble of no worlds.
+ */
+Ensemble::Ensemble()
+    : Ensemble(0, 0, 0)
+{
+
+}
+
+
+/**
+ * Ensemble::Ensemble(width, height, count)
+ *
+ * Construct an ensemble of count dead worlds of width x height cells, stepping Conway's Game of Life
+ * with a cycle window of 8 generations.
+ *
+ * @example
+ *
+ *      // Run 1000 random 16x16 soups until they settle
+ *      Ensemble soups(16, 16, 1000);
+ *      for(unsigned int i = 0; i < 1000; i++)
+ *      {
+ *          soups.set_world(i, random_soup(i));
+ *      }
+ *      soups.advance_until_stable(10000);
+ *
+ * @param width
+ *      The width of every world.
+ *
+ * @param height
+ *      The height of every world.
+ *
+ * @param count
+ *      The number of worlds.
+ */
+Ensemble::Ensemble(unsigned int width, unsigned int height, unsigned int count)
+    : m_width(width), m_height(height), m_count(count), m_cycle_window(0)
+{
+    set_cycle_window(8);
+}
+
+
+/**
+ * Ensemble::get_width()
+ *
+ * Gets the width of every world.
+ */
+unsigned int Ensemble::get_width() const { return m_width; }
+
+
+/**
+ * Ensemble::get_height()
+ *
+ * Gets the height of every world.
+ */
+unsigned int Ensemble::get_height() const { return m_height; }
+
+
+/**
+ * Ensemble::get_count()
+ *
+ * Gets the number of worlds.
+ */
+unsigned int Ensemble::get_count() const { return m_count; }
+
+
+/**
+ * Ensemble::get_groups()
+ *
+ * Private helper getting the number of groups of ENSEMBLE_LANES worlds, the last one possibly part full.
+ */
+unsigned int Ensemble::get_groups() const { return (m_count + ENSEMBLE_LANES - 1) / ENSEMBLE_LANES; }
+
+
+/**
+ * Ensemble::get_frame_words()
+ *
+ * Private helper getting the words in one generation of a group, its cells and a one cell halo.
+ */
+std::size_t Ensemble::get_frame_words() const { return std::size_t(m_width + 2) * (m_height + 2); }
+
+
+/**
+ * Ensemble::get_frames()
+ *
+ * Private helper getting the number of generations each group keeps, the current one and the last m_cycle_window,
+ * and never less than two as a step reads one and writes another.
+ */
+std::size_t Ensemble::get_frames() const { return std::max(m_cycle_window, 1u) + 1; }
+
+
+/**
+ * Ensemble::get_lanes(group)
+ *
+ * Private helper getting a word with a bit set for each world of a group that is in the ensemble.
+ */
+std::uint64_t Ensemble::get_lanes(unsigned int group) const
+{
+    unsigned int const worlds = std::min(m_count - group * ENSEMBLE_LANES, (unsigned int)ENSEMBLE_LANES);
+    return (worlds == ENSEMBLE_LANES) ? ~std::uint64_t(0) : (std::uint64_t(1) << worlds) - 1;
+}
+
+
+/**
+ * Ensemble::frame(group, generation)
+ *
+ * Private helper getting the frame a group's generation is held in. Generations more than the cycle window
+ * before the group's current generation have been written over.
+ */
+std::uint64_t * Ensemble::frame(unsigned int group, std::uint64_t generation)
+{
+    std::size_t const frames = get_frames();
+    return &m_frames[(group * frames + generation % frames) * get_frame_words()];
+}
+
+std::uint64_t const * Ensemble::frame(unsigned int group, std::uint64_t generation) const
+{
+    std::size_t const frames = get_frames();
+    return &m_frames[(group * frames + generation % frames) * get_frame_words()];
+}
+
+
+/**
+ * Ensemble::set_world(world, grid)
+ *
+ * Set the cells of one world. The other worlds of its group forget any cycle they were found in,
+ * so set every world before stepping.
+ *
+ * @param world
+ *      The index of the world.
+ *
+ * @param grid
+ *      The cells, the same size as the ensemble's worlds.
+ *
+ * @throws
+ *      std::out_of_range if world is not less than the number of worlds.
+ *      std::invalid_argument if the grid is not the size of the ensemble's worlds.
+ */
+void Ensemble::set_world(unsigned int world, Grid const & grid)
+{
+    if(world >= m_count)
+    {
+        throw std::out_of_range("World " + std::to_string(world) + " is not in an ensemble of " + std::to_string(m_count));
+    }
+
+    if(grid.get_width() != m_width || grid.get_height() != m_height)
+    {
+        throw std::invalid_argument("Ensemble worlds are " + std::to_string(m_width) + "x" + std::to_string(m_height)
+                                    + ", not " + std::to_string(grid.get_width()) + "x" + std::to_string(grid.get_height()));
+    }
+
+    unsigned int const group = world / ENSEMBLE_LANES;
+    std::uint64_t const bit = std::uint64_t(1) << (world % ENSEMBLE_LANES);
+    std::uint64_t * cells = frame(group, m_generations[group]);
+
+    for(unsigned int y = 0; y < m_height; y++)
+    {
+        Cell const * source = grid.row(y);
+        std::uint64_t * target = cells + (y + 1) * (m_width + 2) + 1;
+
+        //Cell::ALIVE is '#' (0x23) and Cell::DEAD is ' ' (0x20), so the low bit is the state.
+        for(unsigned int x = 0; x < m_width; x++)
+        {
+            target[x] = (target[x] & ~bit) | (std::uint64_t(std::uint8_t(source[x]) & 1) << (world % ENSEMBLE_LANES));
+        }
+    }
+
+    forget_cycles(group);
+}
+
+
+/**
+ * Ensemble::set_worlds(generate)
+ *
+ * Set every world to the grid a function gives for its index and start the ensemble again from generation 0,
+ * so an ensemble can be reused for batch after batch. Groups are filled in parallel on the ensemble's threads,
+ * each world of a group on the same thread, so generate must be safe to call from several threads at once.
+ *
+ * @example
+ *
+ *      // Fill the ensemble with soups drawn from a counter based generator
+ *      soups.set_worlds([](unsigned int world) { return Soup::generate(16, 16, 0.5, 1, world); });
+ *
+ * @param generate
+ *      A function from the index of a world to its cells, the same size as the ensemble's worlds.
+ *
+ * @throws
+ *      std::invalid_argument if a grid given is not the size of the ensemble's worlds.
+ */
+void Ensemble::set_worlds(std::function<Grid(unsigned int)> const & generate)
+{
+    auto const set_group = [&](unsigned int group)
+    {
+        unsigned int const end = std::min(m_count, (group + 1) * ENSEMBLE_LANES);
+
+        m_generations[group] = 0;
+        std::fill(frame(group, 0), frame(group, 0) + get_frame_words(), 0);
+
+        for(unsigned int world = group * ENSEMBLE_LANES; world < end; world++)
+        {
+            set_world(world, generate(world));
+        }
+    };
+
+    if(m_pool)
+    {
+        m_pool->parallel_for(get_groups(), set_group);
+    }
+    else
+    {
+        for(unsigned int group = 0; group < get_groups(); group++)
+        {
+            set_group(group);
+        }
+    }
+}
+
+
+/**
+ * Ensemble::get_world(world)
+ *
+ * Gets a copy of the current cells of one world.
+ *
+ * @throws
+ *      std::out_of_range if world is not less than the number of worlds.
+ */
+Grid Ensemble::get_world(unsigned int world) const
+{
+    if(world >= m_count)
+    {
+        throw std::out_of_range("World " + std::to_string(world) + " is not in an ensemble of " + std::to_string(m_count));
+    }
+
+    unsigned int const group = world / ENSEMBLE_LANES;
+    std::uint64_t const * cells = frame(group, m_generations[group]);
+    Grid grid(m_width, m_height);
+
+    for(unsigned int y = 0; y < m_height; y++)
+    {
+        std::uint64_t const * source = cells + (y + 1) * (m_width + 2) + 1;
+        Cell * target = grid.row(y);
+
+        for(unsigned int x = 0; x < m_width; x++)
+        {
+            target[x] = ((source[x] >> (world % ENSEMBLE_LANES)) & 1) ? Cell::ALIVE : Cell::DEAD;
+        }
+    }
+
+    return grid;
+}
+
+
+/**
+ * Ensemble::set_rule(rule)
+ *
+ * Choose the life-like rule every world steps with. Worlds forget any cycle they were found in under the old rule.
+ */
+void Ensemble::set_rule(Rule const & rule)
+{
+    if(rule != m_rule)
+    {
+        m_rule = rule;
+
+        for(unsigned int group = 0; group < get_groups(); group++)
+        {
+            forget_cycles(group);
+        }
+    }
+}
+
+
+/**
+ * Ensemble::get_rule()
+ *
+ * Gets the rule every world steps with.
+ */
+Rule const & Ensemble::get_rule() const { return m_rule; }
+
+
+/**
+ * Ensemble::set_threads(threads)
+ *
+ * Choose how many threads groups are stepped on, as World::set_threads(threads).
+ *
+ * @param threads
+ *      The number of threads to step with including the calling thread, or 0 for one per hardware thread.
+ */
+void Ensemble::set_threads(unsigned int threads)
+{
+    if(threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    if(threads == get_threads())
+    {
+        return;
+    }
+
+    m_pool = (threads > 1) ? std::make_shared<ThreadPool>(threads) : nullptr;
+}
+
+
+/**
+ * Ensemble::get_threads()
+ *
+ * Gets the number of threads groups are stepped on.
+ */
+unsigned int Ensemble::get_threads() const
+{
+    return m_pool ? m_pool->get_threads() : 1;
+}
+
+
+/**
+ * Ensemble::set_cycle_window(window)
+ *
+ * Choose the longest period looked for. Each group keeps window + 1 generations, so memory grows with the window.
+ * The current generation of every world is kept and every world forgets any cycle it was found in.
+ *
+ * @param window
+ *      The longest period to detect, 0 to not detect cycles.
+ */
+void Ensemble::set_cycle_window(unsigned int window)
+{
+    unsigned int const groups = get_groups();
+    std::size_t const words = get_frame_words();
+    std::size_t const count = std::max(window, 1u) + 1;
+
+    std::vector<std::uint64_t, AlignedAllocator<std::uint64_t> > frames(groups * count * words, 0);
+
+    for(unsigned int group = 0; group < groups && !m_frames.empty(); group++)
+    {
+        std::uint64_t const * source = frame(group, m_generations[group]);
+        std::copy(source, source + words, &frames[(group * count + m_generations[group] % count) * words]);
+    }
+
+    m_frames.swap(frames);
+    m_cycle_window = window;
+
+    if(m_generations.size() != groups)
+    {
+        m_generations.assign(groups, 0);
+        m_compared_since.assign(groups, 0);
+        m_stable.assign(groups, 0);
+        m_stable_generations.assign(m_count, 0);
+        m_periods.assign(m_count, 0);
+    }
+
+    for(unsigned int group = 0; group < groups; group++)
+    {
+        forget_cycles(group);
+    }
+}
+
+
+/**
+ * Ensemble::get_cycle_window()
+ *
+ * Gets the longest period looked for.
+ */
+unsigned int Ensemble::get_cycle_window() const { return m_cycle_window; }
+
+
+/**
+ * Ensemble::get_generation(world)
+ *
+ * Gets the number of generations a world has been stepped. Every world of a group is stepped together,
+ * but Ensemble::advance_until_stable(max_steps, toroidal) stops each group on its own.
+ */
+std::uint64_t Ensemble::get_generation(unsigned int world) const { return m_generations.at(world / ENSEMBLE_LANES); }
+
+
+/**
+ * Ensemble::get_population(world)
+ *
+ * Gets the number of alive cells in a world.
+ */
+unsigned int Ensemble::get_population(unsigned int world) const
+{
+    return get_world(world).get_alive_cells();
+}
+
+
+/**
+ * Ensemble::get_populations()
+ *
+ * Gets the number of alive cells in every world, indexed by world. Each group's cells are added bit sliced,
+ * bit i of counter word j holding bit j of the count of world i so far, so counting a cell costs a word add
+ * for all 64 worlds at once.
+ */
+std::vector<unsigned int> Ensemble::get_populations() const
+{
+    std::vector<unsigned int> populations(m_count, 0);
+
+    for(unsigned int group = 0; group < get_groups(); group++)
+    {
+        std::uint64_t const * cells = frame(group, m_generations[group]);
+        std::uint64_t counters[32] = { 0 };
+
+        for(unsigned int y = 0; y < m_height; y++)
+        {
+            std::uint64_t const * row = cells + (y + 1) * (m_width + 2) + 1;
+
+            for(unsigned int x = 0; x < m_width; x++)
+            {
+                //Ripple the cell's bit up the counters, stopping as soon as nothing carries.
+                std::uint64_t carry = row[x];
+                for(unsigned int j = 0; carry != 0; j++)
+                {
+                    std::uint64_t const next = counters[j] & carry;
+                    counters[j] ^= carry;
+                    carry = next;
+                }
+            }
+        }
+
+        unsigned int const worlds = std::min(m_count - group * ENSEMBLE_LANES, (unsigned int)ENSEMBLE_LANES);
+        for(unsigned int lane = 0; lane < worlds; lane++)
+        {
+            unsigned int population = 0;
+            for(unsigned int j = 0; j < 32; j++)
+            {
+                population |= unsigned((counters[j] >> lane) & 1) << j;
+            }
+            populations[group * ENSEMBLE_LANES + lane] = population;
+        }
+    }
+
+    return populations;
+}
+
+
+/**
+ * Ensemble::is_stable(world)
+ *
+ * Gets whether a world has been seen repeating an earlier generation.
+ */
+bool Ensemble::is_stable(unsigned int world) const { return m_periods.at(world) != 0; }
+
+
+/**
+ * Ensemble::get_stable_generation(world)
+ *
+ * Gets the first generation of the cycle a world settled into, 0 if it is not known to be stable.
+ */
+std::uint64_t Ensemble::get_stable_generation(unsigned int world) const { return m_stable_generations.at(world); }
+
+
+/**
+ * Ensemble::get_period(world)
+ *
+ * Gets the period of the cycle a world settled into, 1 for still lifes and dead worlds, 0 if it is not known to be stable.
+ */
+unsigned int Ensemble::get_period(unsigned int world) const { return m_periods.at(world); }
+
+
+/**
+ * Ensemble::get_stable_count()
+ *
+ * Gets the number of worlds known to be stable.
+ */
+unsigned int Ensemble::get_stable_count() const
+{
+    unsigned int count = 0;
+    for(unsigned int group = 0; group < get_groups(); group++)
+    {
+        count += popcount64(m_stable[group]);
+    }
+    return count;
+}
+
+
+/**
+ * Ensemble::forget_cycles(group)
+ *
+ * Private helper dropping the cycles found in a group and the generations before its current one,
+ * for when its cells or rule change other than by stepping.
+ */
+void Ensemble::forget_cycles(unsigned int group)
+{
+    m_compared_since[group] = m_generations[group];
+    m_stable[group] = 0;
+
+    unsigned int const end = std::min(m_count, (group + 1) * ENSEMBLE_LANES);
+    for(unsigned int world = group * ENSEMBLE_LANES; world < end; world++)
+    {
+        m_stable_generations[world] = 0;
+        m_periods[world] = 0;
+    }
+}
+
+
+/**
+ * Ensemble::step_group(group, toroidal)
+ *
+ * Private helper stepping every world of one group by one generation, then comparing the new generation
+ * with the group's last m_cycle_window generations. Only touches the group's own frames and worlds,
+ * so different groups can be stepped at the same time.
+ */
+void Ensemble::step_group(unsigned int group, bool toroidal)
+{
+    std::uint64_t const generation = m_generations[group];
+    std::uint64_t * curr = frame(group, generation);
+    std::uint64_t * next = frame(group, generation + 1);
+
+    std::size_t const stride = m_width + 2;
+
+    //Fill the halo, wrapped or dead. Rows first, then columns, so the corners wrap both ways.
+    for(unsigned int x = 1; x <= m_width; x++)
+    {
+        curr[x] = toroidal ? curr[m_height * stride + x] : 0;
+        curr[(m_height + 1) * stride + x] = toroidal ? curr[stride + x] : 0;
+    }
+
+    for(unsigned int y = 0; y < m_height + 2; y++)
+    {
+        curr[y * stride] = toroidal ? curr[y * stride + m_width] : 0;
+        curr[y * stride + m_width + 1] = toroidal ? curr[y * stride + 1] : 0;
+    }
+
+    //The copies of a cell in its own halo, west and east on a torus 1 cell wide, north and south on one 1 cell
+    //high, and all eight when both. World skips them, see World::count_neighbours, so they are skipped here by
+    //raising the survival counts by that many, as only a live cell's copies are alive.
+    unsigned int const copies = !toroidal ? 0 : (m_width == 1 && m_height == 1) ? 8 : (m_width == 1 || m_height == 1) ? 2 : 0;
+    std::uint32_t const counts = (1u << RULE_SURVIVAL_SHIFT) - 1;
+    std::uint32_t const mask = m_rule.get_mask();
+    Rule const rule = (copies == 0) ? m_rule
+                    : Rule((mask & counts) | ((((mask >> RULE_SURVIVAL_SHIFT) << copies) & counts) << RULE_SURVIVAL_SHIFT));
+
+    step_sliced(curr, next, m_width, m_height, rule);
+    m_generations[group] = generation + 1;
+
+    //Each earlier generation still held that the new one is compared against, nearest first.
+    std::uint64_t const lanes = get_lanes(group);
+    std::uint64_t const known = std::min<std::uint64_t>(m_cycle_window, generation + 1 - m_compared_since[group]);
+
+    for(unsigned int period = 1; period <= known && (m_stable[group] & lanes) != lanes; period++)
+    {
+        std::uint64_t const * past = frame(group, generation + 1 - period);
+        std::uint64_t differ = 0;
+
+        for(unsigned int y = 1; y <= m_height; y++)
+        {
+            for(std::size_t i = y * stride + 1; i <= y * stride + m_width; i++)
+            {
+                differ |= next[i] ^ past[i];
+            }
+        }
+
+        std::uint64_t found = ~differ & lanes & ~m_stable[group];
+        m_stable[group] |= found;
+
+        while(found != 0)
+        {
+            unsigned int const world = group * ENSEMBLE_LANES + lowest_bit(found);
+            m_stable_generations[world] = generation + 1 - period;
+            m_periods[world] = period;
+            found &= found - 1;
+        }
+    }
+}
+
+
+/**
+ * Ensemble::step(toroidal)
+ *
+ * Step every world by one generation.
+ *
+ * @param toroidal
+ *      Optional parameter. If true every world wraps its left edge to its right and its top to its bottom. Defaults to false.
+ */
+void Ensemble::step(bool toroidal)
+{
+    advance(1, toroidal);
+}
+
+
+/**
+ * Ensemble::advance(steps, toroidal)
+ *
+ * Step every world by a number of generations. Each group is advanced by every step in one task,
+ * so its frames stay in cache and threads only meet once at the end.
+ *
+ * @param steps
+ *      The number of generations to step.
+ *
+ * @param toroidal
+ *      Optional parameter. If true every world wraps its left edge to its right and its top to its bottom. Defaults to false.
+ */
+void Ensemble::advance(unsigned int steps, bool toroidal)
+{
+    auto const advance_group = [&](unsigned int group)
+    {
+        for(unsigned int i = 0; i < steps; i++)
+        {
+            step_group(group, toroidal);
+        }
+    };
+
+    if(m_pool)
+    {
+        m_pool->parallel_for(get_groups(), advance_group);
+    }
+    else
+    {
+        for(unsigned int group = 0; group < get_groups(); group++)
+        {
+            advance_group(group);
+        }
+    }
+}
+
+
+/**
+ * Ensemble::advance_until_stable(max_steps, toroidal)
+ *
+ * Step each group until every one of its worlds is stable or it has taken max_steps steps, whichever is first.
+ * Groups stop at different generations, see Ensemble::get_generation(world). With a cycle window of 0 nothing
+ * is ever found stable and every group takes max_steps steps.
+ *
+ * @example
+ *
+ *      // Count how many soups die out within 5000 generations
+ *      soups.advance_until_stable(5000);
+ *      std::vector<unsigned int> populations = soups.get_populations();
+ *      std::size_t dead = std::count(populations.begin(), populations.end(), 0u);
+ *
+ * @param max_steps
+ *      The most generations to step each group.
+ *
+ * @param toroidal
+ *      Optional parameter. If true every world wraps its left edge to its right and its top to its bottom. Defaults to false.
+ */
+void Ensemble::advance_until_stable(unsigned int max_steps, bool toroidal)
+{
+    auto const advance_group = [&](unsigned int group)
+    {
+        std::uint64_t const lanes = get_lanes(group);
+
+        for(unsigned int i = 0; i < max_steps && (m_stable[group] & lanes) != lanes; i++)
+        {
+            step_group(group, toroidal);
+        }
+    };
+
+    if(m_pool)
+    {
+        m_pool->parallel_for(get_groups(), advance_group);
+    }
+    else
+    {
+        for(unsigned int group = 0; group < get_groups(); group++)
+        {
+            advance_group(group);
+        }
+    }
+}
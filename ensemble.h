@@ -0,0 +1,97 @@
+/**
+ * Declares a class stepping many small worlds of the same size together, packed bit sliced 64 worlds to a word.
+ * Rich documentation for the api and behaviour of the Ensemble class can be found in ensemble.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "aligned_allocator.h"
+#include "grid.h"
+#include "rule.h"
+#include "thread_pool.h"
+
+/**
+ * The number of worlds an Ensemble steps in each word, one per bit.
+ */
+#define ENSEMBLE_LANES 64
+
+/**
+ * Declare the structure of the Ensemble class.
+ *
+ * Worlds are stored in groups of ENSEMBLE_LANES. Each cell of a group is one word whose bit k is that cell of
+ * world k, so a step of the group is the same bitwise full adders as a packed step, run on whole words for 64 worlds.
+ * A group keeps its last few generations so worlds that repeat themselves can be found without hashing.
+ */
+class Ensemble {
+
+private:
+
+    unsigned int m_width, m_height, m_count;
+    Rule m_rule;
+    unsigned int m_cycle_window;                //Periods looked for, each group keeps m_cycle_window + 1 generations.
+
+    std::shared_ptr<ThreadPool> m_pool;         //Null when stepping on the calling thread only.
+
+    //Per group, get_frames() frames of (width + 2) x (height + 2) words, generation g in frame g % get_frames().
+    std::vector<std::uint64_t, AlignedAllocator<std::uint64_t> > m_frames;
+
+    std::vector<std::uint64_t> m_generations;       //Per group, generations stepped.
+    std::vector<std::uint64_t> m_compared_since;    //Per group, the first generation in its frames that can be compared.
+    std::vector<std::uint64_t> m_stable;            //Per group, a bit for each world found cycling.
+
+    std::vector<std::uint64_t> m_stable_generations;    //Per world, the first generation of its cycle.
+    std::vector<unsigned int> m_periods;                //Per world, the period of its cycle, 0 until found.
+
+    unsigned int get_groups() const;
+    std::size_t get_frame_words() const;
+    std::size_t get_frames() const;
+    std::uint64_t get_lanes(unsigned int group) const;
+
+    std::uint64_t * frame(unsigned int group, std::uint64_t generation);
+    std::uint64_t const * frame(unsigned int group, std::uint64_t generation) const;
+
+    void forget_cycles(unsigned int group);
+    void step_group(unsigned int group, bool toroidal);
+
+public:
+
+    Ensemble();
+    Ensemble(unsigned int width, unsigned int height, unsigned int count);
+
+    unsigned int get_width() const;
+    unsigned int get_height() const;
+    unsigned int get_count() const;
+
+    void set_world(unsigned int world, Grid const & grid);
+    void set_worlds(std::function<Grid(unsigned int)> const & generate);
+    Grid get_world(unsigned int world) const;
+
+    void set_rule(Rule const & rule);
+    Rule const & get_rule() const;
+
+    void set_threads(unsigned int threads);
+    unsigned int get_threads() const;
+
+    void set_cycle_window(unsigned int window);
+    unsigned int get_cycle_window() const;
+
+    std::uint64_t get_generation(unsigned int world) const;
+    unsigned int get_population(unsigned int world) const;
+    std::vector<unsigned int> get_populations() const;
+
+    bool is_stable(unsigned int world) const;
+    std::uint64_t get_stable_generation(unsigned int world) const;
+    unsigned int get_period(unsigned int world) const;
+    unsigned int get_stable_count() const;
+
+    void step(bool toroidal = false);
+    void advance(unsigned int steps, bool toroidal = false);
+    void advance_until_stable(unsigned int max_steps, bool toroidal = false);
+};
@@ -0,0 +1,760 @@
+/**
+ * Implements a world for Generations rules, such as Brian's Brain and Star Wars.
+ *
+ *      - A Generations rule is a life-like rule whose cells do not die at once but fade through dying states.
+ *          - https://conwaylife.com/wiki/Generations
+ *          - State 0 is dead and state 1 is alive. Only alive cells count as neighbours.
+ *          - A dead cell with a birth count of alive neighbours becomes alive, otherwise it stays dead.
+ *          - An alive cell with a survival count stays alive, otherwise it starts dying in state 2.
+ *          - A dying cell moves to the next state every generation, whatever its neighbours, and is dead
+ *            again after state (states - 1).
+ *          - Rules are written B2/S/C3 (Brian's Brain), or in the older S/B/C form 345/2/4 (Star Wars).
+ *          - Two states is an ordinary life-like rule, so B3/S23/C2 is Conway's Game of Life.
+ *
+ *      - Cells are stored in bit planes, one BitGrid per bit of the state, 64 cells per word.
+ *          - A world with 3 or 4 states needs 2 bits per cell, up to 16 states need 4.
+ *
+ *      - A step is bitwise on whole words throughout.
+ *          - The alive cells are extracted into one plane and stepped with the life-like rule by step_bits,
+ *            the same vectorized kernels World uses, see step_kernels.cpp.
+ *          - Every cell's state is then incremented at once by a ripple carry across the planes, wrapping to 0 at
+ *            the number of states, and the cells that are born, stay dead or stay alive are patched in with masks.
+ *          - Both passes have AVX2 kernels, picked at runtime from active_simd_level(), and run in bands of
+ *            GENERATIONS_BAND_ROWS rows so each band of the planes is still in cache when it is written back.
+ *
+ *      - Worlds can be loaded from and saved to ascii and binary files, see Zoo::load_generations_ascii(path).
+ *          - Dead cells are written ' ', alive cells '#', and dying states as their hex digit, 2 to f.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#include "generations.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "cpu_features.h"
+#include "step_kernels.h"
+
+#if SIMD_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * generations_state_char(state)
+ *
+ * The character a state is written as in ascii files and when printed, ' ' for dead,
+ * '#' for alive and a hex digit for the dying states.
+ */
+char generations_state_char(unsigned int state)
+{
+    if(state == 0)
+    {
+        return char(Cell::DEAD);
+    }
+    else if(state == 1)
+    {
+        return char(Cell::ALIVE);
+    }
+    return "0123456789abcdef"[state & 0xF];
+}
+
+
+/**
+ * generations_char_state(c)
+ *
+ * The state a character stands for, the inverse of generations_state_char(state), or -1 if it is not a state character.
+ */
+int generations_char_state(char c)
+{
+    if(c == char(Cell::DEAD))
+    {
+        return 0;
+    }
+    else if(c == char(Cell::ALIVE))
+    {
+        return 1;
+    }
+    else if(c >= '2' && c <= '9')
+    {
+        return c - '0';
+    }
+    else if(c >= 'a' && c <= 'f')
+    {
+        return 10 + (c - 'a');
+    }
+    return -1;
+}
+
+
+/**
+ * GenerationsRule::GenerationsRule()
+ *
+ * Construct Brian's Brain, B2/S/C3.
+ */
+GenerationsRule::GenerationsRule()
+    : m_rule(rule_mask("B2/S")), m_states(3)
+{
+
+}
+
+
+/**
+ * GenerationsRule::GenerationsRule(rule, states)
+ *
+ * Construct a Generations rule from a life-like rule and a number of states.
+ *
+ * @param rule
+ *      The birth and survival counts.
+ *
+ * @param states
+ *      The number of states including dead and alive, 2 to GENERATIONS_MAX_STATES.
+ *
+ * @throws
+ *      std::invalid_argument if the number of states is out of range.
+ */
+GenerationsRule::GenerationsRule(Rule const & rule, unsigned int states)
+    : m_rule(rule), m_states(states)
+{
+    if(states < 2 || states > GENERATIONS_MAX_STATES)
+    {
+        throw std::invalid_argument("Generations rules must have 2 to " + std::to_string(GENERATIONS_MAX_STATES) + " states");
+    }
+}
+
+
+/**
+ * GenerationsRule::parse(rulestring)
+ *
+ * Read a Generations rule from a rulestring.
+ *
+ * @example
+ *
+ *      GenerationsRule brain = GenerationsRule::parse("B2/S/C3");
+ *      GenerationsRule star_wars = GenerationsRule::parse("345/2/4");
+ *
+ * @param rulestring
+ *      A life-like rulestring as accepted by Rule::parse followed by /C<states>, or S/B/C with bare numbers.
+ *
+ * @return
+ *      The rule.
+ *
+ * @throws
+ *      std::invalid_argument if the rulestring is malformed.
+ */
+GenerationsRule GenerationsRule::parse(std::string const & rulestring)
+{
+    std::size_t const slash = rulestring.rfind('/');
+    if(slash == std::string::npos || slash + 1 == rulestring.size())
+    {
+        throw std::invalid_argument("Generations rulestring must end with /C<states>: " + rulestring);
+    }
+
+    std::string states = rulestring.substr(slash + 1);
+    if(states[0] == 'C' || states[0] == 'c' || states[0] == 'G' || states[0] == 'g')
+    {
+        states = states.substr(1);
+    }
+
+    if(states.empty() || states.size() > 2 || states.find_first_not_of("0123456789") != std::string::npos)
+    {
+        throw std::invalid_argument("Generations state count must be a number: " + rulestring);
+    }
+
+    return GenerationsRule(Rule::parse(rulestring.substr(0, slash)), (unsigned int)std::stoul(states));
+}
+
+
+/**
+ * GenerationsRule::brians_brain()
+ *
+ * Brian's Brain, B2/S/C3, where every alive cell dies at once and spends one generation dying.
+ */
+GenerationsRule GenerationsRule::brians_brain() { return GenerationsRule(Rule(rule_mask("B2/S")), 3); }
+
+
+/**
+ * GenerationsRule::star_wars()
+ *
+ * Star Wars, B2/S345/C4.
+ */
+GenerationsRule GenerationsRule::star_wars() { return GenerationsRule(Rule(rule_mask("B2/S345")), 4); }
+
+
+/**
+ * GenerationsRule::get_rule()
+ *
+ * Gets the birth and survival counts.
+ */
+Rule const & GenerationsRule::get_rule() const { return m_rule; }
+
+
+/**
+ * GenerationsRule::get_states()
+ *
+ * Gets the number of states including dead and alive.
+ */
+unsigned int GenerationsRule::get_states() const { return m_states; }
+
+
+/**
+ * GenerationsRule::to_string()
+ *
+ * The rule as a B/S/C rulestring, for example "B2/S/C3".
+ */
+std::string GenerationsRule::to_string() const
+{
+    return m_rule.to_string() + "/C" + std::to_string(m_states);
+}
+
+
+/**
+ * GenerationsRule::operator==(other)
+ */
+bool GenerationsRule::operator==(GenerationsRule const & other) const
+{
+    return m_rule == other.m_rule && m_states == other.m_states;
+}
+
+
+/**
+ * GenerationsRule::operator!=(other)
+ */
+bool GenerationsRule::operator!=(GenerationsRule const & other) const
+{
+    return !(*this == other);
+}
+
+
+/**
+ * GenerationsWorld::GenerationsWorld()
+ *
+ * Construct an empty 0x0 Brian's Brain world.
+ */
+GenerationsWorld::GenerationsWorld()
+    : GenerationsWorld(0, 0, GenerationsRule())
+{
+
+}
+
+
+/**
+ * GenerationsWorld::GenerationsWorld(width, height, rule)
+ *
+ * Construct a world of dead cells.
+ *
+ * @example
+ *
+ *      // Seed Brian's Brain with a pair of cells that grows forever
+ *      GenerationsWorld world(256, 256, GenerationsRule::brians_brain());
+ *      world.set(127, 128, 1);
+ *      world.set(128, 128, 1);
+ *      world.advance(100);
+ *
+ * @param width
+ *      The width of the world.
+ *
+ * @param height
+ *      The height of the world.
+ *
+ * @param rule
+ *      The Generations rule the world steps with.
+ */
+GenerationsWorld::GenerationsWorld(unsigned int width, unsigned int height, GenerationsRule const & rule)
+    : m_rule(rule), m_alive(width, height), m_next(width, height)
+{
+    unsigned int bits = 1;
+    while((1u << bits) < rule.get_states())
+    {
+        bits++;
+    }
+
+    m_planes.assign(bits, BitGrid(width, height));
+}
+
+
+/**
+ * GenerationsWorld::get_width()
+ *
+ * Gets the width of the world.
+ */
+unsigned int const & GenerationsWorld::get_width() const { return m_alive.get_width(); }
+
+
+/**
+ * GenerationsWorld::get_height()
+ *
+ * Gets the height of the world.
+ */
+unsigned int const & GenerationsWorld::get_height() const { return m_alive.get_height(); }
+
+
+/**
+ * GenerationsWorld::get_rule()
+ *
+ * Gets the rule the world steps with.
+ */
+GenerationsRule const & GenerationsWorld::get_rule() const { return m_rule; }
+
+
+/**
+ * GenerationsWorld::get_bits_per_cell()
+ *
+ * Gets the number of bit planes the states are stored in.
+ */
+unsigned int GenerationsWorld::get_bits_per_cell() const { return (unsigned int)m_planes.size(); }
+
+
+/**
+ * GenerationsWorld::get(x, y)
+ *
+ * Gets the state of a cell, 0 for dead, 1 for alive, 2 and up for dying.
+ *
+ * @throws
+ *      coord_exception if the coordinate is outside the world.
+ */
+unsigned int GenerationsWorld::get(unsigned int x, unsigned int y) const
+{
+    unsigned int state = 0;
+    for(std::size_t i = 0; i < m_planes.size(); i++)
+    {
+        state |= (m_planes[i].get(x, y) == Cell::ALIVE ? 1u : 0u) << i;
+    }
+    return state;
+}
+
+
+/**
+ * GenerationsWorld::set(x, y, state)
+ *
+ * Sets the state of a cell.
+ *
+ * @throws
+ *      coord_exception if the coordinate is outside the world.
+ *      std::invalid_argument if the state is not less than the rule's number of states.
+ */
+void GenerationsWorld::set(unsigned int x, unsigned int y, unsigned int state)
+{
+    if(state >= m_rule.get_states())
+    {
+        throw std::invalid_argument("State " + std::to_string(state) + " is not a state of " + m_rule.to_string());
+    }
+
+    for(std::size_t i = 0; i < m_planes.size(); i++)
+    {
+        m_planes[i].set(x, y, ((state >> i) & 1) ? Cell::ALIVE : Cell::DEAD);
+    }
+}
+
+
+/**
+ * GenerationsWorld::get_cells_in_state(state)
+ *
+ * Gets the number of cells in a state.
+ */
+unsigned int GenerationsWorld::get_cells_in_state(unsigned int state) const
+{
+    std::uint64_t const last = m_alive.last_word_mask();
+    unsigned int count = 0;
+
+    for(unsigned int y = 0; y < get_height(); y++)
+    {
+        for(unsigned int w = 0; w < m_alive.get_words_per_row(); w++)
+        {
+            std::uint64_t match = (w + 1 == m_alive.get_words_per_row()) ? last : ~std::uint64_t(0);
+            for(std::size_t i = 0; i < m_planes.size(); i++)
+            {
+                std::uint64_t const word = m_planes[i].row(y)[w];
+                match &= ((state >> i) & 1) ? word : ~word;
+            }
+            count += popcount64(match);
+        }
+    }
+
+    return count;
+}
+
+
+/**
+ * GenerationsWorld::get_alive_cells()
+ *
+ * Gets the number of cells in state 1.
+ */
+unsigned int GenerationsWorld::get_alive_cells() const
+{
+    return get_cells_in_state(1);
+}
+
+
+/**
+ * GenerationsWorld::get_alive_grid()
+ *
+ * Gets the cells in state 1 as a packed grid, for printing or comparing with a two state World.
+ */
+BitGrid GenerationsWorld::get_alive_grid() const
+{
+    BitGrid alive(get_width(), get_height());
+
+    for(unsigned int y = 0; y < get_height(); y++)
+    {
+        for(unsigned int w = 0; w < alive.get_words_per_row(); w++)
+        {
+            std::uint64_t word = m_planes[0].row(y)[w];
+            for(std::size_t i = 1; i < m_planes.size(); i++)
+            {
+                word &= ~m_planes[i].row(y)[w];
+            }
+            alive.row(y)[w] = word;
+        }
+    }
+
+    return alive;
+}
+
+
+/**
+ * alive_word<Bits>(planes, w)
+ *
+ * The cells of word w of a row in state 1, bit 0 set and every other bit clear.
+ */
+template<unsigned int Bits>
+static inline std::uint64_t alive_word(std::uint64_t const * const * planes, unsigned int w)
+{
+    std::uint64_t word = planes[0][w];
+    for(unsigned int i = 1; i < Bits; i++)
+    {
+        word &= ~planes[i][w];
+    }
+    return word;
+}
+
+
+/**
+ * generations_word<Bits>(planes, alive, next, w, states)
+ *
+ * Step word w of a row of states in place, given its alive cells this generation and the alive cells
+ * the life-like rule gives next.
+ */
+template<unsigned int Bits>
+static inline void generations_word(std::uint64_t * const * planes, std::uint64_t const * alive, std::uint64_t const * next,
+                                    unsigned int w, unsigned int states)
+{
+    std::uint64_t inc[Bits];
+    std::uint64_t carry = ~std::uint64_t(0);
+    std::uint64_t any = 0;
+
+    //Every state plus one, with a ripple carry through the planes.
+    for(unsigned int i = 0; i < Bits; i++)
+    {
+        std::uint64_t const plane = planes[i][w];
+        any |= plane;
+        inc[i] = plane ^ carry;
+        carry &= plane;
+    }
+
+    //Cells reaching the number of states are dead again. When the number of states is a power of two
+    //the increment wraps to 0 by itself.
+    if(states != (1u << Bits))
+    {
+        std::uint64_t last = ~std::uint64_t(0);
+        for(unsigned int i = 0; i < Bits; i++)
+        {
+            last &= ((states >> i) & 1) ? inc[i] : ~inc[i];
+        }
+        for(unsigned int i = 0; i < Bits; i++)
+        {
+            inc[i] &= ~last;
+        }
+    }
+
+    //The increment is right for dying cells, for dead cells that are born and for alive cells that die.
+    //Alive cells that survive stay 1 and dead cells that are not born stay 0.
+    std::uint64_t const survive = alive[w] & next[w];
+    std::uint64_t const keep = ~(survive | (~any & ~next[w]));
+
+    planes[0][w] = (inc[0] & keep) | survive;
+    for(unsigned int i = 1; i < Bits; i++)
+    {
+        planes[i][w] = inc[i] & keep;
+    }
+}
+
+
+/**
+ * alive_row<Bits>(planes, alive, words)
+ *
+ * The portable scalar kernel extracting the alive cells of a row.
+ */
+template<unsigned int Bits>
+static void alive_row(std::uint64_t * const * planes, std::uint64_t * alive, unsigned int words)
+{
+    for(unsigned int w = 0; w < words; w++)
+    {
+        alive[w] = alive_word<Bits>(planes, w);
+    }
+}
+
+
+/**
+ * generations_row<Bits>(planes, alive, next, words, states)
+ *
+ * The portable scalar kernel stepping a row of states in place.
+ */
+template<unsigned int Bits>
+static void generations_row(std::uint64_t * const * planes, std::uint64_t const * alive, std::uint64_t const * next,
+                            unsigned int words, unsigned int states)
+{
+    for(unsigned int w = 0; w < words; w++)
+    {
+        generations_word<Bits>(planes, alive, next, w, states);
+    }
+}
+
+#if SIMD_X86
+
+/**
+ * alive_row_avx2<Bits>(planes, alive, words)
+ *
+ * alive_row on 4 words at a time.
+ */
+template<unsigned int Bits>
+TARGET_AVX2
+static void alive_row_avx2(std::uint64_t * const * planes, std::uint64_t * alive, unsigned int words)
+{
+    unsigned int w = 0;
+
+    for(; w + 4 <= words; w += 4)
+    {
+        __m256i word = _mm256_loadu_si256((__m256i const *)(planes[0] + w));
+        for(unsigned int i = 1; i < Bits; i++)
+        {
+            word = _mm256_andnot_si256(_mm256_loadu_si256((__m256i const *)(planes[i] + w)), word);
+        }
+        _mm256_storeu_si256((__m256i *)(alive + w), word);
+    }
+
+    for(; w < words; w++)
+    {
+        alive[w] = alive_word<Bits>(planes, w);
+    }
+}
+
+
+/**
+ * generations_row_avx2<Bits>(planes, alive, next, words, states)
+ *
+ * generations_row on 4 words at a time.
+ */
+template<unsigned int Bits>
+TARGET_AVX2
+static void generations_row_avx2(std::uint64_t * const * planes, std::uint64_t const * alive, std::uint64_t const * next,
+                                 unsigned int words, unsigned int states)
+{
+    __m256i const ones = _mm256_set1_epi64x(-1);
+    bool const wraps = (states == (1u << Bits));
+    unsigned int w = 0;
+
+    for(; w + 4 <= words; w += 4)
+    {
+        __m256i inc[Bits];
+        __m256i carry = ones;
+        __m256i any = _mm256_setzero_si256();
+
+        for(unsigned int i = 0; i < Bits; i++)
+        {
+            __m256i const plane = _mm256_loadu_si256((__m256i const *)(planes[i] + w));
+            any = _mm256_or_si256(any, plane);
+            inc[i] = _mm256_xor_si256(plane, carry);
+            carry = _mm256_and_si256(carry, plane);
+        }
+
+        if(!wraps)
+        {
+            __m256i last = ones;
+            for(unsigned int i = 0; i < Bits; i++)
+            {
+                last = ((states >> i) & 1) ? _mm256_and_si256(last, inc[i]) : _mm256_andnot_si256(inc[i], last);
+            }
+            for(unsigned int i = 0; i < Bits; i++)
+            {
+                inc[i] = _mm256_andnot_si256(last, inc[i]);
+            }
+        }
+
+        __m256i const a = _mm256_loadu_si256((__m256i const *)(alive + w));
+        __m256i const n = _mm256_loadu_si256((__m256i const *)(next + w));
+        __m256i const survive = _mm256_and_si256(a, n);
+        __m256i const change = _mm256_andnot_si256(_mm256_or_si256(survive, _mm256_andnot_si256(any, _mm256_xor_si256(n, ones))), ones);
+
+        _mm256_storeu_si256((__m256i *)(planes[0] + w), _mm256_or_si256(_mm256_and_si256(inc[0], change), survive));
+        for(unsigned int i = 1; i < Bits; i++)
+        {
+            _mm256_storeu_si256((__m256i *)(planes[i] + w), _mm256_and_si256(inc[i], change));
+        }
+    }
+
+    for(; w < words; w++)
+    {
+        generations_word<Bits>(planes, alive, next, w, states);
+    }
+}
+
+#endif
+
+
+/**
+ * generations_step<Bits>(planes, alive, next, toroidal, rule)
+ *
+ * Step every row of a world stored in Bits planes, a band of GENERATIONS_BAND_ROWS rows at a time so that the
+ * planes are read and written back while they are still in cache.
+ */
+template<unsigned int Bits>
+static void generations_step(std::vector<BitGrid> & planes, BitGrid & alive, BitGrid & next, bool toroidal,
+                             GenerationsRule const & rule)
+{
+    unsigned int const height = alive.get_height();
+    unsigned int const words = alive.get_words_per_row();
+    std::uint64_t const last = alive.last_word_mask();
+    std::uint64_t * rows[Bits];
+
+    void (*alive_kernel)(std::uint64_t * const *, std::uint64_t *, unsigned int) = alive_row<Bits>;
+    void (*step_kernel)(std::uint64_t * const *, std::uint64_t const *, std::uint64_t const *, unsigned int, unsigned int) = generations_row<Bits>;
+
+#if SIMD_X86
+    //AVX-512 machines run the AVX2 kernels, the planes are too few words per cell for wider vectors to pay off.
+    if(active_simd_level() != SimdLevel::Scalar)
+    {
+        alive_kernel = alive_row_avx2<Bits>;
+        step_kernel = generations_row_avx2<Bits>;
+    }
+#endif
+
+    auto load = [&](unsigned int y)
+    {
+        for(unsigned int i = 0; i < Bits; i++)
+        {
+            rows[i] = planes[i].row(y);
+        }
+    };
+
+    //The first band of a torus reads the last row, which is not stepped until the last band.
+    if(toroidal)
+    {
+        load(height - 1);
+        alive_kernel(rows, alive.row(height - 1), words);
+    }
+
+    //Alive cells are extracted a row ahead of the band, as the band's last row reads the row below it.
+    unsigned int extracted = 0;
+
+    for(unsigned int y0 = 0; y0 < height; y0 += GENERATIONS_BAND_ROWS)
+    {
+        unsigned int const y1 = std::min(y0 + GENERATIONS_BAND_ROWS, height);
+
+        for(; extracted < std::min(y1 + 1, height); extracted++)
+        {
+            load(extracted);
+            alive_kernel(rows, alive.row(extracted), words);
+        }
+
+        step_bits(alive, next, toroidal, y0, y1, rule.get_rule());
+
+        for(unsigned int y = y0; y < y1; y++)
+        {
+            load(y);
+            step_kernel(rows, alive.row(y), next.row(y), words, rule.get_states());
+
+            //Bits past the width are dead, and the increment would have made them alive.
+            for(unsigned int i = 0; i < Bits; i++)
+            {
+                rows[i][words - 1] &= last;
+            }
+        }
+    }
+}
+
+
+/**
+ * GenerationsWorld::step(toroidal)
+ *
+ * Take one step in the world's Generations rule.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then the left edge wraps to the right edge and the top to the bottom. Defaults to false.
+ */
+void GenerationsWorld::step(bool toroidal)
+{
+    if(m_alive.get_words_per_row() == 0 || get_height() == 0)
+    {
+        return;
+    }
+
+    switch(m_planes.size())
+    {
+        case 1:  generations_step<1>(m_planes, m_alive, m_next, toroidal, m_rule); break;
+        case 2:  generations_step<2>(m_planes, m_alive, m_next, toroidal, m_rule); break;
+        case 3:  generations_step<3>(m_planes, m_alive, m_next, toroidal, m_rule); break;
+        default: generations_step<4>(m_planes, m_alive, m_next, toroidal, m_rule); break;
+    }
+}
+
+
+/**
+ * GenerationsWorld::advance(steps, toroidal)
+ *
+ * Advance multiple steps in the world's Generations rule.
+ */
+void GenerationsWorld::advance(unsigned int steps, bool toroidal)
+{
+    for(unsigned int i = 0; i < steps; i++)
+    {
+        step(toroidal);
+    }
+}
+
+
+/**
+ * GenerationsWorld::operator==(other)
+ *
+ * Worlds are equal if they have the same rule, size and states.
+ */
+bool GenerationsWorld::operator==(GenerationsWorld const & other) const
+{
+    return m_rule == other.m_rule && m_planes == other.m_planes;
+}
+
+
+/**
+ * GenerationsWorld::operator!=(other)
+ */
+bool GenerationsWorld::operator!=(GenerationsWorld const & other) const
+{
+    return !(*this == other);
+}
+
+
+/**
+ * operator<<(output_stream, world)
+ *
+ * Print a world in a border like a Grid, with each cell drawn as generations_state_char(state).
+ */
+std::ostream & operator <<(std::ostream & output, GenerationsWorld const & world)
+{
+    std::string const border = "+" + std::string(world.get_width(), '-') + "+";
+
+    output << border << std::endl;
+
+    for(unsigned int y = 0; y < world.get_height(); y++)
+    {
+        std::string line(world.get_width(), ' ');
+        for(unsigned int x = 0; x < world.get_width(); x++)
+        {
+            line[x] = generations_state_char(world.get(x, y));
+        }
+        output << '|' << line << '|' << std::endl;
+    }
+
+    output << border << std::endl;
+
+    return output;
+}
@@ -0,0 +1,104 @@
+/**
+ * Declares a world for Generations rules, life-like rules whose cells take several generations to die.
+ * Rich documentation for the api and behaviour of the GenerationsRule and GenerationsWorld classes can be found in generations.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "bitgrid.h"
+#include "rule.h"
+
+/**
+ * The most states a Generations cell can have, so a cell fits in four bit planes.
+ */
+#define GENERATIONS_MAX_STATES 16
+
+/**
+ * The number of rows GenerationsWorld::step steps at a time, small enough that a band of every plane stays in cache.
+ */
+#define GENERATIONS_BAND_ROWS 32
+
+/**
+ * Declare the structure of the GenerationsRule class.
+ *
+ * A life-like birth and survival rule plus the number of states, written B2/S/C3 or in the older S/B/C form 345/2/4.
+ * State 0 is dead, state 1 alive, and states 2 to states - 1 are dying.
+ */
+class GenerationsRule {
+
+private:
+
+    Rule m_rule;
+    unsigned int m_states;
+
+public:
+
+    GenerationsRule();
+    GenerationsRule(Rule const & rule, unsigned int states);
+
+    static GenerationsRule parse(std::string const & rulestring);
+
+    static GenerationsRule brians_brain();
+    static GenerationsRule star_wars();
+
+    Rule const & get_rule() const;
+    unsigned int get_states() const;
+
+    std::string to_string() const;
+
+    bool operator==(GenerationsRule const & other) const;
+    bool operator!=(GenerationsRule const & other) const;
+};
+
+/**
+ * Declare the structure of the GenerationsWorld class.
+ *
+ * Cells are stored as bit planes, plane i holding bit i of every cell's state packed 64 cells per word,
+ * so a cell costs as many bits as its states need, 1 to 4.
+ */
+class GenerationsWorld {
+
+private:
+
+    GenerationsRule m_rule;
+    std::vector<BitGrid> m_planes;
+
+    BitGrid m_alive;        //Scratch, the cells in state 1.
+    BitGrid m_next;         //Scratch, the alive cells of the next generation under the life-like rule.
+
+public:
+
+    GenerationsWorld();
+    GenerationsWorld(unsigned int width, unsigned int height, GenerationsRule const & rule);
+
+    unsigned int const & get_width() const;
+    unsigned int const & get_height() const;
+    GenerationsRule const & get_rule() const;
+    unsigned int get_bits_per_cell() const;
+
+    unsigned int get(unsigned int x, unsigned int y) const;
+    void set(unsigned int x, unsigned int y, unsigned int state);
+
+    unsigned int get_cells_in_state(unsigned int state) const;
+    unsigned int get_alive_cells() const;
+
+    BitGrid get_alive_grid() const;
+
+    void step(bool toroidal = false);
+    void advance(unsigned int steps, bool toroidal = false);
+
+    bool operator==(GenerationsWorld const & other) const;
+    bool operator!=(GenerationsWorld const & other) const;
+
+    friend std::ostream & operator << (std::ostream & output, GenerationsWorld const & world);
+};
+
+char generations_state_char(unsigned int state);
+int generations_char_state(char c);
@@ -5,8 +5,14 @@
  *      - Grids can be rotated, cropped, and merged together.
  *      - Grids can return counts of the alive and dead cells.
  *      - Grids can be serialized directly to an ascii std::ostream.
+ *          - Whole rows are formatted into a reusable buffer and written out a block at a time,
+ *            so a frame is printed with a single write rather than a character at a time.
  *
- * You are encouraged to use STL container types as an underlying storage mechanism for the grid cells.
+ *      - Cells are stored in a single contiguous buffer aligned to a cache line.
+ *          - Rows are laid out one after another, each row is Grid::get_stride() cells long.
+ *          - The stride is the width rounded up to a whole number of cache lines, so every row starts
+ *            on a cache line. The padding cells at the end of each row are always Cell::DEAD.
+ *          - Grid::row(y) exposes an unchecked pointer to the start of a row for bulk loops.
  *
  * @author 963653
  * @date April, 2020
@@ -16,6 +22,26 @@
 // Include the minimal number of headers needed to support your implementation.
 // #include ...
 #include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+/**
+ * Rounds a width up to a whole number of cache lines of cells.
+ * Throws std::length_error if the padded row would not fit in an unsigned int.
+ */
+static unsigned int padded_stride(unsigned int width)
+{
+    std::size_t const line = CACHE_LINE_SIZE / sizeof(Cell);
+    std::size_t const stride = ((std::size_t(width) + line - 1) / line) * line;
+
+    if(stride > std::numeric_limits<unsigned int>::max())
+    {
+        throw std::length_error("Grid width is too large.");
+    }
+
+    return (unsigned int)stride;
+}
 
 /**
  * Grid::Grid()
@@ -82,18 +108,10 @@ Grid::Grid(unsigned int const & sqaure_size)
  *      The height of the grid.
  */
 Grid::Grid(unsigned int const & width, unsigned int const & height)
-    : m_width(width), m_height(height)
+    : m_width(width), m_height(height), m_stride(padded_stride(width)),
+      m_body(std::size_t(m_stride) * height, Cell::DEAD)    //Single allocation for every row.
 {
 
-    for(unsigned int i = 0; i < height; i++)
-    {      
-        m_body.push_back(std::vector<Cell>());
-
-        for(unsigned int j = 0; j < width; j++)
-        {
-            m_body[i].push_back(Cell::DEAD);    //Insert default dead cell.
-        }   
-    }
 }
 
 
@@ -149,6 +167,46 @@ Grid::Grid(unsigned int const & width, unsigned int const & height)
  unsigned int const & Grid::get_height() const { return m_height; }
 
 
+/**
+ * Grid::get_stride()
+ *
+ * Gets the number of cells between the start of one row and the start of the next in memory.
+ * This is the width rounded up to a whole cache line, so it is always >= Grid::get_width().
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The row stride of the grid in cells.
+ */
+ unsigned int const & Grid::get_stride() const { return m_stride; }
+
+
+/**
+ * Grid::row(y)
+ *
+ * Gets a pointer to the first cell of a row, for loops which walk whole rows at a time.
+ * The row is Grid::get_width() cells long and is followed by Cell::DEAD padding up to Grid::get_stride().
+ * Unlike Grid::operator()(x, y) the coordinate is not checked, y must be less than the height.
+ *
+ * @example
+ *
+ *      // Make a grid
+ *      Grid grid(4, 4);
+ *
+ *      // Fill the second row
+ *      Cell *r = grid.row(1);
+ *      std::fill(r, r + grid.get_width(), Cell::ALIVE);
+ *
+ * @param y
+ *      The y coordinate of the row.
+ *
+ * @return
+ *      A pointer to the cell at (0, y).
+ */
+Cell * Grid::row(unsigned int y) { return &m_body[std::size_t(m_stride) * y]; }
+
+Cell const * Grid::row(unsigned int y) const { return &m_body[std::size_t(m_stride) * y]; }
+
+
 /**
  * Grid::get_total_cells()
  *
@@ -204,12 +262,11 @@ unsigned int const Grid::get_alive_cells() const
 
     for(unsigned int i = 0; i < m_height; i++)
     {
+        Cell const * r = row(i);
+
         for(unsigned int j = 0; j < m_width; j++)
         {
-            if(m_body[i][j] == Cell::ALIVE)
-            {
-                count++;
-            }
+            count += (r[j] == Cell::ALIVE);
         }
     }
     return count;
@@ -242,19 +299,7 @@ unsigned int const Grid::get_alive_cells() const
  */
 unsigned int const Grid::get_dead_cells() const 
 {
-    unsigned int count = 0;
-
-    for(unsigned int i = 0; i < m_height; i++)
-    {
-        for(unsigned int j = 0; j < m_width; j++)
-        {
-            if(m_body[i][j] == Cell::DEAD)
-            {
-                count++;
-            }
-        }
-    }
-    return count;
+    return get_total_cells() - get_alive_cells();
 }
 
 
@@ -302,47 +347,19 @@ void Grid::resize(unsigned int const & square_size)
  *      The new height for the grid.
  */
 void Grid::resize(unsigned int const & new_width, unsigned int const & new_height)
-{    
-    //If the new width is less than the current width, pop a Vector of Cells off the main Vector. 
-    if(new_height < m_height)
-    {  
-        for(unsigned int i = 0; i < (m_height - new_height) ;i++)
-            m_body.pop_back();
-    }
-    else    //If the new width is greater, append the difference.
-    {
-        for(unsigned int i = m_height; i < new_height;i++)
-        {
-            m_body.push_back(std::vector<Cell>());  //Push back rows.
-            for(unsigned int j = 0; j < new_height; j++)
-            {
-                    m_body[i].push_back(Cell::DEAD);    //Insert default dead cell.
-            }
-        }
-    }
+{
+    Grid resized(new_width, new_height);
 
-    this->m_height = new_height;
+    //Copy the kept region a row at a time, everything else is already dead.
+    unsigned int const kept_width = std::min(m_width, new_width);
+    unsigned int const kept_height = std::min(m_height, new_height);
 
-    //If the new width is less than the current width, pop off the necessary amount of Vector of Cells from the main Vector. 
-    if(new_width < m_width)
-    {  
-        for(unsigned int i = 0; i < new_height; i++)
-        {
-            for(unsigned int j = 0; j < (m_width - new_width); j++)
-                m_body[i].pop_back();
-        }
-    }
-    else
+    for(unsigned int i = 0; i < kept_height; i++)
     {
-        for(unsigned int i = 0; i < new_height; i++)
-        {
-            for(unsigned int j = m_width; j < new_width; j++)
-                m_body[i].push_back(Cell::DEAD);
-        }
-
+        std::memcpy(resized.row(i), row(i), kept_width * sizeof(Cell));
     }
 
-    this->m_width = new_width;  
+    std::swap(*this, resized);
 }
 
 /**
@@ -361,9 +378,9 @@ void Grid::resize(unsigned int const & new_width, unsigned int const & new_heigh
  * @return
  *      The 1d offset from the start of the data array where the desired cell is located.
  */ 
-unsigned int const Grid::get_index(unsigned int x, unsigned int y) { 
-   
-    return (m_width * y) + x;
+std::size_t Grid::get_index(unsigned int x, unsigned int y) const
+{
+    return (std::size_t(m_stride) * y) + x;
 }
 
 
@@ -488,7 +505,7 @@ Cell & Grid::operator()(unsigned int x, unsigned int y)
 {
     if((x < m_width) && (y < m_height))
     {
-        return m_body[y][x];;
+        return m_body[get_index(x, y)];
     }
     else 
     {
@@ -531,12 +548,12 @@ Cell const & Grid::operator()(unsigned int x, unsigned int y) const
 {
     if((x < m_width) && (y < m_height))
     {
-        return m_body[y][x];
+        return m_body[get_index(x, y)];
     }
     else 
     {
         throw coord_exception(x, y , m_width, m_height);
-    };
+    }
 }
 
 
@@ -577,30 +594,23 @@ Cell const & Grid::operator()(unsigned int x, unsigned int y) const
 Grid Grid::crop(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1) const
 {
 
-    //If x0 or y0 are smaller than grids bounds, then throw an error.
-    if(x0 < 0 || y0 <0)
-    {
-        throw coord_exception(x0, y0 , m_width, m_height);
-    }
     //If x1 or y1 are larger than the the original grids bounds then throw an error.
-    else if((x1  - 1) > m_width || (y1 - 1) > m_height)
+    if(x1 > m_width || y1 > m_height)
     {
-        throw coord_exception(x0, y0 , m_width, m_height);
+        throw coord_exception(x1, y1 , m_width, m_height);
     }
-    //If x0 or y0 are bigger than x1 or y1 then throw an error.
-    else if(x0 > (x1-1) || y0 > (y1-1))
+    //If x0 or y0 are not smaller than x1 or y1 then throw an error.
+    else if(x0 >= x1 || y0 >= y1)
     {
         throw std::out_of_range("Illegal Coordinates provided");
     }
     else
     {
-        Grid newGrid = Grid(x1-x0, y1-y0);  
-        for(unsigned int y = y0, i = 0; y < y1 && i < newGrid.get_height(); y++, i++)
+        Grid newGrid = Grid(x1-x0, y1-y0);
+
+        for(unsigned int y = y0, i = 0; y < y1; y++, i++)
         {
-            for(unsigned int x = x0, j = 0; x < x1 && j < newGrid.get_width(); x++, j++)
-            {
-                newGrid.set(j, i, this->get(x,y));
-            }
+            std::memcpy(newGrid.row(i), row(y) + x0, newGrid.m_width * sizeof(Cell));
         }
         return newGrid;
     }
@@ -658,27 +668,24 @@ void Grid::merge(Grid const & other, unsigned int x0, unsigned int y0, bool aliv
     }
     else
     {
-        if(alive_only)
+        for(unsigned int j = 0; j < other.m_height; j++)
         {
-            for(unsigned int i = 0; i < other.m_width; i++)
+            Cell const * source = other.row(j);
+            Cell * target = row(y0 + j) + x0;
+
+            if(alive_only)
             {
-                for(unsigned int j = 0; j < other.m_height; j++)
+                for(unsigned int i = 0; i < other.m_width; i++)
                 {
-                    if(other.get(i,j) == Cell::ALIVE)
+                    if(source[i] == Cell::ALIVE)
                     {
-                        this->set(x0 + i, y0 + j, other.get(i,j));
+                        target[i] = Cell::ALIVE;
                     }
                 }
             }
-        }
-        else
-        {
-            for(unsigned int i = 0; i < other.m_width; i++)
+            else
             {
-                for(unsigned int j = 0; j < other.m_height; j++)
-                {
-                    this->set(x0 + i, y0 + j, other.get(i,j));
-                }
+                std::memcpy(target, source, other.m_width * sizeof(Cell));
             }
         }
     }
@@ -706,32 +713,23 @@ void Grid::merge(Grid const & other, unsigned int x0, unsigned int y0, bool aliv
  * @return
  *      Returns a copy of the grid that has been rotated.
  */
-Grid Grid::rotate(int rotation)
+Grid Grid::rotate(int rotation) const
 {
     int turns = (4 * abs(rotation) + rotation) % 4;  
 
     switch(turns)
     {
-        case 0:
-        {
-            Grid temp = *this;
-
-            std::cout << "" << std::endl;
-
-            return temp;
-        }
         case 1: 
         {
-            unsigned int new_width = m_height;
-            unsigned int new_height = m_width;
-
-            Grid temp(new_width, new_height); 
+            Grid temp(m_height, m_width); 
 
-            for (unsigned int i = 0; i < new_height; i++) 
+            for (unsigned int i = 0; i < temp.m_height; i++) 
             {
-                for (unsigned int j = 0; j < new_width; j++) 
+                Cell * target = temp.row(i);
+
+                for (unsigned int j = 0; j < temp.m_width; j++) 
                 {
-                    temp.m_body[i][j] = this->m_body[new_width - j - 1][i];
+                    target[j] = this->row(m_height - j - 1)[i];
                 }
             }
 
@@ -739,33 +737,28 @@ Grid Grid::rotate(int rotation)
         }
         case 2: 
         {
-            unsigned int new_width = m_width;
-            unsigned int new_height = m_height;
-
-            Grid temp(new_width, new_height); 
+            Grid temp(m_width, m_height); 
 
-            for (unsigned int i = 0; i < new_height; i++) 
+            for (unsigned int i = 0; i < m_height; i++) 
             {
-                for (unsigned int j = 0; j < new_width; j++) 
-                {
-                    temp.m_body[i][j] = this->m_body[new_height - i - 1][new_width - j - 1];
-                }
+                Cell const * source = this->row(m_height - i - 1);
+
+                std::reverse_copy(source, source + m_width, temp.row(i));
             }
             
             return temp;
         }
         case 3: 
         {
-            unsigned int new_width = m_height;
-            unsigned int new_height = m_width;
-
-            Grid temp(new_width, new_height); 
+            Grid temp(m_height, m_width); 
 
-            for (unsigned int i = 0; i < new_height; i++) 
+            for (unsigned int i = 0; i < temp.m_height; i++) 
             {
-                for (unsigned int j = 0; j < new_width; j++) 
+                Cell * target = temp.row(i);
+
+                for (unsigned int j = 0; j < temp.m_width; j++) 
                 {
-                    temp.m_body[i][j] = this->m_body[j][new_height - i - 1];
+                    target[j] = this->row(j)[m_width - i - 1];
                 }
             }   
 
@@ -773,11 +766,133 @@ Grid Grid::rotate(int rotation)
         }
         default:
         {   
-            //In default case, return unrotated original. (Shouldnt occur.)
-            Grid temp = *this;
+            //No rotation, return a copy of the original.
+            return *this;
+        }
+    }
+}
 
-            return temp;
+
+/**
+ * Grid::reflect()
+ *
+ * Create a copy of the grid mirrored left to right. Together with Grid::rotate this gives all eight
+ * orientations of a grid, the reflection followed by a rotation reaching the other four.
+ *
+ * @example
+ *
+ *      // Make a 3x1 grid with its leftmost cell alive
+ *      Grid x(3, 1);
+ *      x(0, 0) = Cell::ALIVE;
+ *
+ *      // y has its rightmost cell alive
+ *      Grid y = x.reflect();
+ *
+ * @return
+ *      Returns a copy of the grid that has been reflected.
+ */
+Grid Grid::reflect() const
+{
+    Grid temp(m_width, m_height);
+
+    for (unsigned int i = 0; i < m_height; i++)
+    {
+        Cell const * source = this->row(i);
+
+        std::reverse_copy(source, source + m_width, temp.row(i));
+    }
+
+    return temp;
+}
+
+
+/**
+ * Grid::write_ascii(output, bordered)
+ *
+ * Write every row of the grid to an output stream as its cells followed by a newline, optionally wrapped in
+ * the border operator<< prints. Rows are copied into a buffer kept between calls, a Cell being the character
+ * it is written as, and the buffer is written out whenever it holds GRID_WRITE_BLOCK_BYTES, so a frame no
+ * larger than that is a single write. The stream is never flushed.
+ *
+ * @example
+ *
+ *      // The rows of a .gol file
+ *      grid.write_ascii(file, false);
+ *
+ * @param output
+ *      The stream to write to.
+ *
+ * @param bordered
+ *      If true each row is wrapped in | (pipe) characters and the grid in lines of - (dash) cornered with + (plus).
+ */
+void Grid::write_ascii(std::ostream & output, bool bordered) const
+{
+    //One buffer per thread, so printing every generation does not allocate every generation
+    static thread_local std::vector<char> buffer;
+
+    std::size_t const line = std::size_t(m_width) + (bordered ? 3 : 1);
+    std::size_t const lines = std::size_t(m_height) + (bordered ? 2 : 0);
+    std::size_t const capacity = line * std::min(lines, std::max<std::size_t>(1, GRID_WRITE_BLOCK_BYTES / line));
+
+    if(buffer.size() < capacity)
+    {
+        buffer.resize(capacity);
+    }
+
+    char * const start = buffer.data();
+    char * out = start;
+
+    auto const border = [&]()
+    {
+        *out++ = '+';
+        std::memset(out, '-', m_width);
+        out += m_width;
+        *out++ = '+';
+        *out++ = '\n';
+    };
+
+    if(bordered)
+    {
+        border();
+    }
+
+    for(unsigned int y = 0; y < m_height; y++)
+    {
+        if(std::size_t(out - start) + line > capacity)
+        {
+            output.write(start, out - start);
+            out = start;
+        }
+
+        if(bordered)
+        {
+            *out++ = '|';
+        }
+
+        std::memcpy(out, row(y), m_width);
+        out += m_width;
+
+        if(bordered)
+        {
+            *out++ = '|';
         }
+        *out++ = '\n';
+    }
+
+    if(bordered)
+    {
+        if(std::size_t(out - start) + line > capacity)
+        {
+            output.write(start, out - start);
+            out = start;
+        }
+
+        border();
+    }
+
+    if(out != start)
+    {
+        output.write(start, out - start);
     }
 }
 
@@ -819,43 +934,7 @@ Grid Grid::rotate(int rotation)
  */
 std::ostream & operator <<(std::ostream & output, const Grid & grid)
 {
-
-    //Converted to ints and stored as temp variables...
-    //instead of casting to int each time a comparison is made between width/height
-    //and the loop variables (ints).
-    int width = grid.m_width;
-    int height = grid.m_height;
-
-
-    for(int i = -1; i < height + 1; i++)
-    {
-        for(int j = -1; j < width + 1; j++)
-        {
-            if(    (i == -1 && j == -1)
-                || (i == -1 && j == width) 
-                || (i == height && j == -1)  
-                || (i == height && j == width))
-            {   
-                output << "+";
-            }
-            else if(i == -1 || i == height) 
-            {
-                output << "-";
-            }
-            else if(j == -1 || j == width)
-            {
-                output << "|";
-            }
-            else 
-            {
-                output << char(grid.get(j,i));
-            }
-        }
-        output << std::endl;
-    }
+    grid.write_ascii(output, true);
 
     return output;
-
 }
-
-
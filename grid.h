@@ -18,6 +18,8 @@
 #include <iostream>
 #include <sstream>
 
+#include "aligned_allocator.h"
+
 /**
  * A Cell is a char limited to two named values for Cell::DEAD and Cell::ALIVE.
  */
@@ -26,6 +28,12 @@ enum Cell : char {
     ALIVE = '#'
 };
 
+/**
+ * The most bytes Grid::write_ascii() formats before writing them out, so a frame of up to a million cells
+ * is printed with a single write, and larger grids in as few as possible.
+ */
+#define GRID_WRITE_BLOCK_BYTES (1 << 20)
+
 /**
  * Custom exception class build as an extension of std::exception. Stores
  * the invalid coordinate, and also the grid dimensions to enable analysis of 
@@ -68,10 +76,11 @@ private:
     //      Step 2. Draw the rest of the owl.
     
     unsigned int m_width, m_height;
+    unsigned int m_stride;                      //Cells per row in memory, width rounded up to a whole cache line.
 
-    std::vector<std::vector<Cell> > m_body;     //Vector of a vector of cells. (Mimics a 2d array.)
+    std::vector<Cell, AlignedAllocator<Cell> > m_body;     //One contiguous cache-line-aligned buffer, row after row.
 
-    unsigned int const get_index(unsigned int x, unsigned int y);
+    std::size_t get_index(unsigned int x, unsigned int y) const;
 
 public: 
 
@@ -88,6 +97,10 @@ public:
 
     unsigned int const & get_width() const; 
     unsigned int const & get_height() const; 
+    unsigned int const & get_stride() const;
+
+    Cell * row(unsigned int y);
+    Cell const * row(unsigned int y) const;
 
     unsigned int const get_alive_cells() const;
     unsigned int const get_dead_cells() const;
@@ -98,5 +111,8 @@ public:
 
     Grid crop(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1) const;
     void merge(Grid const & other, unsigned int x0, unsigned int y0, bool alive_only = false);
-    Grid rotate(int rotation);
+    Grid rotate(int rotation) const;
+    Grid reflect() const;
+
+    void write_ascii(std::ostream & output, bool bordered) const;
 };
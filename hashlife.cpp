@@ -0,0 +1,959 @@
+/**
+ * Implements Bill Gosper's HashLife algorithm for Conway's Game of Life.
+ *
+ *      - The universe is a quadtree of square nodes, 2^level cells on a side.
+ *          - Level 0 nodes are single cells, node 0 is dead and node 1 is alive.
+ *          - Every other node has four children (nw, ne, sw, se) of the level below.
+ *          - Nodes are hash-consed, a node is only created if no node with the same four children exists,
+ *            so identical squares anywhere in the universe, at any time, are the same node.
+ *
+ *      - The result of a node of level L is its centre 2^(L-1) square advanced by 2^min(j, L - 2) generations,
+ *        for the step 2^j currently being taken. Nothing outside the node can reach the centre in that time.
+ *          - Nodes small enough to advance by 2^(L-2) do it in two halves, taking the results of nine
+ *            overlapping sub-squares and then the results of the four squares those make up.
+ *          - Larger nodes take the unadvanced centres of the nine sub-squares and advance the four squares
+ *            they make up by the whole step.
+ *          - Results are memoized in the node. Because nodes are shared, each distinct square is only ever
+ *            advanced once, and results of small nodes survive changes of step.
+ *          - Advancing by 2^j generations therefore costs time in the number of distinct squares the pattern
+ *            passes through, not in the number of generations or cells, so periodic and sparse patterns
+ *            can be advanced by billions of generations in a single call.
+ *
+ *      - On the infinite plane the root is centred on the origin and is padded with empty space until the
+ *        pattern cannot escape it in the time being advanced.
+ *
+ *      - A toroidal universe is a power of two square. To advance it, the torus is tiled periodically into a
+ *        larger node (in O(log) nodes thanks to hash-consing), the tiling is advanced like an infinite pattern,
+ *        and one period is read back out of the result.
+ *
+ *      - Nodes are kept in a vector and referred to by index. Unreachable nodes are freed by a mark and
+ *        sweep garbage collector, run automatically between advances once the node count passes a threshold.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#include "hashlife.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * The largest step HashLife::advance_pow2(k) accepts, keeping levels and coordinates within 64 bits.
+ */
+#define HASHLIFE_MAX_STEP_LOG2 60
+
+/**
+ * The number of nodes allocated before the first automatic garbage collection.
+ */
+#define HASHLIFE_MIN_GC_THRESHOLD (1u << 20)
+
+HashLife::NodeId const HashLife::NO_NODE;
+
+
+/**
+ * Mixes the four child indices of a node into a hash table slot.
+ */
+static inline std::uint64_t hash_children(std::uint32_t nw, std::uint32_t ne, std::uint32_t sw, std::uint32_t se)
+{
+    std::uint64_t h = (std::uint64_t(nw) << 32 | ne) * 0x9E3779B97F4A7C15ull;
+    h ^= (std::uint64_t(sw) << 32 | se) * 0xC2B2AE3D27D4EB4Full;
+    return h ^ (h >> 29);
+}
+
+
+/**
+ * HashLife::HashLife()
+ *
+ * Construct an empty universe on the infinite plane.
+ *
+ * @example
+ *
+ *      // Make an empty universe
+ *      HashLife life;
+ */
+HashLife::HashLife()
+    : HashLife(Grid())
+{
+
+}
+
+
+/**
+ * HashLife::HashLife(initial_state, toroidal)
+ *
+ * Construct a universe from the cells of a grid.
+ *
+ * On the infinite plane the grid is placed with its top left cell at (0, 0), and everything outside it is dead.
+ * A toroidal universe is exactly the grid, wrapping at its edges, and must be a power of two square.
+ *
+ * @example
+ *
+ *      // Put a glider gun on the infinite plane
+ *      HashLife life(Zoo::load_ascii("gosper_glider_gun.gol"));
+ *
+ *      // Make a 1024x1024 torus
+ *      HashLife torus(Grid(1024), true);
+ *
+ * @param initial_state
+ *      The cells of the universe.
+ *
+ * @param toroidal
+ *      Optional parameter. If true the universe is a torus the size of the grid. Defaults to false.
+ *
+ * @throws
+ *      std::invalid_argument if toroidal and the grid is not a square with a power of two side of at least 2.
+ */
+HashLife::HashLife(Grid const & initial_state, bool toroidal)
+    : m_table_used(0), m_root(NO_NODE), m_toroidal(toroidal),
+      m_width(initial_state.get_width()), m_height(initial_state.get_height()),
+      m_generation(0), m_result_log2(0), m_gc_threshold(HASHLIFE_MIN_GC_THRESHOLD)
+{
+    unsigned int const side = std::max(m_width, m_height);
+
+    if(toroidal && (m_width != m_height || side < 2 || (side & (side - 1)) != 0))
+    {
+        throw std::invalid_argument("A toroidal HashLife universe must be a square with a power of two side");
+    }
+
+    //The two cells.
+    Node cell = { NO_NODE, NO_NODE, NO_NODE, NO_NODE, NO_NODE, 0, 0, false };
+    m_nodes.push_back(cell);
+    cell.population = 1;
+    m_nodes.push_back(cell);
+
+    m_table.assign(1 << 16, NO_NODE);
+    m_empty.push_back(0);
+
+    unsigned int level = 0;
+    if(toroidal)
+    {
+        while((1u << level) < side)
+        {
+            level++;
+        }
+        m_root = build(initial_state, level, 0, 0);
+    }
+    else
+    {
+        //The root covers [-2^(level-1), 2^(level-1)) on both axes, so the grid fills part of its south east quarter.
+        level = 3;
+        while((std::uint64_t(1) << (level - 1)) < side)
+        {
+            level++;
+        }
+        std::int64_t const half = std::int64_t(1) << (level - 1);
+        m_root = build(initial_state, level, -half, -half);
+    }
+}
+
+
+/**
+ * HashLife::is_toroidal()
+ *
+ * Whether the universe is a torus rather than the infinite plane.
+ */
+bool HashLife::is_toroidal() const
+{
+    return m_toroidal;
+}
+
+
+/**
+ * HashLife::get_level()
+ *
+ * Gets the level of the root node, the universe currently held spans 2^level cells on a side.
+ */
+unsigned int HashLife::get_level() const
+{
+    return m_nodes[m_root].level;
+}
+
+
+/**
+ * HashLife::get_generation()
+ *
+ * Gets the number of generations the universe has been advanced since it was constructed.
+ */
+std::uint64_t HashLife::get_generation() const
+{
+    return m_generation;
+}
+
+
+/**
+ * HashLife::get_population()
+ *
+ * Gets the number of alive cells in the universe.
+ */
+std::uint64_t HashLife::get_population() const
+{
+    return m_nodes[m_root].population;
+}
+
+
+/**
+ * HashLife::get_node_count()
+ *
+ * Gets the number of nodes currently allocated, including garbage not yet collected.
+ */
+std::size_t HashLife::get_node_count() const
+{
+    return m_nodes.size() - m_free.size();
+}
+
+
+/**
+ * HashLife::get(x, y)
+ *
+ * Gets the state of a cell.
+ *
+ * @example
+ *
+ *      // Look far away from the pattern
+ *      Cell cell = life.get(-1000000000000, 42);
+ *
+ * @param x
+ *      The x coordinate of the cell. Any coordinate on the infinite plane, or in [0, width) on a torus.
+ *
+ * @param y
+ *      The y coordinate of the cell. Any coordinate on the infinite plane, or in [0, height) on a torus.
+ *
+ * @return
+ *      The state of the cell, cells outside the root on the infinite plane are dead.
+ *
+ * @throws
+ *      coord_exception if the universe is toroidal and the coordinate is outside it.
+ */
+Cell HashLife::get(std::int64_t x, std::int64_t y) const
+{
+    unsigned int const level = get_level();
+
+    if(m_toroidal)
+    {
+        if(x < 0 || y < 0 || x >= m_width || y >= m_height)
+        {
+            throw coord_exception((unsigned int)x, (unsigned int)y, m_width, m_height);
+        }
+        return get_cell(m_root, x, y);
+    }
+
+    std::int64_t const half = std::int64_t(1) << (level - 1);
+    if(x < -half || y < -half || x >= half || y >= half)
+    {
+        return Cell::DEAD;
+    }
+    return get_cell(m_root, x + half, y + half);
+}
+
+
+/**
+ * HashLife::set(x, y, value)
+ *
+ * Sets the state of a cell, growing the root on the infinite plane if the cell is outside it.
+ *
+ * @example
+ *
+ *      // Drop a cell next to the pattern
+ *      life.set(-3, 7, Cell::ALIVE);
+ *
+ * @param x
+ *      The x coordinate of the cell. Any coordinate within 2^60 of the origin on the infinite plane,
+ *      or in [0, width) on a torus.
+ *
+ * @param y
+ *      The y coordinate of the cell, with the same range as x.
+ *
+ * @param value
+ *      The new state of the cell.
+ *
+ * @throws
+ *      coord_exception if the universe is toroidal and the coordinate is outside it.
+ *      std::out_of_range if the coordinate is too far from the origin on the infinite plane.
+ */
+void HashLife::set(std::int64_t x, std::int64_t y, Cell value)
+{
+    if(m_toroidal)
+    {
+        if(x < 0 || y < 0 || x >= m_width || y >= m_height)
+        {
+            throw coord_exception((unsigned int)x, (unsigned int)y, m_width, m_height);
+        }
+        m_root = set_cell(m_root, x, y, value);
+        return;
+    }
+
+    std::int64_t const limit = std::int64_t(1) << HASHLIFE_MAX_STEP_LOG2;
+    if(x < -limit || y < -limit || x >= limit || y >= limit)
+    {
+        throw std::out_of_range("HashLife coordinate too far from the origin");
+    }
+
+    while(true)
+    {
+        std::int64_t const half = std::int64_t(1) << (get_level() - 1);
+        if(x >= -half && y >= -half && x < half && y < half)
+        {
+            m_root = set_cell(m_root, x + half, y + half, value);
+            return;
+        }
+        m_root = expand(m_root);
+    }
+}
+
+
+/**
+ * HashLife::to_grid()
+ *
+ * Convert the universe back to a grid. A torus is returned whole, the infinite plane is cropped to
+ * the rectangle the universe was constructed from, with its top left cell at (0, 0).
+ *
+ * @example
+ *
+ *      // Advance a world by a billion generations
+ *      HashLife life(world.get_state());
+ *      life.advance(1000000000);
+ *      World later(life.to_grid());
+ *
+ * @return
+ *      A grid holding the cells of the universe.
+ */
+Grid HashLife::to_grid() const
+{
+    return to_grid(0, 0, m_width, m_height);
+}
+
+
+/**
+ * HashLife::to_grid(x0, y0, width, height)
+ *
+ * Copy a rectangle of the universe into a grid.
+ *
+ * @example
+ *
+ *      // See where the gliders from a gun have got to
+ *      Grid window = life.to_grid(10000, 10000, 80, 40);
+ *
+ * @param x0
+ *      The x coordinate of the top left cell of the rectangle.
+ *
+ * @param y0
+ *      The y coordinate of the top left cell of the rectangle.
+ *
+ * @param width
+ *      The width of the rectangle.
+ *
+ * @param height
+ *      The height of the rectangle.
+ *
+ * @return
+ *      A grid of width x height cells. Cells outside a torus or outside the root are dead.
+ */
+Grid HashLife::to_grid(std::int64_t x0, std::int64_t y0, unsigned int width, unsigned int height) const
+{
+    Grid grid(width, height);
+
+    std::int64_t const origin = m_toroidal ? 0 : -(std::int64_t(1) << (get_level() - 1));
+    draw(m_root, origin, origin, grid, x0, y0);
+
+    return grid;
+}
+
+
+/**
+ * HashLife::advance_pow2(k)
+ *
+ * Advance the universe by 2^k generations of Conway's Game of Life in a single step of the algorithm.
+ *
+ * @example
+ *
+ *      // Advance a glider gun by 2^40 generations
+ *      life.advance_pow2(40);
+ *
+ * @param k
+ *      The base two logarithm of the number of generations, at most 60.
+ *
+ * @throws
+ *      std::out_of_range if k is too large.
+ */
+void HashLife::advance_pow2(unsigned int k)
+{
+    if(k > HASHLIFE_MAX_STEP_LOG2)
+    {
+        throw std::out_of_range("HashLife can advance by at most 2^60 generations at a time");
+    }
+
+    set_result_log2(k);
+
+    if(m_toroidal)
+    {
+        //Tile the torus so that the result is centred on whole periods, then take one period back out.
+        unsigned int const level = get_level();
+        unsigned int const tiled = level + std::max(2u, k + 2 > level ? k + 2 - level : 0u);
+
+        NodeId next = result(tile(m_root, tiled));
+        while(m_nodes[next].level > level)
+        {
+            next = m_nodes[next].nw;
+        }
+        m_root = next;
+    }
+    else
+    {
+        //Pad the pattern until it is in the centre quarter with room to grow for 2^k generations.
+        while(get_level() < k + 2 || !is_centred(m_root))
+        {
+            m_root = expand(m_root);
+        }
+        m_root = result(expand(m_root));
+    }
+
+    m_generation += std::uint64_t(1) << k;
+
+    maybe_collect_garbage();
+}
+
+
+/**
+ * HashLife::advance(steps)
+ *
+ * Advance the universe by any number of generations, one HashLife::advance_pow2(k) for each set bit of steps.
+ *
+ * @example
+ *
+ *      // Advance by a billion generations in 30 steps of the algorithm
+ *      life.advance(1000000000);
+ *
+ * @param steps
+ *      The number of generations to advance.
+ */
+void HashLife::advance(std::uint64_t steps)
+{
+    for(unsigned int k = 0; steps != 0; k++, steps >>= 1)
+    {
+        if(steps & 1)
+        {
+            advance_pow2(k);
+        }
+    }
+}
+
+
+/**
+ * HashLife::collect_garbage()
+ *
+ * Free every node that is no longer reachable from the universe. Memoized results that point at freed
+ * nodes are forgotten and recomputed if needed.
+ */
+void HashLife::collect_garbage()
+{
+    mark(m_root);
+    for(NodeId id : m_empty)
+    {
+        mark(id);
+    }
+    m_nodes[0].marked = m_nodes[1].marked = true;
+
+    m_free.clear();
+    for(NodeId id = 0; id < m_nodes.size(); id++)
+    {
+        Node & node = m_nodes[id];
+
+        if(!node.marked)
+        {
+            node.level = 0xFF;
+            node.result = NO_NODE;
+            m_free.push_back(id);
+        }
+        else if(node.result != NO_NODE && !m_nodes[node.result].marked)
+        {
+            node.result = NO_NODE;
+        }
+    }
+
+    for(Node & node : m_nodes)
+    {
+        node.marked = false;
+    }
+
+    rehash(m_table.size());
+    m_gc_threshold = std::max<std::size_t>(HASHLIFE_MIN_GC_THRESHOLD, 2 * get_node_count());
+}
+
+
+/**
+ * HashLife::make_node(nw, ne, sw, se)
+ *
+ * Private helper returning the unique node with the given children, creating it if it does not exist.
+ */
+HashLife::NodeId HashLife::make_node(NodeId nw, NodeId ne, NodeId sw, NodeId se)
+{
+    std::size_t const mask = m_table.size() - 1;
+
+    for(std::size_t slot = hash_children(nw, ne, sw, se) & mask; m_table[slot] != NO_NODE; slot = (slot + 1) & mask)
+    {
+        Node const & node = m_nodes[m_table[slot]];
+        if(node.nw == nw && node.ne == ne && node.sw == sw && node.se == se)
+        {
+            return m_table[slot];
+        }
+    }
+
+    Node node = { nw, ne, sw, se, NO_NODE,
+                  m_nodes[nw].population + m_nodes[ne].population + m_nodes[sw].population + m_nodes[se].population,
+                  std::uint8_t(m_nodes[nw].level + 1), false };
+
+    NodeId id;
+    if(!m_free.empty())
+    {
+        id = m_free.back();
+        m_free.pop_back();
+        m_nodes[id] = node;
+    }
+    else
+    {
+        id = (NodeId)m_nodes.size();
+        m_nodes.push_back(node);
+    }
+
+    insert(id);
+    return id;
+}
+
+
+/**
+ * HashLife::empty(level)
+ *
+ * Private helper returning the dead node of a level.
+ */
+HashLife::NodeId HashLife::empty(unsigned int level)
+{
+    while(m_empty.size() <= level)
+    {
+        NodeId const below = m_empty.back();
+        m_empty.push_back(make_node(below, below, below, below));
+    }
+    return m_empty[level];
+}
+
+
+/**
+ * HashLife::expand(node)
+ *
+ * Private helper returning a node one level up with the given node in its centre and dead cells around it.
+ */
+HashLife::NodeId HashLife::expand(NodeId node)
+{
+    Node const n = m_nodes[node];
+    NodeId const e = empty(n.level - 1);
+
+    NodeId const nw = make_node(e, e, e, n.nw);
+    NodeId const ne = make_node(e, e, n.ne, e);
+    NodeId const sw = make_node(e, n.sw, e, e);
+    NodeId const se = make_node(n.se, e, e, e);
+
+    return make_node(nw, ne, sw, se);
+}
+
+
+/**
+ * HashLife::centre(node)
+ *
+ * Private helper returning the centre half of a node, one level down, without advancing it.
+ */
+HashLife::NodeId HashLife::centre(NodeId node)
+{
+    Node const n = m_nodes[node];
+    return make_node(m_nodes[n.nw].se, m_nodes[n.ne].sw, m_nodes[n.sw].ne, m_nodes[n.se].nw);
+}
+
+
+/**
+ * HashLife::tile(node, level)
+ *
+ * Private helper returning a node of the given level tiled with copies of node, which must not be above it.
+ */
+HashLife::NodeId HashLife::tile(NodeId node, unsigned int level)
+{
+    while(m_nodes[node].level < level)
+    {
+        node = make_node(node, node, node, node);
+    }
+    return node;
+}
+
+
+/**
+ * HashLife::is_centred(node)
+ *
+ * Private helper checking that every alive cell of a node is inside its centre half.
+ */
+bool HashLife::is_centred(NodeId node) const
+{
+    Node const & n = m_nodes[node];
+    if(n.level < 2)
+    {
+        return n.population == 0;
+    }
+
+    Node const & nw = m_nodes[n.nw];
+    Node const & ne = m_nodes[n.ne];
+    Node const & sw = m_nodes[n.sw];
+    Node const & se = m_nodes[n.se];
+
+    return m_nodes[nw.se].population + m_nodes[ne.sw].population
+         + m_nodes[sw.ne].population + m_nodes[se.nw].population == n.population;
+}
+
+
+/**
+ * HashLife::step_level2(node)
+ *
+ * Private helper advancing the centre 2x2 cells of a 4x4 node by one generation.
+ */
+HashLife::NodeId HashLife::step_level2(NodeId node)
+{
+    //Gather the 16 cells, bit (y * 4 + x).
+    unsigned int cells = 0;
+    NodeId const quarters[4] = { m_nodes[node].nw, m_nodes[node].ne, m_nodes[node].sw, m_nodes[node].se };
+
+    for(unsigned int q = 0; q < 4; q++)
+    {
+        Node const & quarter = m_nodes[quarters[q]];
+        unsigned int const x = (q & 1) * 2;
+        unsigned int const y = (q >> 1) * 2;
+
+        cells |= (quarter.nw << (y * 4 + x)) | (quarter.ne << (y * 4 + x + 1))
+               | (quarter.sw << ((y + 1) * 4 + x)) | (quarter.se << ((y + 1) * 4 + x + 1));
+    }
+
+    NodeId next[4];
+    for(unsigned int i = 0; i < 4; i++)
+    {
+        unsigned int const x = 1 + (i & 1);
+        unsigned int const y = 1 + (i >> 1);
+
+        unsigned int count = 0;
+        for(unsigned int dy = y - 1; dy <= y + 1; dy++)
+        {
+            for(unsigned int dx = x - 1; dx <= x + 1; dx++)
+            {
+                count += (cells >> (dy * 4 + dx)) & 1;
+            }
+        }
+
+        unsigned int const alive = (cells >> (y * 4 + x)) & 1;
+        count -= alive;
+
+        next[i] = (count == 3 || (count == 2 && alive)) ? 1 : 0;
+    }
+
+    return make_node(next[0], next[1], next[2], next[3]);
+}
+
+
+/**
+ * HashLife::result(node)
+ *
+ * Private helper returning the centre half of a node of level 2 or above advanced by 2^min(m_result_log2, level - 2)
+ * generations. Results are memoized in the node.
+ */
+HashLife::NodeId HashLife::result(NodeId node)
+{
+    if(m_nodes[node].result != NO_NODE)
+    {
+        return m_nodes[node].result;
+    }
+
+    Node const n = m_nodes[node];
+    NodeId next;
+
+    if(n.population == 0)
+    {
+        next = empty(n.level - 1);
+    }
+    else if(n.level == 2)
+    {
+        next = step_level2(node);
+    }
+    else
+    {
+        Node const nw = m_nodes[n.nw];
+        Node const ne = m_nodes[n.ne];
+        Node const sw = m_nodes[n.sw];
+        Node const se = m_nodes[n.se];
+
+        //The nine overlapping squares of half the size, in rows.
+        NodeId const squares[9] = {
+            n.nw,                                   make_node(nw.ne, ne.nw, nw.se, ne.sw),  n.ne,
+            make_node(nw.sw, nw.se, sw.nw, sw.ne),  make_node(nw.se, ne.sw, sw.ne, se.nw),  make_node(ne.sw, ne.se, se.nw, se.ne),
+            n.sw,                                   make_node(sw.ne, se.nw, sw.se, se.sw),  n.se
+        };
+
+        //At full speed the squares are advanced by half the step, otherwise the whole step is taken below.
+        bool const full_speed = (n.level <= m_result_log2 + 2);
+
+        NodeId inner[9];
+        for(unsigned int i = 0; i < 9; i++)
+        {
+            inner[i] = full_speed ? result(squares[i]) : centre(squares[i]);
+        }
+
+        NodeId const quad_nw = make_node(inner[0], inner[1], inner[3], inner[4]);
+        NodeId const quad_ne = make_node(inner[1], inner[2], inner[4], inner[5]);
+        NodeId const quad_sw = make_node(inner[3], inner[4], inner[6], inner[7]);
+        NodeId const quad_se = make_node(inner[4], inner[5], inner[7], inner[8]);
+
+        next = make_node(result(quad_nw), result(quad_ne), result(quad_sw), result(quad_se));
+    }
+
+    m_nodes[node].result = next;
+    return next;
+}
+
+
+/**
+ * HashLife::build(grid, level, x0, y0)
+ *
+ * Private helper returning the node of the given level whose top left cell is at (x0, y0) in the grid's coordinates.
+ */
+HashLife::NodeId HashLife::build(Grid const & grid, unsigned int level, std::int64_t x0, std::int64_t y0)
+{
+    std::int64_t const side = std::int64_t(1) << level;
+
+    if(x0 >= grid.get_width() || y0 >= grid.get_height() || x0 + side <= 0 || y0 + side <= 0)
+    {
+        return empty(level);
+    }
+    else if(level == 0)
+    {
+        return grid.get((unsigned int)x0, (unsigned int)y0) == Cell::ALIVE ? 1 : 0;
+    }
+
+    std::int64_t const half = side / 2;
+    NodeId const nw = build(grid, level - 1, x0, y0);
+    NodeId const ne = build(grid, level - 1, x0 + half, y0);
+    NodeId const sw = build(grid, level - 1, x0, y0 + half);
+    NodeId const se = build(grid, level - 1, x0 + half, y0 + half);
+
+    return make_node(nw, ne, sw, se);
+}
+
+
+/**
+ * HashLife::set_cell(node, x, y, value)
+ *
+ * Private helper returning a copy of node with the cell at (x, y), relative to its top left corner, changed.
+ */
+HashLife::NodeId HashLife::set_cell(NodeId node, std::int64_t x, std::int64_t y, Cell value)
+{
+    Node const n = m_nodes[node];
+    if(n.level == 0)
+    {
+        return value == Cell::ALIVE ? 1 : 0;
+    }
+
+    std::int64_t const half = std::int64_t(1) << (n.level - 1);
+    bool const east = x >= half;
+    bool const south = y >= half;
+    x -= east ? half : 0;
+    y -= south ? half : 0;
+
+    if(!east && !south)
+    {
+        return make_node(set_cell(n.nw, x, y, value), n.ne, n.sw, n.se);
+    }
+    else if(east && !south)
+    {
+        return make_node(n.nw, set_cell(n.ne, x, y, value), n.sw, n.se);
+    }
+    else if(!east && south)
+    {
+        return make_node(n.nw, n.ne, set_cell(n.sw, x, y, value), n.se);
+    }
+    return make_node(n.nw, n.ne, n.sw, set_cell(n.se, x, y, value));
+}
+
+
+/**
+ * HashLife::get_cell(node, x, y)
+ *
+ * Private helper reading the cell at (x, y) relative to the top left corner of a node.
+ */
+Cell HashLife::get_cell(NodeId node, std::int64_t x, std::int64_t y) const
+{
+    while(m_nodes[node].level > 0)
+    {
+        Node const & n = m_nodes[node];
+        if(n.population == 0)
+        {
+            return Cell::DEAD;
+        }
+
+        std::int64_t const half = std::int64_t(1) << (n.level - 1);
+        bool const east = x >= half;
+        bool const south = y >= half;
+        x -= east ? half : 0;
+        y -= south ? half : 0;
+
+        node = south ? (east ? n.se : n.sw) : (east ? n.ne : n.nw);
+    }
+    return node == 1 ? Cell::ALIVE : Cell::DEAD;
+}
+
+
+/**
+ * HashLife::draw(node, x0, y0, grid, gx, gy)
+ *
+ * Private helper copying the alive cells of a node whose top left cell is at (x0, y0) into a grid
+ * whose top left cell is at (gx, gy). Dead nodes and nodes outside the grid are skipped.
+ */
+void HashLife::draw(NodeId node, std::int64_t x0, std::int64_t y0, Grid & grid, std::int64_t gx, std::int64_t gy) const
+{
+    Node const & n = m_nodes[node];
+    std::int64_t const side = std::int64_t(1) << n.level;
+
+    if(n.population == 0 || x0 >= gx + grid.get_width() || y0 >= gy + grid.get_height()
+       || x0 + side <= gx || y0 + side <= gy)
+    {
+        return;
+    }
+    else if(n.level == 0)
+    {
+        grid.set((unsigned int)(x0 - gx), (unsigned int)(y0 - gy), Cell::ALIVE);
+        return;
+    }
+
+    std::int64_t const half = side / 2;
+    draw(n.nw, x0, y0, grid, gx, gy);
+    draw(n.ne, x0 + half, y0, grid, gx, gy);
+    draw(n.sw, x0, y0 + half, grid, gx, gy);
+    draw(n.se, x0 + half, y0 + half, grid, gx, gy);
+}
+
+
+/**
+ * HashLife::set_result_log2(step_log2)
+ *
+ * Private helper choosing the step memoized results are for. Nodes of level up to min(old, new) + 2 advance
+ * by 2^(level - 2) either way and keep their results, larger nodes forget theirs.
+ */
+void HashLife::set_result_log2(unsigned int step_log2)
+{
+    if(step_log2 == m_result_log2)
+    {
+        return;
+    }
+
+    unsigned int const kept = std::min(step_log2, m_result_log2) + 2;
+    for(Node & node : m_nodes)
+    {
+        if(node.level > kept)
+        {
+            node.result = NO_NODE;
+        }
+    }
+    m_result_log2 = step_log2;
+}
+
+
+/**
+ * HashLife::rehash(size)
+ *
+ * Private helper rebuilding the hash table of every live node with at least the given power of two number of slots.
+ */
+void HashLife::rehash(std::size_t size)
+{
+    std::size_t const live = get_node_count();
+    while(2 * live > size)
+    {
+        size *= 2;
+    }
+
+    m_table.assign(size, NO_NODE);
+    m_table_used = 0;
+
+    for(NodeId id = 2; id < m_nodes.size(); id++)
+    {
+        if(m_nodes[id].level != 0xFF)
+        {
+            insert_slot(id);
+        }
+    }
+}
+
+
+/**
+ * HashLife::insert(id)
+ *
+ * Private helper adding a new node to the hash table, growing the table to keep it at most half full.
+ */
+void HashLife::insert(NodeId id)
+{
+    if(2 * (m_table_used + 1) > m_table.size())
+    {
+        //The node is already in m_nodes, so rebuilding the table adds it.
+        rehash(2 * m_table.size());
+        return;
+    }
+
+    insert_slot(id);
+}
+
+
+/**
+ * HashLife::insert_slot(id)
+ *
+ * Private helper putting a node in the first free slot of its probe sequence.
+ */
+void HashLife::insert_slot(NodeId id)
+{
+    Node const & node = m_nodes[id];
+    std::size_t const mask = m_table.size() - 1;
+
+    std::size_t slot = hash_children(node.nw, node.ne, node.sw, node.se) & mask;
+    while(m_table[slot] != NO_NODE)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    m_table[slot] = id;
+    m_table_used++;
+}
+
+
+/**
+ * HashLife::mark(node)
+ *
+ * Private helper marking a node and everything below it as reachable.
+ */
+void HashLife::mark(NodeId node)
+{
+    Node & n = m_nodes[node];
+    if(n.marked)
+    {
+        return;
+    }
+
+    n.marked = true;
+    if(n.level > 0)
+    {
+        mark(n.nw);
+        mark(n.ne);
+        mark(n.sw);
+        mark(n.se);
+    }
+}
+
+
+/**
+ * HashLife::maybe_collect_garbage()
+ *
+ * Private helper collecting garbage once enough nodes have been allocated since the last collection.
+ */
+void HashLife::maybe_collect_garbage()
+{
+    if(get_node_count() > m_gc_threshold)
+    {
+        collect_garbage();
+    }
+}
@@ -0,0 +1,98 @@
+/**
+ * Declares a HashLife universe for advancing patterns by huge numbers of generations.
+ * Rich documentation for the api and behaviour the HashLife class can be found in hashlife.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "grid.h"
+
+/**
+ * Declare the structure of the HashLife class.
+ *
+ * The universe is a quadtree whose nodes are hash-consed, every distinct square of cells is stored once
+ * and referred to by index. Each node remembers its future, so repeated structure in space and in time
+ * is only ever computed once.
+ */
+class HashLife {
+
+private:
+
+    typedef std::uint32_t NodeId;
+
+    /**
+     * A square of 2^level x 2^level cells. Level 0 nodes are single cells and have no children.
+     */
+    struct Node {
+        NodeId nw, ne, sw, se;
+        NodeId result;              //The centre half advanced by 2^min(m_result_log2, level - 2) generations, or NO_NODE.
+        std::uint64_t population;
+        std::uint8_t level;
+        bool marked;                //Used by the garbage collector, false outside of a collection.
+    };
+
+    static NodeId const NO_NODE = 0xFFFFFFFFu;
+
+    std::vector<Node> m_nodes;
+    std::vector<NodeId> m_free;         //Indices of collected nodes, reused before m_nodes grows.
+    std::vector<NodeId> m_table;        //Open addressing hash table of every live node with children.
+    std::size_t m_table_used;
+
+    std::vector<NodeId> m_empty;        //The dead node of each level.
+
+    NodeId m_root;
+    bool m_toroidal;
+    unsigned int m_width, m_height;     //The grid the universe was built from.
+    std::uint64_t m_generation;
+
+    unsigned int m_result_log2;         //The step every memoized result in m_nodes is for.
+    std::size_t m_gc_threshold;         //Collect garbage when this many nodes are allocated.
+
+    NodeId make_node(NodeId nw, NodeId ne, NodeId sw, NodeId se);
+    NodeId empty(unsigned int level);
+    NodeId expand(NodeId node);
+    NodeId centre(NodeId node);
+    NodeId tile(NodeId node, unsigned int level);
+    NodeId step_level2(NodeId node);
+    NodeId result(NodeId node);
+    NodeId build(Grid const & grid, unsigned int level, std::int64_t x0, std::int64_t y0);
+    NodeId set_cell(NodeId node, std::int64_t x, std::int64_t y, Cell value);
+
+    Cell get_cell(NodeId node, std::int64_t x, std::int64_t y) const;
+    void draw(NodeId node, std::int64_t x0, std::int64_t y0, Grid & grid, std::int64_t gx, std::int64_t gy) const;
+
+    bool is_centred(NodeId node) const;
+    void set_result_log2(unsigned int step_log2);
+    void rehash(std::size_t size);
+    void insert(NodeId id);
+    void insert_slot(NodeId id);
+    void mark(NodeId node);
+    void maybe_collect_garbage();
+
+public:
+
+    HashLife();
+    explicit HashLife(Grid const & initial_state, bool toroidal = false);
+
+    bool is_toroidal() const;
+    unsigned int get_level() const;
+    std::uint64_t get_generation() const;
+    std::uint64_t get_population() const;
+    std::size_t get_node_count() const;
+
+    Cell get(std::int64_t x, std::int64_t y) const;
+    void set(std::int64_t x, std::int64_t y, Cell value);
+
+    Grid to_grid() const;
+    Grid to_grid(std::int64_t x0, std::int64_t y0, unsigned int width, unsigned int height) const;
+
+    void advance_pow2(unsigned int k);
+    void advance(std::uint64_t steps);
+
+    void collect_garbage();
+};
@@ -0,0 +1,621 @@
+/**
+ * Implements a world for Larger than Life rules, life-like rules on a range R Moore neighbourhood.
+ *
+ *      - A Larger than Life rule counts the alive cells in the (2R+1)x(2R+1) square around each cell, R from 1 to 10.
+ *          - https://conwaylife.com/wiki/Larger_than_Life
+ *          - A dead cell is born if the count is in the birth range, an alive cell survives if it is in the survival range.
+ *          - With M1 the square includes the cell itself, with M0 it does not.
+ *          - Rules are written in Golly's notation, for example Bosco's rule R5,C0,M1,S34..58,B34..45,NM.
+ *            Only two state (C0 or C2) rules on the Moore (NM) neighbourhood are supported.
+ *          - R1,C0,M0,S2..3,B3..3,NM is Conway's Game of Life.
+ *
+ *      - Counting every cell of the square would cost (2R+1)^2 per cell, 441 at R10. Instead counts are running sums.
+ *          - Each column keeps the sum of its 2R+1 cells around the current row. Moving down a row adds the row
+ *            entering the square and subtracts the row leaving it, a loop over the row with no dependencies
+ *            that has an AVX2 kernel, picked at runtime from active_simd_level().
+ *          - Along the row the count slides over 2R+1 column sums the same way, adding the column entering
+ *            and subtracting the column leaving.
+ *          - So a step costs a handful of adds per cell whatever the range, and the scratch is one row of sums.
+ *          - The birth and survival ranges are looked up in a table by count, so the loop over cells has no branches.
+ *
+ *      - Cells beyond the edge of a bounded world are dead. On a torus the square wraps around the edges.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#include "larger_than_life.h"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+#include "cpu_features.h"
+
+#if SIMD_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * LargerThanLifeRule::LargerThanLifeRule()
+ *
+ * Construct Conway's Game of Life as a range 1 rule, R1,C0,M0,S2..3,B3..3,NM.
+ */
+LargerThanLifeRule::LargerThanLifeRule()
+    : LargerThanLifeRule(1, 3, 3, 2, 3, false)
+{
+
+}
+
+
+/**
+ * LargerThanLifeRule::LargerThanLifeRule(range, birth_min, birth_max, survival_min, survival_max, middle)
+ *
+ * Construct a Larger than Life rule.
+ *
+ * @example
+ *
+ *      // Bosco's rule
+ *      LargerThanLifeRule bosco(5, 34, 45, 34, 58, true);
+ *
+ * @param range
+ *      The range R of the neighbourhood, 1 to LTL_MAX_RANGE.
+ *
+ * @param birth_min, birth_max
+ *      The counts a dead cell is born on, inclusive.
+ *
+ * @param survival_min, survival_max
+ *      The counts an alive cell survives on, inclusive.
+ *
+ * @param middle
+ *      If true a cell counts itself.
+ *
+ * @throws
+ *      std::invalid_argument if the range is out of range, or a count range is empty or larger than the neighbourhood.
+ */
+LargerThanLifeRule::LargerThanLifeRule(unsigned int range, unsigned int birth_min, unsigned int birth_max,
+                                       unsigned int survival_min, unsigned int survival_max, bool middle)
+    : m_range(range), m_birth_min(birth_min), m_birth_max(birth_max),
+      m_survival_min(survival_min), m_survival_max(survival_max), m_middle(middle)
+{
+    if(range < 1 || range > LTL_MAX_RANGE)
+    {
+        throw std::invalid_argument("Larger than Life ranges must be 1 to " + std::to_string(LTL_MAX_RANGE));
+    }
+
+    unsigned int const cells = (2 * range + 1) * (2 * range + 1);
+
+    if(birth_min > birth_max || survival_min > survival_max || birth_max > cells || survival_max > cells)
+    {
+        throw std::invalid_argument("Larger than Life count ranges must be ordered and fit the neighbourhood");
+    }
+}
+
+
+/**
+ * read_count(text, i)
+ *
+ * Read the decimal number at text[i], moving i past it.
+ */
+static unsigned int read_count(std::string const & text, std::size_t & i)
+{
+    std::size_t const start = i;
+    unsigned int value = 0;
+
+    while(i < text.size() && std::isdigit((unsigned char)text[i]) && i - start < 4)
+    {
+        value = value * 10 + (unsigned int)(text[i] - '0');
+        i++;
+    }
+
+    if(i == start)
+    {
+        throw std::invalid_argument("Expected a number in Larger than Life rulestring: " + text);
+    }
+
+    return value;
+}
+
+
+/**
+ * LargerThanLifeRule::parse(rulestring)
+ *
+ * Read a Larger than Life rule in Golly's notation.
+ *
+ * @example
+ *
+ *      LargerThanLifeRule bosco = LargerThanLifeRule::parse("R5,C0,M1,S34..58,B34..45,NM");
+ *
+ * @param rulestring
+ *      Comma separated fields R<range>, C<states>, M<0 or 1>, S<min>..<max>, B<min>..<max> and N<neighbourhood>,
+ *      in any order and any case. R, S and B are required, C defaults to 0, M to 0 and N to M.
+ *
+ * @return
+ *      The rule.
+ *
+ * @throws
+ *      std::invalid_argument if the rulestring is malformed, has more than two states or a neighbourhood other than Moore.
+ */
+LargerThanLifeRule LargerThanLifeRule::parse(std::string const & rulestring)
+{
+    std::string text(rulestring);
+    std::transform(text.begin(), text.end(), text.begin(), [](char c) { return (char)std::toupper((unsigned char)c); });
+
+    bool has_range = false, has_birth = false, has_survival = false;
+    unsigned int range = 0, birth[2] = { 0, 0 }, survival[2] = { 0, 0 };
+    bool middle = false;
+
+    std::size_t i = 0;
+
+    while(i < text.size())
+    {
+        char const field = text[i++];
+
+        if(field == 'R')
+        {
+            range = read_count(text, i);
+            has_range = true;
+        }
+        else if(field == 'C')
+        {
+            if(read_count(text, i) > 2)
+            {
+                throw std::invalid_argument("Only two state Larger than Life rules are supported: " + rulestring);
+            }
+        }
+        else if(field == 'M')
+        {
+            unsigned int const m = read_count(text, i);
+            if(m > 1)
+            {
+                throw std::invalid_argument("M must be 0 or 1 in Larger than Life rulestring: " + rulestring);
+            }
+            middle = (m == 1);
+        }
+        else if(field == 'S' || field == 'B')
+        {
+            unsigned int * const bounds = (field == 'S') ? survival : birth;
+
+            bounds[0] = read_count(text, i);
+            if(text.compare(i, 2, "..") != 0)
+            {
+                throw std::invalid_argument("Expected min..max in Larger than Life rulestring: " + rulestring);
+            }
+            i += 2;
+            bounds[1] = read_count(text, i);
+
+            (field == 'S' ? has_survival : has_birth) = true;
+        }
+        else if(field == 'N')
+        {
+            if(i >= text.size() || text[i] != 'M')
+            {
+                throw std::invalid_argument("Only the Moore neighbourhood is supported: " + rulestring);
+            }
+            i++;
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown field in Larger than Life rulestring: " + rulestring);
+        }
+
+        if(i < text.size())
+        {
+            if(text[i] != ',')
+            {
+                throw std::invalid_argument("Expected ',' in Larger than Life rulestring: " + rulestring);
+            }
+            i++;
+        }
+    }
+
+    if(!has_range || !has_birth || !has_survival)
+    {
+        throw std::invalid_argument("Larger than Life rulestrings need R, S and B: " + rulestring);
+    }
+
+    return LargerThanLifeRule(range, birth[0], birth[1], survival[0], survival[1], middle);
+}
+
+
+/**
+ * LargerThanLifeRule::bosco()
+ *
+ * Bosco's rule, R5,C0,M1,S34..58,B34..45,NM, which has a spaceship, Bosco.
+ */
+LargerThanLifeRule LargerThanLifeRule::bosco() { return LargerThanLifeRule(5, 34, 45, 34, 58, true); }
+
+
+/**
+ * LargerThanLifeRule::get_range()
+ *
+ * Gets the range R, the neighbourhood is the (2R+1)x(2R+1) square around a cell.
+ */
+unsigned int LargerThanLifeRule::get_range() const { return m_range; }
+
+
+/**
+ * LargerThanLifeRule::get_birth_min()
+ */
+unsigned int LargerThanLifeRule::get_birth_min() const { return m_birth_min; }
+
+
+/**
+ * LargerThanLifeRule::get_birth_max()
+ */
+unsigned int LargerThanLifeRule::get_birth_max() const { return m_birth_max; }
+
+
+/**
+ * LargerThanLifeRule::get_survival_min()
+ */
+unsigned int LargerThanLifeRule::get_survival_min() const { return m_survival_min; }
+
+
+/**
+ * LargerThanLifeRule::get_survival_max()
+ */
+unsigned int LargerThanLifeRule::get_survival_max() const { return m_survival_max; }
+
+
+/**
+ * LargerThanLifeRule::includes_middle()
+ *
+ * Gets whether a cell counts itself.
+ */
+bool LargerThanLifeRule::includes_middle() const { return m_middle; }
+
+
+/**
+ * LargerThanLifeRule::births(count)
+ *
+ * Gets whether a dead cell whose neighbourhood has count alive cells is born.
+ */
+bool LargerThanLifeRule::births(unsigned int count) const
+{
+    return count >= m_birth_min && count <= m_birth_max;
+}
+
+
+/**
+ * LargerThanLifeRule::survives(count)
+ *
+ * Gets whether an alive cell whose neighbourhood has count alive cells survives.
+ */
+bool LargerThanLifeRule::survives(unsigned int count) const
+{
+    return count >= m_survival_min && count <= m_survival_max;
+}
+
+
+/**
+ * LargerThanLifeRule::to_string()
+ *
+ * The rule in Golly's notation, for example "R5,C0,M1,S34..58,B34..45,NM".
+ */
+std::string LargerThanLifeRule::to_string() const
+{
+    return "R" + std::to_string(m_range) + ",C0,M" + (m_middle ? "1" : "0")
+         + ",S" + std::to_string(m_survival_min) + ".." + std::to_string(m_survival_max)
+         + ",B" + std::to_string(m_birth_min) + ".." + std::to_string(m_birth_max) + ",NM";
+}
+
+
+/**
+ * LargerThanLifeRule::operator==(other)
+ */
+bool LargerThanLifeRule::operator==(LargerThanLifeRule const & other) const
+{
+    return m_range == other.m_range && m_middle == other.m_middle
+        && m_birth_min == other.m_birth_min && m_birth_max == other.m_birth_max
+        && m_survival_min == other.m_survival_min && m_survival_max == other.m_survival_max;
+}
+
+
+/**
+ * LargerThanLifeRule::operator!=(other)
+ */
+bool LargerThanLifeRule::operator!=(LargerThanLifeRule const & other) const
+{
+    return !(*this == other);
+}
+
+
+/**
+ * LargerThanLifeWorld::LargerThanLifeWorld()
+ *
+ * Construct an empty 0x0 world of Conway's Game of Life as a range 1 rule.
+ */
+LargerThanLifeWorld::LargerThanLifeWorld()
+    : LargerThanLifeWorld(Grid(), LargerThanLifeRule())
+{
+
+}
+
+
+/**
+ * LargerThanLifeWorld::LargerThanLifeWorld(width, height, rule)
+ *
+ * Construct a world of dead cells.
+ */
+LargerThanLifeWorld::LargerThanLifeWorld(unsigned int width, unsigned int height, LargerThanLifeRule const & rule)
+    : LargerThanLifeWorld(Grid(width, height), rule)
+{
+
+}
+
+
+/**
+ * LargerThanLifeWorld::LargerThanLifeWorld(initial_state, rule)
+ *
+ * Construct a world starting from a grid of cells.
+ *
+ * @example
+ *
+ *      // Run Bosco's rule on a random soup
+ *      LargerThanLifeWorld world(soup, LargerThanLifeRule::bosco());
+ *      world.advance(100, true);
+ *
+ * @param initial_state
+ *      The cells of the first generation.
+ *
+ * @param rule
+ *      The Larger than Life rule the world steps with.
+ */
+LargerThanLifeWorld::LargerThanLifeWorld(Grid const & initial_state, LargerThanLifeRule const & rule)
+    : m_state(initial_state), m_next(initial_state.get_width(), initial_state.get_height())
+{
+    set_rule(rule);
+}
+
+
+/**
+ * LargerThanLifeWorld::get_width()
+ *
+ * Gets the width of the world.
+ */
+unsigned int const & LargerThanLifeWorld::get_width() const { return m_state.get_width(); }
+
+
+/**
+ * LargerThanLifeWorld::get_height()
+ *
+ * Gets the height of the world.
+ */
+unsigned int const & LargerThanLifeWorld::get_height() const { return m_state.get_height(); }
+
+
+/**
+ * LargerThanLifeWorld::get_alive_cells()
+ *
+ * Gets the number of alive cells.
+ */
+unsigned int LargerThanLifeWorld::get_alive_cells() const { return m_state.get_alive_cells(); }
+
+
+/**
+ * LargerThanLifeWorld::get_rule()
+ *
+ * Gets the rule the world steps with.
+ */
+LargerThanLifeRule const & LargerThanLifeWorld::get_rule() const { return m_rule; }
+
+
+/**
+ * LargerThanLifeWorld::set_rule(rule)
+ *
+ * Sets the rule the world steps with from the next step on.
+ */
+void LargerThanLifeWorld::set_rule(LargerThanLifeRule const & rule)
+{
+    unsigned int const side = 2 * rule.get_range() + 1;
+
+    m_rule = rule;
+    m_table.assign(2 * (side * side + 1), Cell::DEAD);
+
+    //The step counts the square including the middle, so rules without it take the cell's own count off first.
+    for(unsigned int count = 0; count <= side * side; count++)
+    {
+        bool const born = rule.births(count);
+        bool const kept = count >= 1 && rule.survives(rule.includes_middle() ? count : count - 1);
+        m_table[2 * count] = born ? Cell::ALIVE : Cell::DEAD;
+        m_table[2 * count + 1] = kept ? Cell::ALIVE : Cell::DEAD;
+    }
+}
+
+
+/**
+ * LargerThanLifeWorld::get_state()
+ *
+ * Gets the cells of the current generation.
+ */
+Grid & LargerThanLifeWorld::get_state() { return m_state; }
+
+
+/**
+ * LargerThanLifeWorld::get_state()
+ *
+ * Gets the cells of the current generation.
+ */
+Grid const & LargerThanLifeWorld::get_state() const { return m_state; }
+
+
+/**
+ * slide_columns(entering, leaving, columns, width)
+ *
+ * The portable scalar kernel moving column sums down a row, adding the alive cells of the entering row
+ * and subtracting those of the leaving row.
+ */
+static void slide_columns(Cell const * entering, Cell const * leaving, std::uint16_t * columns, unsigned int width)
+{
+    for(unsigned int x = 0; x < width; x++)
+    {
+        columns[x] = std::uint16_t(columns[x] + (entering[x] == Cell::ALIVE) - (leaving[x] == Cell::ALIVE));
+    }
+}
+
+#if SIMD_X86
+
+/**
+ * slide_columns_avx2(entering, leaving, columns, width)
+ *
+ * slide_columns on 16 cells at a time.
+ */
+TARGET_AVX2
+static void slide_columns_avx2(Cell const * entering, Cell const * leaving, std::uint16_t * columns, unsigned int width)
+{
+    __m128i const alive = _mm_set1_epi8(char(Cell::ALIVE));
+    unsigned int x = 0;
+
+    for(; x + 16 <= width; x += 16)
+    {
+        //Compares give -1 for alive cells, so leaving minus entering is the change, -1, 0 or 1.
+        __m128i const in = _mm_cmpeq_epi8(_mm_loadu_si128((__m128i const *)(entering + x)), alive);
+        __m128i const out = _mm_cmpeq_epi8(_mm_loadu_si128((__m128i const *)(leaving + x)), alive);
+        __m256i const change = _mm256_cvtepi8_epi16(_mm_sub_epi8(out, in));
+
+        __m256i const sums = _mm256_loadu_si256((__m256i const *)(columns + x));
+        _mm256_storeu_si256((__m256i *)(columns + x), _mm256_add_epi16(sums, change));
+    }
+
+    slide_columns(entering + x, leaving + x, columns + x, width - x);
+}
+
+#endif
+
+
+/**
+ * LargerThanLifeWorld::add_row(y, toroidal, sign)
+ *
+ * Add (sign 1) or subtract (sign -1) the alive cells of row y to the column sums. Rows above and below a bounded
+ * world are dead, on a torus they wrap.
+ */
+void LargerThanLifeWorld::add_row(int y, bool toroidal, int sign)
+{
+    int const height = (int)get_height();
+
+    if(toroidal)
+    {
+        y = ((y % height) + height) % height;
+    }
+    else if(y < 0 || y >= height)
+    {
+        return;
+    }
+
+    unsigned int const width = get_width();
+    Cell const * cells = m_state.row((unsigned int)y);
+    std::uint16_t * columns = m_columns.data() + m_rule.get_range();
+    std::uint16_t const delta = std::uint16_t(sign);
+
+    for(unsigned int x = 0; x < width; x++)
+    {
+        columns[x] = std::uint16_t(columns[x] + delta * std::uint16_t(cells[x] == Cell::ALIVE));
+    }
+}
+
+
+/**
+ * LargerThanLifeWorld::step(toroidal)
+ *
+ * Take one step in the world's Larger than Life rule.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then the left edge wraps to the right edge and the top to the bottom. Defaults to false.
+ */
+void LargerThanLifeWorld::step(bool toroidal)
+{
+    unsigned int const width = get_width();
+    unsigned int const height = get_height();
+    unsigned int const range = m_rule.get_range();
+    unsigned int const side = 2 * range + 1;
+
+    if(width == 0 || height == 0)
+    {
+        return;
+    }
+
+    //R halo columns either side, and one more on the right for the slide past the last cell to read.
+    m_columns.assign(width + 2 * range + 1, 0);
+
+    for(int dy = -int(range); dy <= int(range); dy++)
+    {
+        add_row(dy, toroidal, 1);
+    }
+
+    Cell const * table = m_table.data();
+    std::uint16_t * columns = m_columns.data();
+
+    void (*slide)(Cell const *, Cell const *, std::uint16_t *, unsigned int) = slide_columns;
+
+#if SIMD_X86
+    if(active_simd_level() != SimdLevel::Scalar)
+    {
+        slide = slide_columns_avx2;
+    }
+#endif
+
+    for(unsigned int y = 0; y < height; y++)
+    {
+        Cell const * cells = m_state.row(y);
+        Cell * next = m_next.row(y);
+
+        //On a torus the halo columns are copies of the columns they wrap to, on a bounded world they stay 0.
+        if(toroidal)
+        {
+            for(unsigned int k = 1; k <= range; k++)
+            {
+                columns[range - k] = columns[range + (width - k % width) % width];
+                columns[range + width - 1 + k] = columns[range + (width - 1 + k) % width];
+            }
+        }
+
+        unsigned int count = 0;
+        for(unsigned int x = 0; x < side; x++)
+        {
+            count += columns[x];
+        }
+
+        //count covers columns x - R to x + R of rows y - R to y + R.
+        for(unsigned int x = 0; x < width; x++)
+        {
+            next[x] = table[2 * count + (cells[x] == Cell::ALIVE ? 1u : 0u)];
+            count += columns[x + side];
+            count -= columns[x];
+        }
+
+        //Slide the columns down a row. Near the top and bottom of a bounded world one of the rows is outside it.
+        int const enter = int(y + range + 1);
+        int const leave = int(y) - int(range);
+
+        if(y + 1 == height)
+        {
+            break;
+        }
+        else if(toroidal || (leave >= 0 && enter < int(height)))
+        {
+            slide(m_state.row(unsigned((enter % int(height) + int(height)) % int(height))),
+                  m_state.row(unsigned((leave % int(height) + int(height)) % int(height))), columns + range, width);
+        }
+        else
+        {
+            add_row(enter, toroidal, 1);
+            add_row(leave, toroidal, -1);
+        }
+    }
+
+    std::swap(m_state, m_next);
+}
+
+
+/**
+ * LargerThanLifeWorld::advance(steps, toroidal)
+ *
+ * Advance multiple steps in the world's Larger than Life rule.
+ */
+void LargerThanLifeWorld::advance(unsigned int steps, bool toroidal)
+{
+    for(unsigned int i = 0; i < steps; i++)
+    {
+        step(toroidal);
+    }
+}
@@ -0,0 +1,102 @@
+/**
+ * Declares a world for Larger than Life rules, life-like rules on a range R Moore neighbourhood.
+ * Rich documentation for the api and behaviour of the LargerThanLifeRule and LargerThanLifeWorld classes can be found in larger_than_life.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "grid.h"
+
+/**
+ * The largest neighbourhood range a Larger than Life rule can have, a 21x21 square of 441 cells.
+ */
+#define LTL_MAX_RANGE 10
+
+/**
+ * Declare the structure of the LargerThanLifeRule class.
+ *
+ * A cell is born if the alive cells in the (2R+1)x(2R+1) square around it are in [birth_min, birth_max], and
+ * survives if they are in [survival_min, survival_max]. The square counts the cell itself if the rule includes the middle.
+ * Written in Golly's notation, R5,C0,M1,S34..58,B34..45,NM.
+ */
+class LargerThanLifeRule {
+
+private:
+
+    unsigned int m_range;
+    unsigned int m_birth_min;
+    unsigned int m_birth_max;
+    unsigned int m_survival_min;
+    unsigned int m_survival_max;
+    bool m_middle;
+
+public:
+
+    LargerThanLifeRule();
+    LargerThanLifeRule(unsigned int range, unsigned int birth_min, unsigned int birth_max,
+                       unsigned int survival_min, unsigned int survival_max, bool middle);
+
+    static LargerThanLifeRule parse(std::string const & rulestring);
+
+    static LargerThanLifeRule bosco();
+
+    unsigned int get_range() const;
+    unsigned int get_birth_min() const;
+    unsigned int get_birth_max() const;
+    unsigned int get_survival_min() const;
+    unsigned int get_survival_max() const;
+    bool includes_middle() const;
+
+    bool births(unsigned int count) const;
+    bool survives(unsigned int count) const;
+
+    std::string to_string() const;
+
+    bool operator==(LargerThanLifeRule const & other) const;
+    bool operator!=(LargerThanLifeRule const & other) const;
+};
+
+/**
+ * Declare the structure of the LargerThanLifeWorld class.
+ *
+ * Cells are stored in a Grid. Neighbour counts come from running box sums, so a step costs the same per cell
+ * whatever the range.
+ */
+class LargerThanLifeWorld {
+
+private:
+
+    LargerThanLifeRule m_rule;
+    Grid m_state;
+    Grid m_next;
+
+    std::vector<Cell> m_table;              //The next state of a cell by 2 * (alive cells in its square) + (1 if it is alive).
+    std::vector<std::uint16_t> m_columns;   //Scratch, the alive cells of each column in rows y - R to y + R, with an R column halo.
+
+    void add_row(int y, bool toroidal, int sign);
+
+public:
+
+    LargerThanLifeWorld();
+    LargerThanLifeWorld(unsigned int width, unsigned int height, LargerThanLifeRule const & rule);
+    LargerThanLifeWorld(Grid const & initial_state, LargerThanLifeRule const & rule);
+
+    unsigned int const & get_width() const;
+    unsigned int const & get_height() const;
+    unsigned int get_alive_cells() const;
+
+    LargerThanLifeRule const & get_rule() const;
+    void set_rule(LargerThanLifeRule const & rule);
+
+    Grid & get_state();
+    Grid const & get_state() const;
+
+    void step(bool toroidal = false);
+    void advance(unsigned int steps, bool toroidal = false);
+};
@@ -0,0 +1,174 @@
+/**
+ * Implements a hardware performance counter for the benchmarks, on top of Linux perf events.
+ *
+ *      - A counter is opened disabled for the calling thread with inheritance, so threads started
+ *        after it is opened, such as a World's ThreadPool, are counted too.
+ *          - Counts from inherited threads are only added once those threads exit, so read the counter
+ *            after the World that owns them is destroyed.
+ *
+ *      - PerfCounter::start() resets and enables the counter, PerfCounter::stop() disables it.
+ *
+ *      - Perf events are often unavailable, in containers, virtual machines, on other operating systems
+ *        or when perf_event_paranoid forbids them. The counter then reports itself unavailable and every
+ *        call is a no-op, so benchmarks run everywhere and simply leave the column out.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#include "perf_counter.h"
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * to_string(event)
+ *
+ * A readable name for a hardware event.
+ */
+std::string to_string(PerfEvent event)
+{
+    switch(event)
+    {
+        case PerfEvent::Instructions:   return "instructions";
+        case PerfEvent::Branches:       return "branches";
+        default:                        return "branch misses";
+    }
+}
+
+
+/**
+ * PerfCounter::PerfCounter(event)
+ *
+ * Open a disabled counter for a hardware event.
+ *
+ * @example
+ *
+ *      // Count the branch misses of one step
+ *      PerfCounter misses(PerfEvent::BranchMisses);
+ *      misses.start();
+ *      world.step();
+ *      misses.stop();
+ *
+ *      if(misses.is_available())
+ *      {
+ *          std::cout << misses.read() << std::endl;
+ *      }
+ *
+ * @param event
+ *      The event to count.
+ */
+PerfCounter::PerfCounter(PerfEvent event)
+    : m_fd(-1)
+{
+#if defined(__linux__)
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    switch(event)
+    {
+        case PerfEvent::Instructions:   attr.config = PERF_COUNT_HW_INSTRUCTIONS;           break;
+        case PerfEvent::Branches:       attr.config = PERF_COUNT_HW_BRANCH_INSTRUCTIONS;    break;
+        default:                        attr.config = PERF_COUNT_HW_BRANCH_MISSES;          break;
+    }
+
+    m_fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if(m_fd < 0)
+    {
+        m_fd = -1;
+    }
+#else
+    (void)event;
+#endif
+}
+
+
+/**
+ * PerfCounter::~PerfCounter()
+ *
+ * Close the counter.
+ */
+PerfCounter::~PerfCounter()
+{
+#if defined(__linux__)
+    if(m_fd >= 0)
+    {
+        close(m_fd);
+    }
+#endif
+}
+
+
+/**
+ * PerfCounter::is_available()
+ *
+ * True if the counter was opened and counts, false if it always reads 0.
+ */
+bool PerfCounter::is_available() const
+{
+    return m_fd >= 0;
+}
+
+
+/**
+ * PerfCounter::start()
+ *
+ * Reset the count to 0 and start counting.
+ */
+void PerfCounter::start()
+{
+#if defined(__linux__)
+    if(m_fd >= 0)
+    {
+        ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+
+/**
+ * PerfCounter::stop()
+ *
+ * Stop counting, keeping the count so far.
+ */
+void PerfCounter::stop()
+{
+#if defined(__linux__)
+    if(m_fd >= 0)
+    {
+        ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+#endif
+}
+
+
+/**
+ * PerfCounter::read()
+ *
+ * Gets the number of events counted, or 0 if the counter is unavailable.
+ */
+std::uint64_t PerfCounter::read() const
+{
+    std::uint64_t count = 0;
+
+#if defined(__linux__)
+    if(m_fd >= 0 && ::read(m_fd, &count, sizeof(count)) != (ssize_t)sizeof(count))
+    {
+        count = 0;
+    }
+#endif
+
+    return count;
+}
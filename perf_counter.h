@@ -0,0 +1,49 @@
+/**
+ * Declares a hardware performance counter for the benchmarks.
+ * Rich documentation can be found in perf_counter.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * The hardware events a PerfCounter can count.
+ */
+enum class PerfEvent {
+    Instructions,
+    Branches,
+    BranchMisses
+};
+
+std::string to_string(PerfEvent event);
+
+/**
+ * Declare the structure of the PerfCounter class.
+ *
+ * Counts one hardware event on the calling thread and the threads it starts while the counter is open.
+ * Where the counter cannot be opened (no Linux perf events, or not permitted) it is unavailable and reads 0.
+ */
+class PerfCounter {
+
+private:
+
+    int m_fd;       //-1 when unavailable.
+
+public:
+
+    explicit PerfCounter(PerfEvent event);
+    ~PerfCounter();
+
+    PerfCounter(PerfCounter const &) = delete;
+    PerfCounter & operator=(PerfCounter const &) = delete;
+
+    bool is_available() const;
+
+    void start();
+    void stop();
+    std::uint64_t read() const;
+};
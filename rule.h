@@ -0,0 +1,101 @@
+/**
+ * Declares life-like cellular automaton rules written as B/S rulestrings, such as B3/S23 for Conway's Game of Life.
+ * Rich documentation for the api and behaviour the Rule class can be found in rule.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * A rule is an 18 bit mask. Bit n is set if a dead cell with n live neighbours is born,
+ * bit 9 + n is set if a live cell with n live neighbours survives.
+ */
+#define RULE_SURVIVAL_SHIFT 9
+
+/**
+ * A mask no rule can have, used by kernels that take the rule at runtime rather than as a template parameter.
+ */
+#define RULE_RUNTIME 0xFFFFFFFFu
+
+/**
+ * The mask of the neighbour counts in a run of digits, stopping at the first character that is not 0 to 8.
+ */
+constexpr std::uint32_t rule_digits_mask(char const * digits, unsigned int shift)
+{
+    return (*digits >= '0' && *digits <= '8')
+        ? ((1u << (unsigned int)(*digits - '0' + shift)) | rule_digits_mask(digits + 1, shift))
+        : 0u;
+}
+
+/**
+ * Skips a run of digits.
+ */
+constexpr char const * rule_skip_digits(char const * digits)
+{
+    return (*digits >= '0' && *digits <= '8') ? rule_skip_digits(digits + 1) : digits;
+}
+
+/**
+ * The mask of a rulestring of the exact form "B<digits>/S<digits>", evaluated at compile time for literals.
+ * Rulestrings from users should go through Rule::parse, which accepts other spellings and reports errors.
+ */
+constexpr std::uint32_t rule_mask(char const * rulestring)
+{
+    return rule_digits_mask(rulestring + 1, 0)
+         | rule_digits_mask(rule_skip_digits(rulestring + 1) + 2, RULE_SURVIVAL_SHIFT);
+}
+
+/**
+ * True if a cell in the given state with n live neighbours is alive in the next generation.
+ */
+constexpr bool rule_next(std::uint32_t mask, bool alive, unsigned int neighbours)
+{
+    return ((mask >> (neighbours + (alive ? RULE_SURVIVAL_SHIFT : 0))) & 1) != 0;
+}
+
+/**
+ * The rules the packed kernels are compiled for, every other rule runs on a kernel that reads the mask at runtime.
+ */
+constexpr std::uint32_t RULE_CONWAY        = rule_mask("B3/S23");
+constexpr std::uint32_t RULE_HIGHLIFE      = rule_mask("B36/S23");
+constexpr std::uint32_t RULE_DAY_AND_NIGHT = rule_mask("B3678/S34678");
+constexpr std::uint32_t RULE_SEEDS         = rule_mask("B2/S");
+
+/**
+ * Declare the structure of the Rule class.
+ *
+ * A Rule is a birth and survival mask, and is cheap to copy.
+ */
+class Rule {
+
+private:
+
+    std::uint32_t m_mask;
+
+public:
+
+    Rule();
+    explicit Rule(std::uint32_t mask);
+
+    static Rule parse(std::string const & rulestring);
+
+    static Rule conway();
+    static Rule highlife();
+    static Rule day_and_night();
+    static Rule seeds();
+
+    std::uint32_t get_mask() const;
+
+    bool births(unsigned int neighbours) const;
+    bool survives(unsigned int neighbours) const;
+    bool next(bool alive, unsigned int neighbours) const;
+
+    std::string to_string() const;
+
+    bool operator==(Rule const & other) const;
+    bool operator!=(Rule const & other) const;
+};
@@ -0,0 +1,361 @@
+/**
+ * Implements a Soup namespace for generating reproducible random soups and taking a census of what they settle into.
+ *
+ *      - Soups are drawn from a counter based generator rather than a sequential one such as std::mt19937.
+ *          - Every cell's random word is a hash of the seed, the soup's index and the cell's index,
+ *            so any soup can be generated on its own, on any thread, in any order, and always comes out the same.
+ *          - A soup found interesting in a census can be regenerated from the seed and its index alone.
+ *
+ *      - Batches of soups are run in an Ensemble, 64 soups stepped per word and groups spread over threads,
+ *        and each group stops as soon as all of its soups have settled into a still life or oscillator.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#include "soup.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+/**
+ * Soup::random(seed, stream, counter)
+ *
+ * A random word that depends only on its three arguments, the SplitMix64 finalizer applied to the key
+ * and the counter in turn. Consecutive counters give independent looking words, as do consecutive streams.
+ *
+ * @param seed
+ *      The seed of the whole batch.
+ *
+ * @param stream
+ *      The stream within the batch, for soups the soup's index.
+ *
+ * @param counter
+ *      The word within the stream, for soups the cell's index.
+ *
+ * @return
+ *      A uniformly distributed 64 bit word.
+ */
+std::uint64_t Soup::random(std::uint64_t seed, std::uint64_t stream, std::uint64_t counter)
+{
+    auto const mix = [](std::uint64_t word)
+    {
+        word = (word ^ (word >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        word = (word ^ (word >> 27)) * 0x94D049BB133111EBULL;
+        return word ^ (word >> 31);
+    };
+
+    std::uint64_t const key = mix(seed + 0x9E3779B97F4A7C15ULL * (stream + 1));
+    return mix(key + 0x9E3779B97F4A7C15ULL * (counter + 1));
+}
+
+
+/**
+ * Soup::generate(width, height, density, seed, index)
+ *
+ * Generate one random soup, each cell alive with a probability of density independently of the others.
+ *
+ * @example
+ *
+ *      // The same soup every time
+ *      Grid soup = Soup::generate(16, 16, 0.5, 1, 42);
+ *
+ * @param width
+ *      The width of the soup.
+ *
+ * @param height
+ *      The height of the soup.
+ *
+ * @param density
+ *      The probability of each cell being alive, from 0 to 1.
+ *
+ * @param seed
+ *      The seed of the batch the soup belongs to.
+ *
+ * @param index
+ *      The index of the soup in its batch.
+ *
+ * @throws
+ *      std::invalid_argument if the density is not between 0 and 1.
+ */
+Grid Soup::generate(unsigned int width, unsigned int height, double density, std::uint64_t seed, std::uint64_t index)
+{
+    if(!(density >= 0.0 && density <= 1.0))
+    {
+        throw std::invalid_argument("Soup density " + std::to_string(density) + " is not between 0 and 1");
+    }
+
+    //A cell is alive if its word is below density * 2^64. 2^64 itself does not fit, so a density of 1 is done apart.
+    bool const full = density >= 1.0;
+    std::uint64_t const threshold = full ? 0 : std::uint64_t(density * 18446744073709551616.0);
+
+    Grid grid(width, height);
+
+    for(unsigned int y = 0; y < height; y++)
+    {
+        Cell * row = grid.row(y);
+
+        for(unsigned int x = 0; x < width; x++)
+        {
+            std::uint64_t const cell = std::uint64_t(y) * width + x;
+            row[x] = (full || random(seed, index, cell) < threshold) ? Cell::ALIVE : Cell::DEAD;
+        }
+    }
+
+    return grid;
+}
+
+
+/**
+ * Soup::generate(ensemble, density, seed, first_index)
+ *
+ * Fill every world of an ensemble with a random soup, world i getting soup first_index + i of the batch,
+ * generated on the ensemble's threads.
+ *
+ * @example
+ *
+ *      // The second thousand soups of the batch
+ *      Ensemble soups(16, 16, 1000);
+ *      Soup::generate(soups, 0.5, 1, 1000);
+ *
+ * @param ensemble
+ *      The ensemble to fill, whose worlds give the size of the soups.
+ *
+ * @param density
+ *      The probability of each cell being alive, from 0 to 1.
+ *
+ * @param seed
+ *      The seed of the batch.
+ *
+ * @param first_index
+ *      Optional parameter. The index in the batch of the ensemble's first world. Defaults to 0.
+ *
+ * @throws
+ *      std::invalid_argument if the density is not between 0 and 1.
+ */
+void Soup::generate(Ensemble & ensemble, double density, std::uint64_t seed, std::uint64_t first_index)
+{
+    unsigned int const width = ensemble.get_width();
+    unsigned int const height = ensemble.get_height();
+
+    ensemble.set_worlds([&](unsigned int world)
+    {
+        return generate(width, height, density, seed, first_index + world);
+    });
+}
+
+
+/**
+ * Soup::census(ensemble, first_index)
+ *
+ * Count the outcomes of an ensemble of soups that has been run, usually by Ensemble::advance_until_stable.
+ * A soup counts as settled once the ensemble has found it repeating, and its population is that of its current state.
+ *
+ * @example
+ *
+ *      Soup::generate(soups, 0.5, 1);
+ *      soups.advance_until_stable(SOUP_MAX_GENERATIONS);
+ *      std::cout << Soup::census(soups) << std::endl;
+ *
+ * @param ensemble
+ *      The ensemble of soups.
+ *
+ * @param first_index
+ *      Optional parameter. The index in the batch of the ensemble's first world, added to the reported longest soup. Defaults to 0.
+ *
+ * @return
+ *      The census of every soup in the ensemble.
+ */
+SoupCensus Soup::census(Ensemble const & ensemble, std::uint64_t first_index)
+{
+    SoupCensus census;
+    std::vector<unsigned int> const populations = ensemble.get_populations();
+    bool found_longest = false;
+
+    census.soups = ensemble.get_count();
+
+    for(unsigned int i = 0; i < ensemble.get_count(); i++)
+    {
+        census.total_population += populations[i];
+        census.largest_population = std::max(census.largest_population, populations[i]);
+
+        if(!ensemble.is_stable(i))
+        {
+            census.unsettled++;
+            continue;
+        }
+
+        unsigned int const period = ensemble.get_period(i);
+        std::uint64_t const generations = ensemble.get_stable_generation(i);
+
+        census.died += (populations[i] == 0) ? 1 : 0;
+        census.still += (populations[i] != 0 && period == 1) ? 1 : 0;
+        census.oscillating += (period > 1) ? 1 : 0;
+        census.periods[period]++;
+
+        census.total_generations += generations;
+        if(generations > census.longest_generations || !found_longest)
+        {
+            census.longest_generations = generations;
+            census.longest_soup = first_index + i;
+            found_longest = true;
+        }
+    }
+
+    return census;
+}
+
+
+/**
+ * add_census(total, batch)
+ *
+ * Private helper adding the census of one batch of soups into the census of every batch so far.
+ */
+static void add_census(SoupCensus & total, SoupCensus const & batch)
+{
+    bool const longer = (batch.soups > batch.unsettled)
+                        && (total.soups == total.unsettled || batch.longest_generations > total.longest_generations);
+
+    total.soups += batch.soups;
+    total.died += batch.died;
+    total.still += batch.still;
+    total.oscillating += batch.oscillating;
+    total.unsettled += batch.unsettled;
+
+    for(auto const & period : batch.periods)
+    {
+        total.periods[period.first] += period.second;
+    }
+
+    total.total_generations += batch.total_generations;
+    if(longer)
+    {
+        total.longest_generations = batch.longest_generations;
+        total.longest_soup = batch.longest_soup;
+    }
+
+    total.total_population += batch.total_population;
+    total.largest_population = std::max(total.largest_population, batch.largest_population);
+}
+
+
+/**
+ * Soup::run(ensemble, density, seed, count, max_generations, toroidal)
+ *
+ * Generate soups 0 to count - 1 of a batch, run each until it settles or has taken max_generations generations,
+ * and take a census of them all. The soups are run through the ensemble as many at a time as it holds, with its
+ * size, rule, cycle window and threads, and a smaller ensemble of the same settings runs any that are left over.
+ *
+ * @example
+ *
+ *      // A census of a million 16x16 soups on every core
+ *      Ensemble soups(16, 16, SOUP_BATCH);
+ *      soups.set_threads(0);
+ *      soups.set_cycle_window(SOUP_CYCLE_WINDOW);
+ *      std::cout << Soup::run(soups, 0.5, 1, 1000000) << std::endl;
+ *
+ * @param ensemble
+ *      The ensemble to run the soups in. Its worlds are left holding the last full batch.
+ *
+ * @param density
+ *      The probability of each cell being alive, from 0 to 1.
+ *
+ * @param seed
+ *      The seed of the batch.
+ *
+ * @param count
+ *      The number of soups to run.
+ *
+ * @param max_generations
+ *      Optional parameter. The most generations to run each soup for. Defaults to SOUP_MAX_GENERATIONS.
+ *
+ * @param toroidal
+ *      Optional parameter. If true the soups wrap their left edge to their right and their top to their bottom. Defaults to false.
+ *
+ * @return
+ *      The census of every soup run.
+ *
+ * @throws
+ *      std::invalid_argument if the density is not between 0 and 1, or if the ensemble holds no worlds and count is not 0.
+ */
+SoupCensus Soup::run(Ensemble & ensemble, double density, std::uint64_t seed, std::uint64_t count,
+                     unsigned int max_generations, bool toroidal)
+{
+    if(ensemble.get_count() == 0 && count > 0)
+    {
+        throw std::invalid_argument("Soups cannot be run in an ensemble of no worlds");
+    }
+
+    SoupCensus total;
+    std::uint64_t first = 0;
+
+    //Whole batches, then the rest in an ensemble of just the right size
+    for(; first + ensemble.get_count() <= count; first += ensemble.get_count())
+    {
+        generate(ensemble, density, seed, first);
+        ensemble.advance_until_stable(max_generations, toroidal);
+        add_census(total, census(ensemble, first));
+    }
+
+    if(first < count)
+    {
+        Ensemble rest(ensemble.get_width(), ensemble.get_height(), (unsigned int)(count - first));
+        rest.set_rule(ensemble.get_rule());
+        rest.set_cycle_window(ensemble.get_cycle_window());
+        rest.set_threads(ensemble.get_threads());
+
+        generate(rest, density, seed, first);
+        rest.advance_until_stable(max_generations, toroidal);
+        add_census(total, census(rest, first));
+    }
+
+    return total;
+}
+
+
+/**
+ * operator<<(os, census)
+ *
+ * Write a census as a short human readable report, one outcome to a line.
+ *
+ * @example
+ *
+ *      std::cout << Soup::census(soups) << std::endl;
+ *
+ * @param os
+ *      The stream to write to.
+ *
+ * @param census
+ *      The census to write.
+ *
+ * @return
+ *      The stream, for chaining.
+ */
+std::ostream & operator<<(std::ostream & os, SoupCensus const & census)
+{
+    std::uint64_t const settled = census.soups - census.unsettled;
+
+    os << "Soups " << census.soups << " | Settled " << settled << " | Unsettled " << census.unsettled << std::endl
+       << "Died " << census.died << " | Still lifes " << census.still << " | Oscillating " << census.oscillating << std::endl;
+
+    os << "Periods";
+    for(auto const & period : census.periods)
+    {
+        os << " | p" << period.first << " " << period.second;
+    }
+    os << std::endl;
+
+    if(settled > 0)
+    {
+        os << "Generations to settle | mean " << (double(census.total_generations) / settled)
+           << " | longest " << census.longest_generations << " (soup " << census.longest_soup << ")" << std::endl;
+    }
+
+    if(census.soups > 0)
+    {
+        os << "Final population | mean " << (double(census.total_population) / census.soups)
+           << " | largest " << census.largest_population << std::endl;
+    }
+
+    return os;
+}
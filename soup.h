@@ -0,0 +1,67 @@
+/**
+ * Declares a Soup namespace for generating reproducible random soups and taking a census of what they settle into.
+ * Rich documentation for the api and behaviour of the Soup namespace can be found in soup.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+
+#include "grid.h"
+#include "ensemble.h"
+
+/**
+ * The most generations a soup is run for when no step count is given.
+ */
+#define SOUP_MAX_GENERATIONS 10000
+
+/**
+ * The generations a soup is watched for repeating itself when no cycle window is given, enough for every
+ * common oscillator up to the pentadecathlon's period of 15.
+ */
+#define SOUP_CYCLE_WINDOW 16
+
+/**
+ * The most soups Soup::run steps at once, so a census of millions of soups runs in a few tens of megabytes.
+ */
+#define SOUP_BATCH 65536
+
+/**
+ * The outcomes of a batch of soups, see Soup::census(ensemble).
+ */
+struct SoupCensus {
+    std::uint64_t soups = 0;
+    std::uint64_t died = 0;                 //Settled with no live cells.
+    std::uint64_t still = 0;                //Settled into still lifes only.
+    std::uint64_t oscillating = 0;          //Settled with a period above 1.
+    std::uint64_t unsettled = 0;            //Not found repeating within the generations run.
+
+    std::map<unsigned int, std::uint64_t> periods;  //Soups per period they settled with.
+
+    std::uint64_t total_generations = 0;    //Summed over the settled soups, from their start to their first repeat.
+    std::uint64_t longest_generations = 0;
+    std::uint64_t longest_soup = 0;         //The index of the settled soup that took longest, to regenerate it by.
+
+    std::uint64_t total_population = 0;     //Summed over every soup's final state.
+    unsigned int largest_population = 0;
+};
+
+std::ostream & operator<<(std::ostream & os, SoupCensus const & census);
+
+/**
+ * Declare the interface of the Soup namespace.
+ */
+namespace Soup {
+    std::uint64_t random(std::uint64_t seed, std::uint64_t stream, std::uint64_t counter);
+
+    Grid generate(unsigned int width, unsigned int height, double density, std::uint64_t seed, std::uint64_t index);
+    void generate(Ensemble & ensemble, double density, std::uint64_t seed, std::uint64_t first_index = 0);
+
+    SoupCensus census(Ensemble const & ensemble, std::uint64_t first_index = 0);
+    SoupCensus run(Ensemble & ensemble, double density, std::uint64_t seed, std::uint64_t count,
+                   unsigned int max_generations = SOUP_MAX_GENERATIONS, bool toroidal = false);
+};
@@ -0,0 +1,1800 @@
+/**
+ * Implements the step kernels used by World to advance a grid by one generation.
+ *
+ *      - Packed kernels compute 64 cells per word (SWAR, SIMD within a register).
+ *          - The eight neighbours of every cell in a word are formed by shifting the words of the rows
+ *            above, below, and the row itself one bit left and right.
+ *          - The neighbours are summed bit-parallel with full and half adders, so each bit of the result
+ *            words holds one bit of the neighbour count of the cell in that position.
+ *          - The B3/S23 rule is then a handful of bitwise operations on the count bits.
+ *          - The AVX2 and AVX-512 kernels run the same adders on 4 or 8 words at a time.
+ *
+ *      - Byte kernels work on a Grid, one cell per byte.
+ *          - Each row is converted to 0/1 bytes and the eight neighbours are summed with byte adds,
+ *            32 or 64 cells at a time with AVX2 or AVX-512, or one at a time by the scalar kernel.
+ *
+ *      - Rows are first copied into a padded scratch row with a ghost word or cell on each side.
+ *          - In bounded mode the ghosts and the rows above the top and below the bottom are zero.
+ *          - In toroidal mode the ghosts hold the cells from the opposite edge, and the rows wrap.
+ *          - This keeps the inner loops free of any edge handling.
+ *
+ *      - step_bits_tile steps one tile of 1024x64 cells of a packed grid with the same row kernels.
+ *          - It gathers the tile's words plus a ghost word either side for each of the 66 rows it reads,
+ *            with the same ghost and wrapping rules as the padded rows.
+ *          - Before gathering, the words the tile reads are ORed together straight from the grid. If they
+ *            are all zero the tile stays dead and is cleared without being gathered or computed.
+ *
+ *      - hash_bits_tile and hash_cells_tile hash the cells of one tile, equally for a BitGrid or a Grid of the same cells.
+ *          - The XOR of every tile's hash is the hash of the grid, so changing one tile rehashes only that tile.
+ *
+ *      - load_halo_rows and step_halo_rows step a Grid through a whole-grid copy with a one cell halo.
+ *          - The halo is the ghost cells and rows of the padded rows above, kept for the whole step, so the
+ *            scalar loop reads all nine cells of every cell with no bounds checks, no wrapping and no branches.
+ *          - Loading and stepping are separate calls so each can be split into bands of rows.
+ *
+ *      - step_column_sums steps a Grid from a running sum of each column over the rows above, through and below
+ *        the current row, so each cell is three byte additions and a table lookup.
+ *
+ *      - load_block_rows and step_block_rows step a Grid 2x2 cells at a time through a 65536 entry table.
+ *          - The table, built by block_table for a rule, holds the next state of the centre 2x2 cells of every 4x4 block.
+ *          - The grid is packed into bit rows with a one cell halo, then each 2x2 block of the next state is
+ *            one lookup indexed by four 4 bit reads from the rows above, through and below it.
+ *
+ *      - step_bits_generations advances a band of rows several generations in one pass of the grid.
+ *          - The band and the rows either side it depends on are stepped back and forth between two scratch buffers,
+ *            each generation computing one row fewer at each end, and only the last generation is written out.
+ *          - Bands whose buffers fit in cache are bound by computing the kernels rather than by memory bandwidth.
+ *
+ *      - step_sliced steps 64 small worlds at once stored bit sliced, bit k of every word a cell of world k.
+ *          - The packed row kernels are templates on whether a row is packed or sliced, so the sliced kernels
+ *            take a cell's west and east neighbours from the words either side instead of shifting.
+ *
+ *      - step_bits and step_bytes pick the kernel for active_simd_level() on every call, so one binary
+ *        runs on any x86-64 CPU and uses the widest instruction set it has.
+ *
+ *      - Every kernel takes the life-like rule to apply, see rule.cpp.
+ *          - Packed kernels are templates on the rule's mask. Conway's Game of Life, HighLife, Day & Night and Seeds
+ *            are compiled with the rule folded into the adders, so each costs a few bitwise operations per word.
+ *          - Any other rule runs on the same kernels reading the mask at runtime.
+ *          - Byte kernels look the next state up in a 32 byte table, with byte shuffles in the SIMD kernels,
+ *            so they run at the same speed whatever the rule.
+ *          - Rules that give birth on 0 neighbours are supported. Cells beyond the edge of a bounded grid stay dead.
+ *
+ *      - Every kernel matches World::step on the reference engine bit for bit.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#include "step_kernels.h"
+#include "cpu_features.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#if SIMD_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * A kernel computing one row of packed words from the padded rows around it.
+ * above, centre and below point at word 0 of their padded rows, so word -1 and word (words) are ghosts.
+ */
+typedef void (*BitRowKernel)(std::uint64_t const * above, std::uint64_t const * centre, std::uint64_t const * below,
+                             std::uint64_t * target, unsigned int words, std::uint32_t mask);
+
+/**
+ * A kernel computing one row of cells from the padded 0/1 rows around it.
+ * above, centre and below point at the west ghost of their padded rows, so cell x is at index x + 1.
+ * table is the rule as built by rule_table.
+ */
+typedef void (*ByteRowKernel)(std::uint8_t const * above, std::uint8_t const * centre, std::uint8_t const * below,
+                              Cell * target, unsigned int width, std::uint8_t const * table);
+
+
+/**
+ * Reads the cell at x of a packed row as a single bit.
+ */
+static inline std::uint64_t cell_bit(std::uint64_t const * row, unsigned int x)
+{
+    return (row[x / BITGRID_WORD_BITS] >> (x % BITGRID_WORD_BITS)) & 1;
+}
+
+/**
+ * Wraps a row index that is at most one row out of range.
+ * Returns -1 for rows outside a bounded grid.
+ */
+static inline int source_row(int y, int height, bool toroidal)
+{
+    if(y >= 0 && y < height)
+    {
+        return y;
+    }
+    else if(!toroidal)
+    {
+        return -1;
+    }
+    return (y < 0) ? y + height : y - height;
+}
+
+/**
+ * Fill the ghost bits of a padded row of a toroidal grid from the row itself, which is in padded[1, words].
+ * The ghost words must be zero, as must the bits past the width in the last word.
+ */
+static inline void wrap_padded_row(std::uint64_t * padded, unsigned int width, unsigned int words)
+{
+    std::uint64_t const * source = padded + 1;
+    unsigned int const used = width % BITGRID_WORD_BITS;
+
+    //West of cell 0 is the last cell of the row.
+    padded[0] = cell_bit(source, width - 1) << (BITGRID_WORD_BITS - 1);
+
+    //East of the last cell is cell 0, either just past the width in the last word or in the ghost word.
+    if(used == 0)
+    {
+        padded[words + 1] = cell_bit(source, 0);
+    }
+    else
+    {
+        padded[words] |= cell_bit(source, 0) << used;
+    }
+}
+
+/**
+ * Copy row y of a packed grid into padded, which is words_per_row + 2 words long.
+ *
+ * padded[0] and padded[words_per_row + 1] are ghost words. Out of range rows are zero in
+ * bounded mode and wrap to the opposite edge in toroidal mode. In toroidal mode the ghost bits
+ * either side of the row hold the cells from the opposite end of the row.
+ */
+static void load_padded_row(BitGrid const & grid, int y, bool toroidal, std::uint64_t * padded)
+{
+    unsigned int const words = grid.get_words_per_row();
+
+    std::fill(padded, padded + words + 2, 0);
+
+    y = source_row(y, (int)grid.get_height(), toroidal);
+    if(y < 0)
+    {
+        return;
+    }
+
+    std::memcpy(padded + 1, grid.row((unsigned int)y), words * sizeof(std::uint64_t));
+
+    if(toroidal)
+    {
+        wrap_padded_row(padded, grid.get_width(), words);
+    }
+}
+
+/**
+ * Word i of a packed row as it appears in the padded row, with i = -1 and i = words_per_row being the ghost words.
+ */
+static inline std::uint64_t padded_word(BitGrid const & grid, std::uint64_t const * source, bool toroidal, int i)
+{
+    int const words = (int)grid.get_words_per_row();
+    unsigned int const width = grid.get_width();
+    unsigned int const used = width % BITGRID_WORD_BITS;
+
+    if(i >= 0 && i < words)
+    {
+        std::uint64_t word = source[i];
+        if(toroidal && used != 0 && i == words - 1)
+        {
+            word |= cell_bit(source, 0) << used;
+        }
+        return word;
+    }
+    else if(!toroidal)
+    {
+        return 0;
+    }
+    else if(i < 0)
+    {
+        return cell_bit(source, width - 1) << (BITGRID_WORD_BITS - 1);
+    }
+    return (used == 0) ? cell_bit(source, 0) : 0;
+}
+
+/**
+ * Copy row y of a grid into padded as 0/1 bytes, padded is width + 2 bytes long.
+ *
+ * padded[0] and padded[width + 1] are ghost cells, zero in bounded mode and the cells from
+ * the opposite end of the row in toroidal mode. Out of range rows follow the same rules as load_padded_row.
+ */
+static void load_padded_cells(Grid const & grid, int y, bool toroidal, std::uint8_t * padded)
+{
+    unsigned int const width = grid.get_width();
+
+    y = source_row(y, (int)grid.get_height(), toroidal);
+    if(y < 0)
+    {
+        std::fill(padded, padded + width + 2, 0);
+        return;
+    }
+
+    //Cell::ALIVE is '#' (0x23) and Cell::DEAD is ' ' (0x20), so the low bit is the state.
+    Cell const * source = grid.row((unsigned int)y);
+    for(unsigned int x = 0; x < width; x++)
+    {
+        padded[x + 1] = std::uint8_t(source[x]) & 1;
+    }
+
+    padded[0] = toroidal ? padded[width] : 0;
+    padded[width + 1] = toroidal ? padded[1] : 0;
+}
+
+
+/**
+ * Apply a rule to 64 cells given the bits of their neighbour counts, count = s0 + 2 s1 + 4 s2 + 8 s3, and their states.
+ * Mask is the rule, or RULE_RUNTIME to read it from mask. With a constant Mask the loop folds away
+ * to the equality tests of the counts the rule uses.
+ */
+template<std::uint32_t Mask>
+static inline std::uint64_t rule_word(std::uint64_t s0, std::uint64_t s1, std::uint64_t s2, std::uint64_t s3,
+                                      std::uint64_t c, std::uint32_t mask)
+{
+    std::uint32_t const rule = (Mask == RULE_RUNTIME) ? mask : Mask;
+    std::uint64_t born = 0, kept = 0;
+
+    for(unsigned int n = 0; n <= 8; n++)
+    {
+        bool const birth = rule_next(rule, false, n);
+        bool const survival = rule_next(rule, true, n);
+
+        if(birth || survival)
+        {
+            std::uint64_t const count = ((n & 1) ? s0 : ~s0) & ((n & 2) ? s1 : ~s1)
+                                      & ((n & 4) ? s2 : ~s2) & ((n & 8) ? s3 : ~s3);
+            born |= birth ? count : 0;
+            kept |= survival ? count : 0;
+        }
+    }
+
+    return (born & ~c) | (kept & c);
+}
+
+/**
+ * The cells west and east of a word of cells. In a packed row they are the word shifted one cell either way,
+ * with the end cell from the next word over. In a bit sliced row every word is one cell of 64 worlds,
+ * so they are simply the words either side.
+ */
+template<bool Sliced>
+static inline std::uint64_t west_word(std::uint64_t const * word)
+{
+    return Sliced ? word[-1] : (word[0] << 1) | (word[-1] >> 63);
+}
+
+template<bool Sliced>
+static inline std::uint64_t east_word(std::uint64_t const * word)
+{
+    return Sliced ? word[1] : (word[0] >> 1) | (word[1] << 63);
+}
+
+/**
+ * Apply a rule to one word of 64 cells given the three padded rows around it.
+ * above, centre and below point at the word being computed, their [-1] and [1] words must be readable.
+ */
+template<std::uint32_t Mask, bool Sliced>
+static inline std::uint64_t life_word(std::uint64_t const * above, std::uint64_t const * centre, std::uint64_t const * below,
+                                      std::uint32_t mask)
+{
+    std::uint64_t const a  = above[0];
+    std::uint64_t const aw = west_word<Sliced>(above);
+    std::uint64_t const ae = east_word<Sliced>(above);
+
+    std::uint64_t const c  = centre[0];
+    std::uint64_t const cw = west_word<Sliced>(centre);
+    std::uint64_t const ce = east_word<Sliced>(centre);
+
+    std::uint64_t const b  = below[0];
+    std::uint64_t const bw = west_word<Sliced>(below);
+    std::uint64_t const be = east_word<Sliced>(below);
+
+    //Full adders on the rows above and below, a half adder on the centre row. Each gives a 2-bit count.
+    std::uint64_t const a0 = aw ^ a ^ ae;
+    std::uint64_t const a1 = (aw & a) | (ae & (aw ^ a));
+
+    std::uint64_t const b0 = bw ^ b ^ be;
+    std::uint64_t const b1 = (bw & b) | (be & (bw ^ b));
+
+    std::uint64_t const c0 = cw ^ ce;
+    std::uint64_t const c1 = cw & ce;
+
+    //Sum the ones column, carrying into the twos column.
+    std::uint64_t const s0 = a0 ^ b0 ^ c0;
+    std::uint64_t const k0 = (a0 & b0) | (c0 & (a0 ^ b0));
+
+    //The twos column has four inputs, the count is 2 or 3 only if at most one of them is set.
+    std::uint64_t const s1 = a1 ^ b1 ^ c1 ^ k0;
+
+    if(Mask == RULE_CONWAY)
+    {
+        std::uint64_t const many = (a1 & b1) | (c1 & k0) | ((a1 ^ b1) & (c1 ^ k0));
+
+        //Alive next if the count is 3, or the count is 2 and the cell is alive.
+        return (s0 | c) & s1 & ~many;
+    }
+
+    //Other rules need the whole count. At most two of the three carries out of the twos column can be set.
+    std::uint64_t const p = a1 & b1;
+    std::uint64_t const q = c1 & k0;
+    std::uint64_t const r = (a1 ^ b1) & (c1 ^ k0);
+
+    return rule_word<Mask>(s0, s1, p ^ q ^ r, p & q, c, mask);
+}
+
+template<std::uint32_t Mask, bool Sliced>
+static void life_row_swar(std::uint64_t const * above, std::uint64_t const * centre, std::uint64_t const * below,
+                          std::uint64_t * target, unsigned int words, std::uint32_t mask)
+{
+    for(unsigned int w = 0; w < words; w++)
+    {
+        target[w] = life_word<Mask, Sliced>(above + w, centre + w, below + w, mask);
+    }
+}
+
+/**
+ * Fill the 32 byte table the byte kernels look the rule up in. Entry n is for a dead cell with n neighbours
+ * and entry 16 + n for a live one. Entries are 3 for alive and 0 for dead, as Cell::ALIVE is Cell::DEAD | 3.
+ */
+static void rule_table(Rule const & rule, std::uint8_t * table)
+{
+    std::fill(table, table + 32, 0);
+
+    for(unsigned int n = 0; n <= 8; n++)
+    {
+        table[n] = rule.births(n) ? 3 : 0;
+        table[16 + n] = rule.survives(n) ? 3 : 0;
+    }
+}
+
+/**
+ * Apply a rule to one cell given the three padded 0/1 rows around it, x is the index of the west neighbour.
+ */
+static inline Cell life_cell(std::uint8_t const * above, std::uint8_t const * centre, std::uint8_t const * below, unsigned int x,
+                             std::uint8_t const * table)
+{
+    unsigned int const sum = above[x] + above[x + 1] + above[x + 2]
+                           + centre[x]                + centre[x + 2]
+                           + below[x] + below[x + 1] + below[x + 2];
+
+    //A table lookup rather than comparisons, so the loop has no branches whatever the rule.
+    return Cell(Cell::DEAD | table[(centre[x + 1] << 4) | sum]);
+}
+
+static void life_row_bytes_scalar(std::uint8_t const * above, std::uint8_t const * centre, std::uint8_t const * below,
+                                  Cell * target, unsigned int width, std::uint8_t const * table)
+{
+    for(unsigned int x = 0; x < width; x++)
+    {
+        target[x] = life_cell(above, centre, below, x, table);
+    }
+}
+
+
+#if SIMD_X86
+
+/**
+ * rule_word for four words at a time.
+ */
+template<std::uint32_t Mask>
+TARGET_AVX2
+static inline __m256i rule_avx2(__m256i s0, __m256i s1, __m256i s2, __m256i s3, __m256i c, std::uint32_t mask)
+{
+    std::uint32_t const rule = (Mask == RULE_RUNTIME) ? mask : Mask;
+    __m256i born = _mm256_setzero_si256(), kept = _mm256_setzero_si256();
+
+    for(unsigned int n = 0; n <= 8; n++)
+    {
+        bool const birth = rule_next(rule, false, n);
+        bool const survival = rule_next(rule, true, n);
+
+        if(birth || survival)
+        {
+            __m256i count = _mm256_set1_epi64x(-1);
+            count = (n & 1) ? _mm256_and_si256(count, s0) : _mm256_andnot_si256(s0, count);
+            count = (n & 2) ? _mm256_and_si256(count, s1) : _mm256_andnot_si256(s1, count);
+            count = (n & 4) ? _mm256_and_si256(count, s2) : _mm256_andnot_si256(s2, count);
+            count = (n & 8) ? _mm256_and_si256(count, s3) : _mm256_andnot_si256(s3, count);
+
+            born = birth ? _mm256_or_si256(born, count) : born;
+            kept = survival ? _mm256_or_si256(kept, count) : kept;
+        }
+    }
+
+    return _mm256_or_si256(_mm256_andnot_si256(c, born), _mm256_and_si256(kept, c));
+}
+
+/**
+ * west_word and east_word for four words at a time, given the words at word.
+ */
+template<bool Sliced>
+TARGET_AVX2
+static inline __m256i west_avx2(std::uint64_t const * word, __m256i words)
+{
+    __m256i const before = _mm256_loadu_si256((__m256i const *)(word - 1));
+    return Sliced ? before : _mm256_or_si256(_mm256_slli_epi64(words, 1), _mm256_srli_epi64(before, 63));
+}
+
+template<bool Sliced>
+TARGET_AVX2
+static inline __m256i east_avx2(std::uint64_t const * word, __m256i words)
+{
+    __m256i const after = _mm256_loadu_si256((__m256i const *)(word + 1));
+    return Sliced ? after : _mm256_or_si256(_mm256_srli_epi64(words, 1), _mm256_slli_epi64(after, 63));
+}
+
+template<std::uint32_t Mask, bool Sliced>
+TARGET_AVX2
+static void life_row_avx2(std::uint64_t const * above, std::uint64_t const * centre, std::uint64_t const * below,
+                          std::uint64_t * target, unsigned int words, std::uint32_t mask)
+{
+    unsigned int w = 0;
+
+    for(; w + 4 <= words; w += 4)
+    {
+        __m256i const a  = _mm256_loadu_si256((__m256i const *)(above + w));
+        __m256i const aw = west_avx2<Sliced>(above + w, a);
+        __m256i const ae = east_avx2<Sliced>(above + w, a);
+
+        __m256i const c  = _mm256_loadu_si256((__m256i const *)(centre + w));
+        __m256i const cw = west_avx2<Sliced>(centre + w, c);
+        __m256i const ce = east_avx2<Sliced>(centre + w, c);
+
+        __m256i const b  = _mm256_loadu_si256((__m256i const *)(below + w));
+        __m256i const bw = west_avx2<Sliced>(below + w, b);
+        __m256i const be = east_avx2<Sliced>(below + w, b);
+
+        __m256i const a0 = _mm256_xor_si256(_mm256_xor_si256(aw, a), ae);
+        __m256i const a1 = _mm256_or_si256(_mm256_and_si256(aw, a), _mm256_and_si256(ae, _mm256_xor_si256(aw, a)));
+
+        __m256i const b0 = _mm256_xor_si256(_mm256_xor_si256(bw, b), be);
+        __m256i const b1 = _mm256_or_si256(_mm256_and_si256(bw, b), _mm256_and_si256(be, _mm256_xor_si256(bw, b)));
+
+        __m256i const c0 = _mm256_xor_si256(cw, ce);
+        __m256i const c1 = _mm256_and_si256(cw, ce);
+
+        __m256i const s0 = _mm256_xor_si256(_mm256_xor_si256(a0, b0), c0);
+        __m256i const k0 = _mm256_or_si256(_mm256_and_si256(a0, b0), _mm256_and_si256(c0, _mm256_xor_si256(a0, b0)));
+
+        __m256i const s1 = _mm256_xor_si256(_mm256_xor_si256(a1, b1), _mm256_xor_si256(c1, k0));
+        __m256i const p = _mm256_and_si256(a1, b1);
+        __m256i const q = _mm256_and_si256(c1, k0);
+        __m256i const r = _mm256_and_si256(_mm256_xor_si256(a1, b1), _mm256_xor_si256(c1, k0));
+
+        __m256i next;
+        if(Mask == RULE_CONWAY)
+        {
+            __m256i const many = _mm256_or_si256(_mm256_or_si256(p, q), r);
+            next = _mm256_andnot_si256(many, _mm256_and_si256(_mm256_or_si256(s0, c), s1));
+        }
+        else
+        {
+            next = rule_avx2<Mask>(s0, s1, _mm256_xor_si256(_mm256_xor_si256(p, q), r), _mm256_and_si256(p, q), c, mask);
+        }
+        _mm256_storeu_si256((__m256i *)(target + w), next);
+    }
+
+    life_row_swar<Mask, Sliced>(above + w, centre + w, below + w, target + w, words - w, mask);
+}
+
+//GCC's AVX-512 headers pass _mm512_undefined_epi32() as the unused source of the unmasked intrinsics, which
+//-Wmaybe-uninitialized reports wherever they are inlined at -O2. The value is never read, so the warning is
+//silenced for the AVX-512 kernels alone.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+
+/**
+ * rule_word for eight words at a time.
+ */
+template<std::uint32_t Mask>
+TARGET_AVX512
+static inline __m512i rule_avx512(__m512i s0, __m512i s1, __m512i s2, __m512i s3, __m512i c, std::uint32_t mask)
+{
+    std::uint32_t const rule = (Mask == RULE_RUNTIME) ? mask : Mask;
+    __m512i born = _mm512_setzero_si512(), kept = _mm512_setzero_si512();
+
+    for(unsigned int n = 0; n <= 8; n++)
+    {
+        bool const birth = rule_next(rule, false, n);
+        bool const survival = rule_next(rule, true, n);
+
+        if(birth || survival)
+        {
+            __m512i count = _mm512_set1_epi64(-1);
+            count = (n & 1) ? _mm512_and_si512(count, s0) : _mm512_andnot_si512(s0, count);
+            count = (n & 2) ? _mm512_and_si512(count, s1) : _mm512_andnot_si512(s1, count);
+            count = (n & 4) ? _mm512_and_si512(count, s2) : _mm512_andnot_si512(s2, count);
+            count = (n & 8) ? _mm512_and_si512(count, s3) : _mm512_andnot_si512(s3, count);
+
+            born = birth ? _mm512_or_si512(born, count) : born;
+            kept = survival ? _mm512_or_si512(kept, count) : kept;
+        }
+    }
+
+    return _mm512_or_si512(_mm512_andnot_si512(c, born), _mm512_and_si512(kept, c));
+}
+
+/**
+ * west_word and east_word for eight words at a time, given the words at word.
+ */
+template<bool Sliced>
+TARGET_AVX512
+static inline __m512i west_avx512(std::uint64_t const * word, __m512i words)
+{
+    __m512i const before = _mm512_loadu_si512(word - 1);
+    return Sliced ? before : _mm512_or_si512(_mm512_slli_epi64(words, 1), _mm512_srli_epi64(before, 63));
+}
+
+template<bool Sliced>
+TARGET_AVX512
+static inline __m512i east_avx512(std::uint64_t const * word, __m512i words)
+{
+    __m512i const after = _mm512_loadu_si512(word + 1);
+    return Sliced ? after : _mm512_or_si512(_mm512_srli_epi64(words, 1), _mm512_slli_epi64(after, 63));
+}
+
+template<std::uint32_t Mask, bool Sliced>
+TARGET_AVX512
+static void life_row_avx512(std::uint64_t const * above, std::uint64_t const * centre, std::uint64_t const * below,
+                            std::uint64_t * target, unsigned int words, std::uint32_t mask)
+{
+    //_mm512_ternarylogic_epi64 truth tables for three inputs.
+    int const XOR3 = 0x96, MAJORITY = 0xE8, OR3 = 0xFE, MAJ_OR_AND = 0xF8, AND_ANDNOT = 0x40;
+
+    unsigned int w = 0;
+
+    for(; w + 8 <= words; w += 8)
+    {
+        __m512i const a  = _mm512_loadu_si512(above + w);
+        __m512i const aw = west_avx512<Sliced>(above + w, a);
+        __m512i const ae = east_avx512<Sliced>(above + w, a);
+
+        __m512i const c  = _mm512_loadu_si512(centre + w);
+        __m512i const cw = west_avx512<Sliced>(centre + w, c);
+        __m512i const ce = east_avx512<Sliced>(centre + w, c);
+
+        __m512i const b  = _mm512_loadu_si512(below + w);
+        __m512i const bw = west_avx512<Sliced>(below + w, b);
+        __m512i const be = east_avx512<Sliced>(below + w, b);
+
+        //Each full adder is two ternary logic instructions.
+        __m512i const a0 = _mm512_ternarylogic_epi64(aw, a, ae, XOR3);
+        __m512i const a1 = _mm512_ternarylogic_epi64(aw, a, ae, MAJORITY);
+
+        __m512i const b0 = _mm512_ternarylogic_epi64(bw, b, be, XOR3);
+        __m512i const b1 = _mm512_ternarylogic_epi64(bw, b, be, MAJORITY);
+
+        __m512i const c0 = _mm512_xor_si512(cw, ce);
+        __m512i const c1 = _mm512_and_si512(cw, ce);
+
+        __m512i const s0 = _mm512_ternarylogic_epi64(a0, b0, c0, XOR3);
+        __m512i const k0 = _mm512_ternarylogic_epi64(a0, b0, c0, MAJORITY);
+
+        __m512i const s1 = _mm512_xor_si512(_mm512_ternarylogic_epi64(a1, b1, c1, XOR3), k0);
+
+        __m512i next;
+        if(Mask == RULE_CONWAY)
+        {
+            //Two or more of a1, b1, c1, k0 is a majority of the first three, or k0 and any of them.
+            __m512i const many = _mm512_ternarylogic_epi64(_mm512_ternarylogic_epi64(a1, b1, c1, MAJORITY), k0,
+                                                           _mm512_ternarylogic_epi64(a1, b1, c1, OR3), MAJ_OR_AND);
+
+            next = _mm512_ternarylogic_epi64(_mm512_or_si512(s0, c), s1, many, AND_ANDNOT);
+        }
+        else
+        {
+            __m512i const p = _mm512_and_si512(a1, b1);
+            __m512i const q = _mm512_and_si512(c1, k0);
+            __m512i const r = _mm512_and_si512(_mm512_xor_si512(a1, b1), _mm512_xor_si512(c1, k0));
+
+            next = rule_avx512<Mask>(s0, s1, _mm512_ternarylogic_epi64(p, q, r, XOR3), _mm512_and_si512(p, q), c, mask);
+        }
+        _mm512_storeu_si512(target + w, next);
+    }
+
+    life_row_swar<Mask, Sliced>(above + w, centre + w, below + w, target + w, words - w, mask);
+}
+
+TARGET_AVX2
+static void life_row_bytes_avx2(std::uint8_t const * above, std::uint8_t const * centre, std::uint8_t const * below,
+                                Cell * target, unsigned int width, std::uint8_t const * table)
+{
+    __m256i const one = _mm256_set1_epi8(1);
+    __m256i const dead = _mm256_set1_epi8(char(Cell::DEAD));
+
+    //The rule's 16 entry tables for dead and live cells, in both lanes for the byte shuffles.
+    __m256i const births = _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i const *)table));
+    __m256i const survivals = _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i const *)(table + 16)));
+
+    unsigned int x = 0;
+
+    for(; x + 32 <= width; x += 32)
+    {
+        __m256i sum = _mm256_add_epi8(_mm256_loadu_si256((__m256i const *)(above + x)),
+                                      _mm256_loadu_si256((__m256i const *)(above + x + 1)));
+        sum = _mm256_add_epi8(sum, _mm256_loadu_si256((__m256i const *)(above + x + 2)));
+        sum = _mm256_add_epi8(sum, _mm256_loadu_si256((__m256i const *)(centre + x)));
+        sum = _mm256_add_epi8(sum, _mm256_loadu_si256((__m256i const *)(centre + x + 2)));
+        sum = _mm256_add_epi8(sum, _mm256_loadu_si256((__m256i const *)(below + x)));
+        sum = _mm256_add_epi8(sum, _mm256_loadu_si256((__m256i const *)(below + x + 1)));
+        sum = _mm256_add_epi8(sum, _mm256_loadu_si256((__m256i const *)(below + x + 2)));
+
+        __m256i const alive = _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i const *)(centre + x + 1)), one);
+        __m256i const next = _mm256_blendv_epi8(_mm256_shuffle_epi8(births, sum), _mm256_shuffle_epi8(survivals, sum), alive);
+
+        //The tables hold 3 for alive cells, and Cell::ALIVE is Cell::DEAD with the two low bits set.
+        _mm256_storeu_si256((__m256i *)(target + x), _mm256_or_si256(dead, next));
+    }
+
+    for(; x < width; x++)
+    {
+        target[x] = life_cell(above, centre, below, x, table);
+    }
+}
+
+TARGET_AVX512
+static void life_row_bytes_avx512(std::uint8_t const * above, std::uint8_t const * centre, std::uint8_t const * below,
+                                  Cell * target, unsigned int width, std::uint8_t const * table)
+{
+    __m512i const one = _mm512_set1_epi8(1);
+    __m512i const dead = _mm512_set1_epi8(char(Cell::DEAD));
+
+    //The rule's 16 entry tables for dead and live cells, in every lane for the byte shuffles.
+    __m512i const births = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const *)table));
+    __m512i const survivals = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const *)(table + 16)));
+
+    unsigned int x = 0;
+
+    for(; x + 64 <= width; x += 64)
+    {
+        __m512i sum = _mm512_add_epi8(_mm512_loadu_si512(above + x), _mm512_loadu_si512(above + x + 1));
+        sum = _mm512_add_epi8(sum, _mm512_loadu_si512(above + x + 2));
+        sum = _mm512_add_epi8(sum, _mm512_loadu_si512(centre + x));
+        sum = _mm512_add_epi8(sum, _mm512_loadu_si512(centre + x + 2));
+        sum = _mm512_add_epi8(sum, _mm512_loadu_si512(below + x));
+        sum = _mm512_add_epi8(sum, _mm512_loadu_si512(below + x + 1));
+        sum = _mm512_add_epi8(sum, _mm512_loadu_si512(below + x + 2));
+
+        __mmask64 const alive = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(centre + x + 1), one);
+        __m512i const next = _mm512_mask_blend_epi8(alive, _mm512_shuffle_epi8(births, sum), _mm512_shuffle_epi8(survivals, sum));
+
+        _mm512_storeu_si512(target + x, _mm512_or_si512(dead, next));
+    }
+
+    for(; x < width; x++)
+    {
+        target[x] = life_cell(above, centre, below, x, table);
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+
+/**
+ * The widest packed row kernel up to level for the rule Mask, for packed or bit sliced rows.
+ */
+template<std::uint32_t Mask, bool Sliced>
+static BitRowKernel bit_row_kernel_for(SimdLevel level)
+{
+#if SIMD_X86
+    switch(level)
+    {
+        case SimdLevel::AVX512: return life_row_avx512<Mask, Sliced>;
+        case SimdLevel::AVX2:   return life_row_avx2<Mask, Sliced>;
+        default:                break;
+    }
+#else
+    (void)level;
+#endif
+    return life_row_swar<Mask, Sliced>;
+}
+
+/**
+ * The widest packed row kernel up to level for a rule. The common rules have kernels compiled for them,
+ * any other rule gets the kernel that reads its mask at runtime.
+ */
+template<bool Sliced>
+static BitRowKernel row_kernel(std::uint32_t mask, SimdLevel level)
+{
+    switch(mask)
+    {
+        case RULE_CONWAY:           return bit_row_kernel_for<RULE_CONWAY, Sliced>(level);
+        case RULE_HIGHLIFE:         return bit_row_kernel_for<RULE_HIGHLIFE, Sliced>(level);
+        case RULE_DAY_AND_NIGHT:    return bit_row_kernel_for<RULE_DAY_AND_NIGHT, Sliced>(level);
+        case RULE_SEEDS:            return bit_row_kernel_for<RULE_SEEDS, Sliced>(level);
+        default:                    return bit_row_kernel_for<RULE_RUNTIME, Sliced>(level);
+    }
+}
+
+static BitRowKernel bit_row_kernel(std::uint32_t mask, SimdLevel level)
+{
+    return row_kernel<false>(mask, level);
+}
+
+/**
+ * The widest bit sliced row kernel up to level for a rule, where each word is one cell of 64 worlds.
+ */
+static BitRowKernel sliced_row_kernel(std::uint32_t mask, SimdLevel level)
+{
+    return row_kernel<true>(mask, level);
+}
+
+
+/**
+ * Steps rows [y0, y1) of a packed grid with a row kernel, sliding three padded rows down the grid.
+ */
+static void step_bit_rows(BitGrid const & curr, BitGrid & next, bool toroidal, unsigned int y0, unsigned int y1,
+                          BitRowKernel kernel, std::uint32_t rule)
+{
+    unsigned int const words = curr.get_words_per_row();
+
+    if(words == 0 || y0 >= y1)
+    {
+        return;
+    }
+
+    std::uint64_t const mask = curr.last_word_mask();
+
+    //Three padded rows, rotated as the window moves down.
+    std::vector<std::uint64_t> scratch(3 * (words + 2));
+    std::uint64_t * above = &scratch[0];
+    std::uint64_t * centre = above + (words + 2);
+    std::uint64_t * below = centre + (words + 2);
+
+    load_padded_row(curr, (int)y0 - 1, toroidal, above);
+    load_padded_row(curr, (int)y0, toroidal, centre);
+
+    for(unsigned int y = y0; y < y1; y++)
+    {
+        load_padded_row(curr, (int)y + 1, toroidal, below);
+
+        std::uint64_t * target = next.row(y);
+
+        kernel(above + 1, centre + 1, below + 1, target, words, rule);
+        target[words - 1] &= mask;
+
+        std::swap(above, centre);
+        std::swap(centre, below);
+    }
+}
+
+/**
+ * Steps rows [y0, y1) of a byte grid with a row kernel, sliding three padded 0/1 rows down the grid.
+ */
+static void step_byte_rows(Grid const & curr, Grid & next, bool toroidal, unsigned int y0, unsigned int y1,
+                           ByteRowKernel kernel, Rule const & rule)
+{
+    unsigned int const width = curr.get_width();
+
+    if(width == 0 || y0 >= y1)
+    {
+        return;
+    }
+
+    std::uint8_t table[32];
+    rule_table(rule, table);
+
+    std::vector<std::uint8_t> scratch(3 * (width + 2));
+    std::uint8_t * above = &scratch[0];
+    std::uint8_t * centre = above + (width + 2);
+    std::uint8_t * below = centre + (width + 2);
+
+    load_padded_cells(curr, (int)y0 - 1, toroidal, above);
+    load_padded_cells(curr, (int)y0, toroidal, centre);
+
+    for(unsigned int y = y0; y < y1; y++)
+    {
+        load_padded_cells(curr, (int)y + 1, toroidal, below);
+
+        kernel(above, centre, below, next.row(y), width, table);
+
+        std::swap(above, centre);
+        std::swap(centre, below);
+    }
+}
+
+
+/**
+ * step_padded_words(padded, span, rows, target, stride)
+ *
+ * Advance a block of packed cells that has already been gathered with its surroundings, using the widest
+ * kernel for active_simd_level(). Used to step tiles whose neighbours are not laid out in one grid.
+ *
+ * @example
+ *
+ *      // Step one 64x64 tile given the 66 rows of 3 words around it
+ *      std::uint64_t padded[66 * 3], tile[64];
+ *      step_padded_words(padded, 1, 64, tile, 1);
+ *
+ * @param padded
+ *      rows + 2 rows of span + 2 words. The first and last rows are the rows above and below the block,
+ *      and the first and last word of each row are the words to its west and east.
+ *
+ * @param span
+ *      The width of the block in words.
+ *
+ * @param rows
+ *      The height of the block in rows.
+ *
+ * @param target
+ *      Where to write the first row of the block, span words.
+ *
+ * @param stride
+ *      The distance in words between the starts of consecutive rows of target.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step with. Defaults to Conway's Game of Life.
+ */
+void step_padded_words(std::uint64_t const * padded, unsigned int span, unsigned int rows,
+                       std::uint64_t * target, std::size_t stride, Rule const & rule)
+{
+    BitRowKernel const kernel = bit_row_kernel(rule.get_mask(), active_simd_level());
+
+    for(unsigned int r = 0; r < rows; r++)
+    {
+        kernel(padded + r * (span + 2) + 1, padded + (r + 1) * (span + 2) + 1, padded + (r + 2) * (span + 2) + 1,
+               target + r * stride, span, rule.get_mask());
+    }
+}
+
+
+/**
+ * step_bits_tile(curr, next, toroidal, tx, ty)
+ *
+ * Advance the tile of words [tx * STEP_TILE_WORDS, (tx + 1) * STEP_TILE_WORDS) and rows
+ * [ty * STEP_TILE_ROWS, (ty + 1) * STEP_TILE_ROWS) of curr by one generation, writing it to next.
+ * Tiles on the right and bottom edges may be smaller. Reads only from curr and writes only the tile's words of next,
+ * so different tiles of the same grids can be stepped independently.
+ *
+ * @param curr
+ *      The current state.
+ *
+ * @param next
+ *      The grid to write the next state to, the same size as curr.
+ *
+ * @param toroidal
+ *      If true then the left edge wraps to the right edge and the top to the bottom.
+ *
+ * @param tx
+ *      The tile's column. Must be less than the words per row divided by STEP_TILE_WORDS, rounded up.
+ *
+ * @param ty
+ *      The tile's row. Must be less than the height divided by STEP_TILE_ROWS, rounded up.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step with. Defaults to Conway's Game of Life.
+ *
+ * @return
+ *      True if the tile's next state differs from its current state.
+ */
+bool step_bits_tile(BitGrid const & curr, BitGrid & next, bool toroidal, unsigned int tx, unsigned int ty, Rule const & rule)
+{
+    unsigned int const height = curr.get_height();
+    unsigned int const words = curr.get_words_per_row();
+
+    unsigned int const y0 = ty * STEP_TILE_ROWS;
+    unsigned int const rows = std::min(height - y0, (unsigned int)STEP_TILE_ROWS);
+    unsigned int const w0 = tx * STEP_TILE_WORDS;
+    unsigned int const span = std::min(words - w0, (unsigned int)STEP_TILE_WORDS);
+
+    //A tile stays dead if its words, the words either side (wrapping in toroidal mode) and the rows above and below are all dead,
+    //unless the rule gives birth on 0 neighbours.
+    unsigned int const west = (w0 > 0) ? w0 - 1 : (toroidal ? words - 1 : 0);
+    unsigned int const east = (w0 + span < words) ? w0 + span : (toroidal ? 0 : words - 1);
+    std::uint64_t any = 0;
+
+    for(unsigned int r = 0; r < rows + 2 && any == 0 && !rule.births(0); r++)
+    {
+        int const y = source_row((int)(y0 + r) - 1, (int)height, toroidal);
+        if(y < 0)
+        {
+            continue;
+        }
+
+        std::uint64_t const * source = curr.row((unsigned int)y);
+        any = source[west] | source[east];
+        for(unsigned int i = 0; i < span; i++)
+        {
+            any |= source[w0 + i];
+        }
+    }
+
+    if(any == 0 && !rule.births(0))
+    {
+        for(unsigned int r = 0; r < rows; r++)
+        {
+            std::fill(next.row(y0 + r) + w0, next.row(y0 + r) + w0 + span, 0);
+        }
+        return false;
+    }
+
+    //The tile's words of every row it reads, including the rows above and below, each with a ghost word either side.
+    std::uint64_t padded[(STEP_TILE_ROWS + 2) * (STEP_TILE_WORDS + 2)];
+
+    for(unsigned int r = 0; r < rows + 2; r++)
+    {
+        std::uint64_t * target = padded + r * (span + 2);
+        int const y = source_row((int)(y0 + r) - 1, (int)height, toroidal);
+
+        if(y < 0)
+        {
+            std::fill(target, target + span + 2, 0);
+            continue;
+        }
+
+        std::uint64_t const * source = curr.row((unsigned int)y);
+        std::memcpy(target + 1, source + w0, span * sizeof(std::uint64_t));
+
+        //Only the ghosts and the grid's last word can differ from the row itself.
+        target[0] = padded_word(curr, source, toroidal, (int)w0 - 1);
+        target[span + 1] = padded_word(curr, source, toroidal, (int)(w0 + span));
+        if(w0 + span == words)
+        {
+            target[span] = padded_word(curr, source, toroidal, (int)(w0 + span) - 1);
+        }
+    }
+
+    step_padded_words(padded, span, rows, next.row(y0) + w0, words, rule);
+
+    bool const last = (w0 + span == words);
+    std::uint64_t const mask = curr.last_word_mask();
+    std::uint64_t changed = 0;
+
+    for(unsigned int r = 0; r < rows; r++)
+    {
+        std::uint64_t * target = next.row(y0 + r) + w0;
+        std::uint64_t const * source = curr.row(y0 + r) + w0;
+
+        if(last)
+        {
+            target[span - 1] &= mask;
+        }
+
+        //Once any row has changed the rest need not be compared.
+        for(unsigned int i = 0; i < span && changed == 0; i++)
+        {
+            changed |= target[i] ^ source[i];
+        }
+    }
+
+    return changed != 0;
+}
+
+
+/**
+ * Folds one word of a tile into its running hash. Each word goes through a multiply, so the hash depends on
+ * where in the tile a word is as well as on its bits.
+ */
+static inline std::uint64_t hash_word(std::uint64_t hash, std::uint64_t word)
+{
+    hash = (hash ^ word) * 0x9E3779B97F4A7C15ULL;
+    return hash ^ (hash >> 29);
+}
+
+/**
+ * The MurmurHash3 finalizer, mixing every bit of a word into every bit of the result.
+ */
+static inline std::uint64_t mix_hash(std::uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    return hash ^ (hash >> 33);
+}
+
+
+/**
+ * hash_bits_tile(grid, tx, ty)
+ *
+ * Hash the cells of one tile of a packed grid, the same tiles as step_bits_tile. The hash starts from the tile's
+ * position, so equal tiles in different places hash differently and the XOR of the hashes of every tile is a hash
+ * of the whole grid. When one tile changes the grid's hash is updated by XORing out its old hash and in its new one.
+ *
+ * @param grid
+ *      The grid to hash.
+ *
+ * @param tx
+ *      The tile's column. Must be less than the words per row divided by STEP_TILE_WORDS, rounded up.
+ *
+ * @param ty
+ *      The tile's row. Must be less than the height divided by STEP_TILE_ROWS, rounded up.
+ *
+ * @return
+ *      The tile's 64 bit hash, equal to hash_cells_tile of a Grid holding the same cells.
+ */
+std::uint64_t hash_bits_tile(BitGrid const & grid, unsigned int tx, unsigned int ty)
+{
+    unsigned int const y0 = ty * STEP_TILE_ROWS;
+    unsigned int const y1 = std::min(grid.get_height(), y0 + STEP_TILE_ROWS);
+    unsigned int const w0 = tx * STEP_TILE_WORDS;
+    unsigned int const w1 = std::min(grid.get_words_per_row(), w0 + STEP_TILE_WORDS);
+
+    std::uint64_t hash = mix_hash((std::uint64_t(ty) << 32) | tx);
+
+    for(unsigned int y = y0; y < y1; y++)
+    {
+        std::uint64_t const * source = grid.row(y);
+        for(unsigned int w = w0; w < w1; w++)
+        {
+            hash = hash_word(hash, source[w]);
+        }
+    }
+
+    return mix_hash(hash);
+}
+
+
+/**
+ * hash_cells_tile(grid, tx, ty)
+ *
+ * Hash the cells of one tile of a byte per cell grid, packing each 64 cells into a word as a BitGrid holds them,
+ * so a Grid and a BitGrid of the same cells have the same tile hashes, see hash_bits_tile(grid, tx, ty).
+ */
+std::uint64_t hash_cells_tile(Grid const & grid, unsigned int tx, unsigned int ty)
+{
+    unsigned int const width = grid.get_width();
+    unsigned int const words = (width + BITGRID_WORD_BITS - 1) / BITGRID_WORD_BITS;
+
+    unsigned int const y0 = ty * STEP_TILE_ROWS;
+    unsigned int const y1 = std::min(grid.get_height(), y0 + STEP_TILE_ROWS);
+    unsigned int const w0 = tx * STEP_TILE_WORDS;
+    unsigned int const w1 = std::min(words, w0 + STEP_TILE_WORDS);
+
+    std::uint64_t hash = mix_hash((std::uint64_t(ty) << 32) | tx);
+
+    for(unsigned int y = y0; y < y1; y++)
+    {
+        Cell const * source = grid.row(y);
+        for(unsigned int w = w0; w < w1; w++)
+        {
+            unsigned int const x0 = w * BITGRID_WORD_BITS;
+            unsigned int const x1 = std::min(width, x0 + BITGRID_WORD_BITS);
+            std::uint64_t word = 0;
+            unsigned int x = x0;
+
+            //The low bit of each cell is its state, gathered 8 cells at a time into a byte.
+            for(; x + 8 <= x1; x += 8)
+            {
+                std::uint64_t cells;
+                std::memcpy(&cells, source + x, sizeof(cells));
+                word |= (((cells & 0x0101010101010101ULL) * 0x0102040810204080ULL) >> 56) << (x - x0);
+            }
+
+            for(; x < x1; x++)
+            {
+                word |= std::uint64_t(std::uint8_t(source[x]) & 1) << (x - x0);
+            }
+
+            hash = hash_word(hash, word);
+        }
+    }
+
+    return mix_hash(hash);
+}
+
+
+/**
+ * step_bits_swar(curr, next, toroidal, y0, y1, rule)
+ *
+ * Advance rows [y0, y1) of curr by one generation with the portable scalar kernel, writing them to next. Reads only from curr, so disjoint row ranges of the same
+ * grids can be stepped independently.
+ *
+ * @param curr
+ *      The current state.
+ *
+ * @param next
+ *      The grid to write the next state to, the same size as curr.
+ *
+ * @param toroidal
+ *      If true then the left edge wraps to the right edge and the top to the bottom.
+ *
+ * @param y0
+ *      The first row to compute.
+ *
+ * @param y1
+ *      One past the last row to compute.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step with. Defaults to Conway's Game of Life.
+ */
+void step_bits_swar(BitGrid const & curr, BitGrid & next, bool toroidal, unsigned int y0, unsigned int y1, Rule const & rule)
+{
+    step_bit_rows(curr, next, toroidal, y0, y1, bit_row_kernel(rule.get_mask(), SimdLevel::Scalar), rule.get_mask());
+}
+
+
+/**
+ * step_bits(curr, next, toroidal, y0, y1, rule)
+ *
+ * Advance rows [y0, y1) of curr by one generation, as step_bits_swar, using the widest kernel
+ * for active_simd_level().
+ */
+void step_bits(BitGrid const & curr, BitGrid & next, bool toroidal, unsigned int y0, unsigned int y1, Rule const & rule)
+{
+    step_bit_rows(curr, next, toroidal, y0, y1, bit_row_kernel(rule.get_mask(), active_simd_level()), rule.get_mask());
+}
+
+
+/**
+ * step_bits_generations(curr, next, toroidal, y0, y1, generations, rule)
+ *
+ * Advance rows [y0, y1) of curr by several generations at once, writing them to next. The band and the generations
+ * rows either side of it, which are all the rows its cells can depend on, are copied into two scratch buffers and
+ * stepped back and forth between them, each generation one row shorter at each end, until the last generation
+ * writes the band to next. A band whose buffers fit in cache is read from and written to memory once for all
+ * the generations rather than once per generation, at the cost of recomputing the overlapping rows of neighbouring bands.
+ * Reads only from curr, so disjoint row ranges of the same grids can be stepped independently.
+ *
+ * @example
+ *
+ *      // Advance a grid 8 generations in bands of 64 rows
+ *      for(unsigned int y = 0; y < height; y += 64)
+ *      {
+ *          step_bits_generations(curr, next, false, y, std::min(y + 64, height), 8);
+ *      }
+ *
+ * @param curr
+ *      The current state.
+ *
+ * @param next
+ *      The grid to write the state generations later to, the same size as curr.
+ *
+ * @param toroidal
+ *      If true then the left edge wraps to the right edge and the top to the bottom.
+ *
+ * @param y0
+ *      The first row to compute.
+ *
+ * @param y1
+ *      One past the last row to compute.
+ *
+ * @param generations
+ *      The number of generations to advance. The scratch buffers hold y1 - y0 + 2 * generations rows.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step with. Defaults to Conway's Game of Life.
+ */
+void step_bits_generations(BitGrid const & curr, BitGrid & next, bool toroidal, unsigned int y0, unsigned int y1,
+                           unsigned int generations, Rule const & rule)
+{
+    unsigned int const width = curr.get_width();
+    unsigned int const words = curr.get_words_per_row();
+    int const height = (int)curr.get_height();
+
+    if(words == 0 || y0 >= y1)
+    {
+        return;
+    }
+
+    if(generations == 0)
+    {
+        for(unsigned int y = y0; y < y1; y++)
+        {
+            std::memcpy(next.row(y), curr.row(y), words * sizeof(std::uint64_t));
+        }
+        return;
+    }
+
+    BitRowKernel const kernel = bit_row_kernel(rule.get_mask(), active_simd_level());
+    std::uint64_t const mask = curr.last_word_mask();
+
+    std::size_t const span = words + 2;
+    unsigned int const rows = (y1 - y0) + 2 * generations;
+
+    //Row r of the buffers is row y0 - generations + r of the grid. The buffers are kept for the thread's next band.
+    static thread_local std::vector<std::uint64_t> scratch;
+    if(scratch.size() < 2 * rows * span)
+    {
+        scratch.resize(2 * rows * span);
+    }
+
+    std::uint64_t * from = &scratch[0];
+    std::uint64_t * to = from + rows * span;
+
+    for(unsigned int r = 0; r < rows; r++)
+    {
+        int y = (int)y0 - (int)generations + (int)r;
+        if(toroidal)
+        {
+            //The band and its rows either side may wrap round a short grid more than once.
+            y = ((y % height) + height) % height;
+        }
+
+        load_padded_row(curr, y, toroidal, from + r * span);
+    }
+
+    for(unsigned int t = 1; t <= generations; t++)
+    {
+        for(unsigned int r = t; r < rows - t; r++)
+        {
+            std::uint64_t const * centre = from + r * span + 1;
+            int const y = (int)y0 - (int)generations + (int)r;
+
+            if(t == generations)
+            {
+                std::uint64_t * target = next.row((unsigned int)y);
+
+                kernel(centre - span, centre, centre + span, target, words, rule.get_mask());
+                target[words - 1] &= mask;
+                continue;
+            }
+
+            std::uint64_t * target = to + r * span;
+
+            //Rows beyond a bounded grid stay dead.
+            if(!toroidal && (y < 0 || y >= height))
+            {
+                std::fill(target, target + span, 0);
+                continue;
+            }
+
+            kernel(centre - span, centre, centre + span, target + 1, words, rule.get_mask());
+
+            target[0] = 0;
+            target[words] &= mask;
+            target[words + 1] = 0;
+
+            if(toroidal)
+            {
+                wrap_padded_row(target, width, words);
+            }
+        }
+
+        std::swap(from, to);
+    }
+}
+
+
+/**
+ * step_sliced(curr, next, width, height, rule)
+ *
+ * Advance 64 worlds of the same size stored bit sliced by one generation, bit k of every word being a cell of world k.
+ * The neighbours of a cell are the words around it, so the packed row kernels run on the rows unchanged, computing
+ * each word from its neighbours rather than from shifted words, and vectorize across the cells of a row.
+ *
+ * @example
+ *
+ *      // Step 64 16x16 bounded worlds, the halo of curr left zero
+ *      std::uint64_t curr[18 * 18] = { 0 }, next[18 * 18];
+ *      step_sliced(curr, next, 16, 16);
+ *
+ * @param curr
+ *      The current state, (width + 2) x (height + 2) words with cell (x, y) at (y + 1) * (width + 2) + x + 1.
+ *      The halo must hold the cells beyond the edges, zero in bounded mode and the opposite edge in toroidal mode.
+ *
+ * @param next
+ *      The frame to write the next state to, laid out as curr. Its halo is not written.
+ *
+ * @param width
+ *      The width of each world.
+ *
+ * @param height
+ *      The height of each world.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step with. Defaults to Conway's Game of Life.
+ */
+void step_sliced(std::uint64_t const * curr, std::uint64_t * next, unsigned int width, unsigned int height, Rule const & rule)
+{
+    BitRowKernel const kernel = sliced_row_kernel(rule.get_mask(), active_simd_level());
+    std::size_t const stride = width + 2;
+
+    for(unsigned int y = 1; y <= height; y++)
+    {
+        kernel(curr + (y - 1) * stride + 1, curr + y * stride + 1, curr + (y + 1) * stride + 1,
+               next + y * stride + 1, width, rule.get_mask());
+    }
+}
+
+
+/**
+ * step_bytes(curr, next, toroidal, y0, y1, rule)
+ *
+ * Advance rows [y0, y1) of a byte per cell grid by one generation, writing them to next,
+ * using the widest kernel for active_simd_level(). Reads only from curr, so disjoint row ranges
+ * of the same grids can be stepped independently.
+ *
+ * @param curr
+ *      The current state.
+ *
+ * @param next
+ *      The grid to write the next state to, the same size as curr.
+ *
+ * @param toroidal
+ *      If true then the left edge wraps to the right edge and the top to the bottom.
+ *
+ * @param y0
+ *      The first row to compute.
+ *
+ * @param y1
+ *      One past the last row to compute.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step with. Defaults to Conway's Game of Life.
+ */
+void step_bytes(Grid const & curr, Grid & next, bool toroidal, unsigned int y0, unsigned int y1, Rule const & rule)
+{
+    ByteRowKernel kernel = life_row_bytes_scalar;
+
+#if SIMD_X86
+    switch(active_simd_level())
+    {
+        case SimdLevel::AVX512: kernel = life_row_bytes_avx512; break;
+        case SimdLevel::AVX2:   kernel = life_row_bytes_avx2;   break;
+        default:                                                break;
+    }
+#endif
+
+    step_byte_rows(curr, next, toroidal, y0, y1, kernel, rule);
+}
+
+
+/**
+ * load_halo_rows(grid, toroidal, halo, y0, y1)
+ *
+ * Copy rows [y0, y1) of a grid into a halo buffer as 0/1 bytes, with their ghost cells. The band holding
+ * row 0 also fills the ghost row above the grid, and the band holding the last row the ghost row below it.
+ * Writes only rows of halo that belong to the band, so disjoint bands can be loaded independently.
+ *
+ * @example
+ *
+ *      // Step a grid through a halo buffer
+ *      std::vector<std::uint8_t> halo((grid.get_width() + 2) * (grid.get_height() + 2));
+ *      load_halo_rows(grid, toroidal, &halo[0], 0, grid.get_height());
+ *      step_halo_rows(&halo[0], next, 0, grid.get_height());
+ *
+ * @param grid
+ *      The current state.
+ *
+ * @param toroidal
+ *      If true the ghost cells and rows hold the cells from the opposite edge, otherwise they are zero.
+ *
+ * @param halo
+ *      (width + 2) x (height + 2) bytes, grid cell (x, y) is at halo[(y + 1) * (width + 2) + x + 1].
+ *
+ * @param y0
+ *      The first row to load.
+ *
+ * @param y1
+ *      One past the last row to load.
+ */
+void load_halo_rows(Grid const & grid, bool toroidal, std::uint8_t * halo, unsigned int y0, unsigned int y1)
+{
+    unsigned int const width = grid.get_width();
+    unsigned int const height = grid.get_height();
+    std::size_t const span = width + 2;
+
+    if(y0 == 0)
+    {
+        load_padded_cells(grid, -1, toroidal, halo);
+    }
+
+    for(unsigned int y = y0; y < y1; y++)
+    {
+        load_padded_cells(grid, (int)y, toroidal, halo + (y + 1) * span);
+    }
+
+    if(y1 == height)
+    {
+        load_padded_cells(grid, (int)height, toroidal, halo + (height + 1) * span);
+    }
+}
+
+
+/**
+ * step_halo_rows(halo, next, y0, y1, rule)
+ *
+ * Advance rows [y0, y1) of a grid loaded into a halo buffer by load_halo_rows, writing them to next.
+ * One cell at a time and branch free, the scalar counterpart of the byte kernels.
+ *
+ * @param halo
+ *      The padded 0/1 cells of the whole current state and its halo.
+ *
+ * @param next
+ *      The grid to write the next state to, the same size as the grid that was loaded.
+ *
+ * @param y0
+ *      The first row to compute.
+ *
+ * @param y1
+ *      One past the last row to compute.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step with. Defaults to Conway's Game of Life.
+ */
+void step_halo_rows(std::uint8_t const * halo, Grid & next, unsigned int y0, unsigned int y1, Rule const & rule)
+{
+    unsigned int const width = next.get_width();
+    std::size_t const span = width + 2;
+
+    std::uint8_t table[32];
+    rule_table(rule, table);
+
+    for(unsigned int y = y0; y < y1; y++)
+    {
+        life_row_bytes_scalar(halo + y * span, halo + (y + 1) * span, halo + (y + 2) * span, next.row(y), width, table);
+    }
+}
+
+
+/**
+ * block_table(rule, table)
+ *
+ * Fill a STEP_BLOCK_TABLE_SIZE entry table with the next state of the centre 2x2 cells of every 4x4 block of cells.
+ *
+ * @param rule
+ *      The rule to step with.
+ *
+ * @param table
+ *      STEP_BLOCK_TABLE_SIZE bytes. Bit 4r + c of the index is the cell in row r and column c of the block.
+ *      Bits 0 and 1 of the entry are the next state of cells (1, 1) and (2, 1), bits 2 and 3 of cells (1, 2) and (2, 2).
+ */
+void block_table(Rule const & rule, std::uint8_t * table)
+{
+    for(unsigned int block = 0; block < STEP_BLOCK_TABLE_SIZE; block++)
+    {
+        std::uint8_t result = 0;
+
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            unsigned int const cx = 1 + (i & 1);
+            unsigned int const cy = 1 + (i >> 1);
+            unsigned int count = 0;
+
+            for(unsigned int y = cy - 1; y <= cy + 1; y++)
+            {
+                for(unsigned int x = cx - 1; x <= cx + 1; x++)
+                {
+                    count += (block >> (4 * y + x)) & 1;
+                }
+            }
+
+            bool const alive = (block >> (4 * cy + cx)) & 1;
+            result |= std::uint8_t((rule.next(alive, count - (alive ? 1 : 0)) ? 1 : 0) << i);
+        }
+
+        table[block] = result;
+    }
+}
+
+
+/**
+ * block_row_bytes(width)
+ *
+ * The bytes per row of a block buffer for a grid of the given width, see load_block_rows.
+ */
+std::size_t block_row_bytes(unsigned int width)
+{
+    return std::size_t(width) / 8 + 3;
+}
+
+
+/**
+ * Pack row y of a grid into padded as bits, cell x at bit x + 8 and the ghost cells at bits 7 and width + 8,
+ * zero in bounded mode and the cells from the opposite end of the row in toroidal mode.
+ * Out of range rows follow the same rules as load_padded_row.
+ */
+static void load_block_row(Grid const & grid, int y, bool toroidal, std::uint8_t * padded)
+{
+    unsigned int const width = grid.get_width();
+
+    std::fill(padded, padded + block_row_bytes(width), 0);
+
+    y = source_row(y, (int)grid.get_height(), toroidal);
+    if(y < 0)
+    {
+        return;
+    }
+
+    //Cell::ALIVE is '#' (0x23) and Cell::DEAD is ' ' (0x20), so the low bit of each byte is the state.
+    //Multiplying the 0/1 bytes of 8 cells by this constant gathers them into the top byte, cell i in bit i.
+    Cell const * source = grid.row((unsigned int)y);
+    unsigned int x = 0;
+
+    for(; x + 8 <= width; x += 8)
+    {
+        std::uint64_t cells;
+        std::memcpy(&cells, source + x, sizeof(cells));
+        padded[x / 8 + 1] = std::uint8_t(((cells & 0x0101010101010101ULL) * 0x0102040810204080ULL) >> 56);
+    }
+
+    for(; x < width; x++)
+    {
+        padded[(x + 8) / 8] |= std::uint8_t((std::uint8_t(source[x]) & 1) << (x % 8));
+    }
+
+    if(toroidal && width > 0)
+    {
+        padded[0] = std::uint8_t((std::uint8_t(source[width - 1]) & 1) << 7);
+        padded[(width + 8) / 8] |= std::uint8_t((std::uint8_t(source[0]) & 1) << (width % 8));
+    }
+}
+
+
+/**
+ * load_block_rows(grid, toroidal, bits, y0, y1)
+ *
+ * Pack rows [y0, y1) of a grid into a block buffer with their ghost cells, for step_block_rows. The band holding
+ * row 0 also fills the ghost row above the grid, and the band holding the last row the two rows below it.
+ * Writes only rows of bits that belong to the band, so disjoint bands can be loaded independently.
+ *
+ * @example
+ *
+ *      // Step a grid through a block buffer
+ *      std::vector<std::uint8_t> table(STEP_BLOCK_TABLE_SIZE);
+ *      std::vector<std::uint8_t> bits(block_row_bytes(grid.get_width()) * (grid.get_height() + 3));
+ *      block_table(Rule(), &table[0]);
+ *      load_block_rows(grid, toroidal, &bits[0], 0, grid.get_height());
+ *      step_block_rows(&bits[0], &table[0], next, 0, grid.get_height());
+ *
+ * @param grid
+ *      The current state.
+ *
+ * @param toroidal
+ *      If true the ghost cells and rows hold the cells from the opposite edge, otherwise they are zero.
+ *
+ * @param bits
+ *      block_row_bytes(width) x (height + 3) bytes. Grid row y is row y + 1 of bits, and cell x is bit x + 8 of
+ *      the row, least significant bit first.
+ *
+ * @param y0
+ *      The first row to load.
+ *
+ * @param y1
+ *      One past the last row to load.
+ */
+void load_block_rows(Grid const & grid, bool toroidal, std::uint8_t * bits, unsigned int y0, unsigned int y1)
+{
+    unsigned int const height = grid.get_height();
+    std::size_t const span = block_row_bytes(grid.get_width());
+
+    if(y0 == 0)
+    {
+        load_block_row(grid, -1, toroidal, bits);
+    }
+
+    for(unsigned int y = y0; y < y1; y++)
+    {
+        load_block_row(grid, (int)y, toroidal, bits + (y + 1) * span);
+    }
+
+    //The last pair of rows of an odd height grid reads one row further, which is never written back.
+    if(y1 == height)
+    {
+        load_block_row(grid, (int)height, toroidal, bits + (height + 1) * span);
+        std::fill(bits + (height + 2) * span, bits + (height + 3) * span, 0);
+    }
+}
+
+
+/**
+ * The 4 cells from column x - 1 to x + 2 of a row of a block buffer.
+ */
+static inline unsigned int block_nibble(std::uint8_t const * row, unsigned int x)
+{
+    unsigned int const bit = x + 7;
+    std::uint16_t pair;
+    std::memcpy(&pair, row + bit / 8, sizeof(pair));
+    return (pair >> (bit % 8)) & 0xF;
+}
+
+
+/**
+ * step_block_rows(bits, table, next, y0, y1)
+ *
+ * Advance rows [y0, y1) of a grid loaded into a block buffer by load_block_rows, writing them to next.
+ * Each 2x2 block of cells is looked up in the block table by the 4x4 block around it, so one lookup steps 4 cells.
+ *
+ * @param bits
+ *      The packed cells of the whole current state and its ghost rows and cells.
+ *
+ * @param table
+ *      The table built by block_table for the rule to step with.
+ *
+ * @param next
+ *      The grid to write the next state to, the same size as the grid that was loaded.
+ *
+ * @param y0
+ *      The first row to compute.
+ *
+ * @param y1
+ *      One past the last row to compute.
+ */
+void step_block_rows(std::uint8_t const * bits, std::uint8_t const * table, Grid & next, unsigned int y0, unsigned int y1)
+{
+    unsigned int const width = next.get_width();
+    std::size_t const span = block_row_bytes(width);
+
+    //The two cells a pair of result bits stand for, as they are laid out in memory.
+    Cell const pairs[4][2] = { { Cell::DEAD, Cell::DEAD }, { Cell::ALIVE, Cell::DEAD },
+                               { Cell::DEAD, Cell::ALIVE }, { Cell::ALIVE, Cell::ALIVE } };
+
+    for(unsigned int y = y0; y < y1; y += 2)
+    {
+        //Rows y - 1 to y + 2 of the grid.
+        std::uint8_t const * r0 = bits + y * span;
+        std::uint8_t const * r1 = r0 + span;
+        std::uint8_t const * r2 = r1 + span;
+        std::uint8_t const * r3 = r2 + span;
+
+        Cell * top = next.row(y);
+        Cell * bottom = next.row((y + 1 < y1) ? y + 1 : y);
+
+        //An odd row at the end of the band computes the row below it too, but writes it over its own result first.
+        unsigned int x = 0;
+
+        //48 columns at a time, the 4 bit reads of 24 blocks all fall in one 64 bit word of each row.
+        for(; x + 48 <= width; x += 48)
+        {
+            std::uint64_t w0, w1, w2, w3;
+            std::memcpy(&w0, r0 + x / 8, sizeof(w0));
+            std::memcpy(&w1, r1 + x / 8, sizeof(w1));
+            std::memcpy(&w2, r2 + x / 8, sizeof(w2));
+            std::memcpy(&w3, r3 + x / 8, sizeof(w3));
+
+            for(unsigned int k = 0; k < 24; k++)
+            {
+                unsigned int const shift = 7 + 2 * k;
+                unsigned int const block = unsigned((w0 >> shift) & 0xF) | unsigned(((w1 >> shift) & 0xF) << 4)
+                                         | unsigned(((w2 >> shift) & 0xF) << 8) | unsigned(((w3 >> shift) & 0xF) << 12);
+                unsigned int const result = table[block];
+
+                std::memcpy(bottom + x + 2 * k, pairs[result >> 2], 2);
+                std::memcpy(top + x + 2 * k, pairs[result & 3], 2);
+            }
+        }
+
+        for(; x + 2 <= width; x += 2)
+        {
+            unsigned int const block = block_nibble(r0, x) | (block_nibble(r1, x) << 4)
+                                     | (block_nibble(r2, x) << 8) | (block_nibble(r3, x) << 12);
+            unsigned int const result = table[block];
+
+            std::memcpy(bottom + x, pairs[result >> 2], 2);
+            std::memcpy(top + x, pairs[result & 3], 2);
+        }
+
+        //An odd column at the end of the row.
+        if(x < width)
+        {
+            unsigned int const block = block_nibble(r0, x) | (block_nibble(r1, x) << 4)
+                                     | (block_nibble(r2, x) << 8) | (block_nibble(r3, x) << 12);
+            unsigned int const result = table[block];
+
+            bottom[x] = pairs[result >> 2][0];
+            top[x] = pairs[result & 3][0];
+        }
+    }
+}
+
+
+/**
+ * Loads 8 bytes as a word, byte i of memory in byte i of the word.
+ */
+static inline std::uint64_t load_bytes(std::uint8_t const * bytes)
+{
+    std::uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    return word;
+}
+
+/**
+ * Stores a word as 8 bytes, the inverse of load_bytes.
+ */
+static inline void store_bytes(std::uint8_t * bytes, std::uint64_t word)
+{
+    std::memcpy(bytes, &word, sizeof(word));
+}
+
+
+/**
+ * step_column_sums(curr, next, toroidal, y0, y1, rule)
+ *
+ * Advance rows [y0, y1) of a byte per cell grid by one generation, writing them to next, from running column sums.
+ * Each column's sum of its cells in the rows above, through and below the current row is kept in a row of bytes.
+ * Moving down a row subtracts the row leaving the sums and adds the row entering them, and each cell's count is
+ * then the sum of three neighbouring column sums, so a cell costs three additions and a rule lookup whatever the rule.
+ * The additions are done on 8 bytes at a time in 64 bit words, as no byte of a sum or count passes 24 none carries
+ * into the next, and the loops over words have no dependencies between iterations.
+ *
+ * @param curr
+ *      The current state.
+ *
+ * @param next
+ *      The grid to write the next state to, the same size as curr.
+ *
+ * @param toroidal
+ *      If true the left edge wraps to the right edge and the top to the bottom.
+ *
+ * @param y0
+ *      The first row to compute.
+ *
+ * @param y1
+ *      One past the last row to compute.
+ *
+ * @param rule
+ *      Optional parameter. The rule to step with. Defaults to Conway's Game of Life.
+ */
+void step_column_sums(Grid const & curr, Grid & next, bool toroidal, unsigned int y0, unsigned int y1, Rule const & rule)
+{
+    unsigned int const width = curr.get_width();
+    std::size_t const span = width + 2;
+
+    //Rows are rounded up to whole words, the bytes past the padded row stay zero.
+    std::size_t const words = (span + 7) / 8 + 1;
+    std::size_t const stride = words * 8;
+
+    if(y0 >= y1 || width == 0)
+    {
+        return;
+    }
+
+    std::uint8_t table[32];
+    rule_table(rule, table);
+
+    //Three padded 0/1 rows used in turn, and the column sums.
+    std::vector<std::uint8_t> scratch(4 * stride, 0);
+    std::uint8_t * rows[3] = { &scratch[0], &scratch[stride], &scratch[2 * stride] };
+    std::uint8_t * sums = &scratch[3 * stride];
+
+    load_padded_cells(curr, (int)y0 - 1, toroidal, rows[0]);
+    load_padded_cells(curr, (int)y0, toroidal, rows[1]);
+    load_padded_cells(curr, (int)y0 + 1, toroidal, rows[2]);
+
+    for(std::size_t x = 0; x < stride; x += 8)
+    {
+        store_bytes(sums + x, load_bytes(rows[0] + x) + load_bytes(rows[1] + x) + load_bytes(rows[2] + x));
+    }
+
+    for(unsigned int y = y0; y < y1; y++)
+    {
+        std::uint8_t const * centre = rows[(y - y0 + 1) % 3];
+        Cell * target = next.row(y);
+
+        //The 3x3 sum includes the cell itself, the table is indexed by state * 16 + neighbours.
+        unsigned int x = 0;
+        for(; x + 8 <= width; x += 8)
+        {
+            std::uint64_t const counts = load_bytes(sums + x) + load_bytes(sums + x + 1) + load_bytes(sums + x + 2)
+                                       + 15 * load_bytes(centre + x + 1);
+
+            for(unsigned int i = 0; i < 8; i++)
+            {
+                target[x + i] = Cell(Cell::DEAD | table[(counts >> (8 * i)) & 0xFF]);
+            }
+        }
+
+        for(; x < width; x++)
+        {
+            target[x] = Cell(Cell::DEAD | table[sums[x] + sums[x + 1] + sums[x + 2] + 15 * centre[x + 1]]);
+        }
+
+        //Slide the sums down a row, the row above leaves and its buffer takes the row two below.
+        if(y + 1 < y1)
+        {
+            std::uint8_t * leaving = rows[(y - y0) % 3];
+
+            for(std::size_t i = 0; i < stride; i += 8)
+            {
+                store_bytes(sums + i, load_bytes(sums + i) - load_bytes(leaving + i));
+            }
+
+            load_padded_cells(curr, (int)y + 2, toroidal, leaving);
+
+            for(std::size_t i = 0; i < stride; i += 8)
+            {
+                store_bytes(sums + i, load_bytes(sums + i) + load_bytes(leaving + i));
+            }
+        }
+    }
+}
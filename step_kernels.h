@@ -0,0 +1,132 @@
+/**
+ * Declares the step kernels used by World to advance a grid by one generation.
+ * Rich documentation for the kernels can be found in step_kernels.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include "grid.h"
+#include "bitgrid.h"
+#include "rule.h"
+
+/**
+ * Advance rows [y0, y1) of a packed grid by one generation of a life-like rule, Conway's Game of Life by default,
+ * writing them to next. next must be the same size as curr. Dispatches to the widest kernel for active_simd_level().
+ */
+void step_bits(BitGrid const & curr, BitGrid & next, bool toroidal, unsigned int y0, unsigned int y1,
+               Rule const & rule = Rule());
+
+/**
+ * The portable scalar kernel behind step_bits, computing 64 cells at a time with bitwise full adders.
+ */
+void step_bits_swar(BitGrid const & curr, BitGrid & next, bool toroidal, unsigned int y0, unsigned int y1,
+                    Rule const & rule = Rule());
+
+/**
+ * The size of the tiles stepped by step_bits_tile, 16 words (1024 cells, two cache lines per row) by 64 rows.
+ * Tiles on the right and bottom edges of a grid may be smaller.
+ */
+#define STEP_TILE_WORDS 16
+#define STEP_TILE_ROWS 64
+
+/**
+ * Advance tile (tx, ty) of a packed grid by one generation, writing it to next.
+ * Tiles whose cells and neighbouring cells are all dead are cleared without being computed, unless the rule has B0.
+ * Returns true if the tile changed.
+ */
+bool step_bits_tile(BitGrid const & curr, BitGrid & next, bool toroidal, unsigned int tx, unsigned int ty,
+                    Rule const & rule = Rule());
+
+/**
+ * A 64 bit hash of the cells of tile (tx, ty), the same tiles as step_bits_tile, that also depends on the tile's position.
+ * The XOR of the hashes of every tile of a grid is a hash of the grid. Both functions give the same hash for the same cells.
+ */
+std::uint64_t hash_bits_tile(BitGrid const & grid, unsigned int tx, unsigned int ty);
+std::uint64_t hash_cells_tile(Grid const & grid, unsigned int tx, unsigned int ty);
+
+/**
+ * Advance a block of span words by rows rows, gathered into padded with a ghost word either side and a ghost
+ * row above and below, writing it to rows of target stride words apart.
+ */
+void step_padded_words(std::uint64_t const * padded, unsigned int span, unsigned int rows,
+                       std::uint64_t * target, std::size_t stride, Rule const & rule = Rule());
+
+/**
+ * The number of generations World advances each band of rows by in one pass with step_bits_generations,
+ * and the cache budget for the scratch buffers of one band, which sets how many rows the bands have.
+ */
+#define STEP_TEMPORAL_GENERATIONS 8
+#define STEP_TEMPORAL_BAND_BYTES (512 * 1024)
+
+/**
+ * Advance rows [y0, y1) of a packed grid by generations generations of a life-like rule, Conway's Game of Life
+ * by default, writing them to next, with the band and the generations rows either side of it held in scratch
+ * buffers so the grid is read and written once. next must be the same size as curr.
+ */
+void step_bits_generations(BitGrid const & curr, BitGrid & next, bool toroidal, unsigned int y0, unsigned int y1,
+                           unsigned int generations, Rule const & rule = Rule());
+
+/**
+ * Advance 64 width x height worlds stored bit sliced, bit k of every word a cell of world k, by one generation
+ * of a life-like rule. curr and next are (width + 2) x (height + 2) words with a one cell halo, which must
+ * already be filled in curr. Only the cells of next are written. Dispatches to the widest kernel for active_simd_level().
+ */
+void step_sliced(std::uint64_t const * curr, std::uint64_t * next, unsigned int width, unsigned int height,
+                 Rule const & rule = Rule());
+
+/**
+ * Advance rows [y0, y1) of a byte per cell grid by one generation of a life-like rule, Conway's Game of Life
+ * by default, writing them to next. next must be the same size as curr. Dispatches to the widest kernel
+ * for active_simd_level().
+ */
+void step_bytes(Grid const & curr, Grid & next, bool toroidal, unsigned int y0, unsigned int y1,
+                Rule const & rule = Rule());
+
+/**
+ * Copy rows [y0, y1) of a grid into a (width + 2) x (height + 2) buffer of 0/1 bytes with a one cell halo,
+ * zero in bounded mode and wrapped in toroidal mode. The first and last bands also fill the ghost rows.
+ */
+void load_halo_rows(Grid const & grid, bool toroidal, std::uint8_t * halo, unsigned int y0, unsigned int y1);
+
+/**
+ * Advance rows [y0, y1) of a grid loaded by load_halo_rows by one generation, writing them to next.
+ * The scalar loop has no edge handling and no branches.
+ */
+void step_halo_rows(std::uint8_t const * halo, Grid & next, unsigned int y0, unsigned int y1,
+                    Rule const & rule = Rule());
+
+/**
+ * The number of entries in a block table, one for every 4x4 block of cells.
+ */
+#define STEP_BLOCK_TABLE_SIZE 65536
+
+/**
+ * Fill a STEP_BLOCK_TABLE_SIZE byte table with the next state of the centre 2x2 cells of every 4x4 block under a rule.
+ */
+void block_table(Rule const & rule, std::uint8_t * table);
+
+/**
+ * The bytes per row of the buffer load_block_rows packs a grid of the given width into.
+ */
+std::size_t block_row_bytes(unsigned int width);
+
+/**
+ * Pack rows [y0, y1) of a grid into a block_row_bytes(width) x (height + 3) buffer of bits with a one cell halo,
+ * zero in bounded mode and wrapped in toroidal mode. The first and last bands also fill the ghost rows.
+ */
+void load_block_rows(Grid const & grid, bool toroidal, std::uint8_t * bits, unsigned int y0, unsigned int y1);
+
+/**
+ * Advance rows [y0, y1) of a grid loaded by load_block_rows by one generation, writing them to next,
+ * looking up 2x2 cells at a time in a table built by block_table.
+ */
+void step_block_rows(std::uint8_t const * bits, std::uint8_t const * table, Grid & next, unsigned int y0, unsigned int y1);
+
+/**
+ * Advance rows [y0, y1) of a byte per cell grid by one generation of a life-like rule, Conway's Game of Life
+ * by default, writing them to next, from running column sums of three rows. next must be the same size as curr.
+ */
+void step_column_sums(Grid const & curr, Grid & next, bool toroidal, unsigned int y0, unsigned int y1,
+                      Rule const & rule = Rule());
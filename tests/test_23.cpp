@@ -0,0 +1,71 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <cstdint>
+
+#include "../grid.h"
+
+SCENARIO( "a grid stores its rows contiguously on cache line boundaries", "[grid][storage]" ) {
+
+    GIVEN( "a grid with size 100x3" ) {
+
+        Grid g(100, 3);
+
+        THEN( "the stride is the width rounded up to a whole cache line" ) {
+
+            REQUIRE( g.get_stride() == 128 );
+        }
+
+        THEN( "every row starts on a cache line and follows the previous row by the stride" ) {
+
+            for (unsigned int y = 0; y < g.get_height(); y++) {
+                REQUIRE( reinterpret_cast<std::uintptr_t>(g.row(y)) % CACHE_LINE_SIZE == 0 );
+                REQUIRE( g.row(y) == g.row(0) + y * g.get_stride() );
+            }
+        }
+
+        WHEN( "a cell is written through a row pointer" ) {
+
+            g.row(2)[99] = Cell::ALIVE;
+
+            THEN( "the cell is visible through the checked accessors" ) {
+
+                REQUIRE( g.get(99, 2) == Cell::ALIVE );
+                REQUIRE( g.get_alive_cells() == 1 );
+            }
+        }
+    }
+
+    GIVEN( "a grid with a live cell on its right edge" ) {
+
+        Grid g(5, 2);
+        g.set(4, 1, Cell::ALIVE);
+
+        WHEN( "the grid is resized narrower and then wider again" ) {
+
+            g.resize(3, 2);
+            g.resize(70, 4);
+
+            THEN( "the padding exposed by the resize is dead" ) {
+
+                REQUIRE( g.get_stride() == 128 );
+                REQUIRE( g.get_alive_cells() == 0 );
+                REQUIRE( g.get_dead_cells() == 70 * 4 );
+            }
+        }
+    }
+
+    GIVEN( "dimensions too large to pad to a cache line" ) {
+
+        THEN( "constructing the grid throws rather than allocating" ) {
+
+            REQUIRE_THROWS( Grid(4294967295u, 4294967288u) );
+        }
+    }
+
+} // SCENARIO
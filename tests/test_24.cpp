@@ -0,0 +1,154 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../zoo.h"
+#include "test_helpers.h"
+
+/**
+ * Compare a BitGrid and a Grid cell by cell.
+ */
+static bool same_cells(BitGrid const & packed, Grid const & grid)
+{
+    if (packed.get_width() != grid.get_width() || packed.get_height() != grid.get_height()) {
+        return false;
+    }
+
+    for (unsigned int y = 0; y < grid.get_height(); y++) {
+        for (unsigned int x = 0; x < grid.get_width(); x++) {
+            if (packed.get(x, y) != grid.get(x, y)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+SCENARIO( "a bit grid packs 64 cells per word and converts to and from a grid", "[bitgrid][constructor]" ) {
+
+    GIVEN( "a bit grid constructed with size 130x3" ) {
+
+        BitGrid b(130, 3);
+
+        THEN( "each row takes 3 words and every cell is dead" ) {
+
+            REQUIRE( b.get_words_per_row() == 3 );
+            REQUIRE( b.get_total_cells() == 390 );
+            REQUIRE( b.get_alive_cells() == 0 );
+            REQUIRE( b.get_dead_cells() == 390 );
+        }
+
+        THEN( "out of bounds coordinates throw" ) {
+
+            REQUIRE_THROWS( b.get(130, 0) );
+            REQUIRE_THROWS( b.set(0, 3, Cell::ALIVE) );
+        }
+    }
+
+    GIVEN( "a random 150x37 grid" ) {
+
+        Grid g = random_grid(150, 37, 1);
+
+        WHEN( "the grid is packed and unpacked" ) {
+
+            BitGrid b(g);
+
+            THEN( "the cells and population are unchanged" ) {
+
+                REQUIRE( same_cells(b, g) );
+                REQUIRE( b.get_alive_cells() == g.get_alive_cells() );
+                REQUIRE( same_cells(BitGrid(b.to_grid()), g) );
+            }
+        }
+    }
+}
+
+SCENARIO( "a bit grid can be cropped, merged, rotated and resized like a grid", "[bitgrid][crop][merge][rotate][resize]" ) {
+
+    GIVEN( "a random 150x37 grid and its packed copy" ) {
+
+        Grid g = random_grid(150, 37, 2);
+        BitGrid b(g);
+
+        THEN( "crops across word boundaries match" ) {
+
+            REQUIRE( same_cells(b.crop(3, 1, 140, 30), g.crop(3, 1, 140, 30)) );
+            REQUIRE( same_cells(b.crop(64, 0, 150, 37), g.crop(64, 0, 150, 37)) );
+            REQUIRE( same_cells(b.crop(63, 5, 65, 6), g.crop(63, 5, 65, 6)) );
+        }
+
+        THEN( "invalid crops throw" ) {
+
+            REQUIRE_THROWS( b.crop(0, 0, 151, 37) );
+            REQUIRE_THROWS( b.crop(10, 0, 5, 37) );
+        }
+
+        THEN( "rotations match" ) {
+
+            for (int rotation = -4; rotation <= 4; rotation++) {
+                REQUIRE( same_cells(b.rotate(rotation), g.rotate(rotation)) );
+            }
+        }
+
+        THEN( "resizes match" ) {
+
+            BitGrid narrower = b;
+            Grid narrower_grid = g;
+            narrower.resize(70, 40);
+            narrower_grid.resize(70, 40);
+            REQUIRE( same_cells(narrower, narrower_grid) );
+
+            narrower.resize(200, 10);
+            narrower_grid.resize(200, 10);
+            REQUIRE( same_cells(narrower, narrower_grid) );
+        }
+
+        WHEN( "another random grid is merged in at an unaligned offset" ) {
+
+            Grid other = random_grid(90, 20, 3);
+
+            BitGrid overwrite = b, alive_only = b;
+            Grid overwrite_grid = g, alive_only_grid = g;
+
+            overwrite.merge(BitGrid(other), 37, 9);
+            overwrite_grid.merge(other, 37, 9);
+            alive_only.merge(BitGrid(other), 37, 9, true);
+            alive_only_grid.merge(other, 37, 9, true);
+
+            THEN( "both kinds of merge match" ) {
+
+                REQUIRE( same_cells(overwrite, overwrite_grid) );
+                REQUIRE( same_cells(alive_only, alive_only_grid) );
+            }
+
+            THEN( "merging a grid that does not fit throws" ) {
+
+                REQUIRE_THROWS( overwrite.merge(BitGrid(other), 61, 0) );
+                REQUIRE_THROWS( overwrite.merge(BitGrid(other), 0, 18) );
+            }
+        }
+    }
+
+    GIVEN( "a packed glider" ) {
+
+        BitGrid b(Zoo::glider());
+
+        THEN( "it prints like the grid it came from" ) {
+
+            std::stringstream packed, unpacked;
+            packed << b;
+            unpacked << Zoo::glider();
+
+            REQUIRE( packed.str() == unpacked.str() );
+        }
+    }
+}
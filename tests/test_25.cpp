@@ -0,0 +1,82 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "test_helpers.h"
+
+SCENARIO( "the bitwise engine steps bit for bit like the reference engine", "[world][step][bitwise]" ) {
+
+    GIVEN( "random worlds with widths either side of whole words" ) {
+
+        unsigned int const widths[]  = { 1, 2, 3, 5, 63, 64, 65, 127, 128, 130 };
+        unsigned int const heights[] = { 1, 2, 3, 17 };
+
+        THEN( "bounded steps agree" ) {
+
+            for (unsigned int width : widths) {
+                for (unsigned int height : heights) {
+                    INFO( width << "x" << height );
+                    REQUIRE( engines_agree(random_grid(width, height, width * 31 + height), StepEngine::Bitwise, false, 8) );
+                }
+            }
+        }
+
+        THEN( "toroidal steps agree" ) {
+
+            for (unsigned int width : widths) {
+                for (unsigned int height : heights) {
+                    INFO( width << "x" << height );
+                    REQUIRE( engines_agree(random_grid(width, height, width * 37 + height), StepEngine::Bitwise, true, 8) );
+                }
+            }
+        }
+    }
+
+    GIVEN( "a world constructed from a packed grid" ) {
+
+        World w(BitGrid(random_grid(100, 50, 7)));
+
+        THEN( "it steps with the bitwise engine and keeps its size and population" ) {
+
+            REQUIRE( w.get_engine() == StepEngine::Bitwise );
+            REQUIRE( w.get_width() == 100 );
+            REQUIRE( w.get_height() == 50 );
+            REQUIRE( w.get_alive_cells() == BitGrid(random_grid(100, 50, 7)).get_alive_cells() );
+        }
+
+        WHEN( "the engine is switched back and forth between steps" ) {
+
+            World reference(random_grid(100, 50, 7));
+
+            for (int i = 0; i < 6; i++) {
+                w.set_engine(i % 2 ? StepEngine::Reference : StepEngine::Bitwise);
+                w.step(true);
+                reference.step(true);
+            }
+
+            THEN( "the state matches a world that only used the reference engine" ) {
+
+                REQUIRE( BitGrid(w.get_state()) == BitGrid(reference.get_state()) );
+            }
+        }
+    }
+
+    GIVEN( "the command line names of the engines" ) {
+
+        THEN( "they parse and print symmetrically" ) {
+
+            REQUIRE( parse_step_engine("bitwise") == StepEngine::Bitwise );
+            REQUIRE( to_string(parse_step_engine("reference")) == "reference" );
+            REQUIRE_THROWS( parse_step_engine("quantum") );
+        }
+    }
+}
@@ -0,0 +1,59 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../cpu_features.h"
+#include "test_helpers.h"
+
+SCENARIO( "the vectorized engines step like the reference engine at every SIMD level", "[world][step][simd]" ) {
+
+    GIVEN( "random worlds wide enough to fill whole vectors with a remainder" ) {
+
+        unsigned int const widths[]  = { 3, 31, 33, 64, 65, 200, 513, 700 };
+        SimdLevel const levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+
+        for (SimdLevel level : levels) {
+
+            if ((int)level > (int)detected_simd_level()) {
+                continue;
+            }
+
+            set_simd_level(level);
+
+            THEN( "the bytewise and bitwise engines agree in both topologies at " + to_string(level) ) {
+
+                for (unsigned int width : widths) {
+                    for (int toroidal = 0; toroidal < 2; toroidal++) {
+                        INFO( to_string(level) << " " << width << "x" << 19 << (toroidal ? " toroidal" : " bounded") );
+                        Grid initial = random_grid(width, 19, width + toroidal);
+                        REQUIRE( engines_agree(initial, StepEngine::Bytewise, toroidal, 6) );
+                        REQUIRE( engines_agree(initial, StepEngine::Bitwise, toroidal, 6) );
+                    }
+                }
+            }
+        }
+
+        set_simd_level(detected_simd_level());
+    }
+
+    GIVEN( "a request for a wider level than the CPU has" ) {
+
+        set_simd_level(SimdLevel::AVX512);
+
+        THEN( "the active level is clamped to the detected level" ) {
+
+            REQUIRE( active_simd_level() == detected_simd_level() );
+            REQUIRE( parse_simd_level(to_string(active_simd_level())) == active_simd_level() );
+            REQUIRE_THROWS( parse_simd_level("sse9") );
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <atomic>
+#include <random>
+#include <stdexcept>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../thread_pool.h"
+#include "test_helpers.h"
+
+SCENARIO( "a thread pool runs every index of a loop exactly once", "[thread_pool]" ) {
+
+    GIVEN( "a pool of 4 threads" ) {
+
+        ThreadPool pool(4);
+
+        THEN( "it reports its size including the calling thread" ) {
+
+            REQUIRE( pool.get_threads() == 4 );
+        }
+
+        WHEN( "many loops are run back to back" ) {
+
+            std::vector<std::atomic<unsigned int> > hits(1000);
+            for (auto & hit : hits) {
+                hit = 0;
+            }
+
+            for (int loop = 0; loop < 50; loop++) {
+                pool.parallel_for(1000, [&](unsigned int i) { hits[i]++; });
+            }
+
+            THEN( "every index ran once per loop" ) {
+
+                for (auto & hit : hits) {
+                    REQUIRE( hit == 50 );
+                }
+            }
+        }
+
+        WHEN( "a task throws" ) {
+
+            THEN( "the exception reaches the caller and the pool is still usable" ) {
+
+                REQUIRE_THROWS_AS( pool.parallel_for(100, [](unsigned int i) {
+                    if (i == 42) {
+                        throw std::runtime_error("task failed");
+                    }
+                }), std::runtime_error );
+
+                std::atomic<unsigned int> count(0);
+                pool.parallel_for(100, [&](unsigned int) { count++; });
+                REQUIRE( count == 100 );
+            }
+        }
+    }
+}
+
+SCENARIO( "a world stepped on several threads matches a single threaded world", "[world][step][threads]" ) {
+
+    GIVEN( "a random world taller than several bands" ) {
+
+        Grid initial = random_grid(300, 257, 11);
+        StepEngine const engines[] = { StepEngine::Reference, StepEngine::Bytewise, StepEngine::Bitwise };
+
+        for (StepEngine engine : engines) {
+            for (int toroidal = 0; toroidal < 2; toroidal++) {
+
+                World single(initial), threaded(initial);
+                single.set_engine(engine);
+                threaded.set_engine(engine);
+                threaded.set_threads(4);
+
+                single.advance(5, toroidal);
+                threaded.advance(5, toroidal);
+
+                THEN( "the " + to_string(engine) + (toroidal ? " toroidal" : " bounded") + " states are identical" ) {
+
+                    REQUIRE( threaded.get_threads() == 4 );
+                    REQUIRE( BitGrid(threaded.get_state()) == BitGrid(single.get_state()) );
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,146 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../thread_pool.h"
+#include "test_helpers.h"
+
+SCENARIO( "a work stealing pool runs uneven loops exactly once per index", "[thread_pool]" ) {
+
+    GIVEN( "a pool of 4 threads" ) {
+
+        ThreadPool pool(4);
+
+        WHEN( "all the slow indices start out on one thread" ) {
+
+            std::vector<std::atomic<unsigned int> > hits(97);
+            for (auto & hit : hits) {
+                hit = 0;
+            }
+
+            pool.parallel_for(97, [&](unsigned int i) {
+                if (i < 24) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                }
+                hits[i]++;
+            });
+
+            THEN( "every index ran once" ) {
+
+                for (auto & hit : hits) {
+                    REQUIRE( hit == 1 );
+                }
+            }
+        }
+
+        WHEN( "a loop has fewer indices than threads" ) {
+
+            std::atomic<unsigned int> count(0);
+            pool.parallel_for(3, [&](unsigned int) { count++; });
+            pool.parallel_for(0, [&](unsigned int) { count++; });
+
+            THEN( "only those indices run" ) {
+
+                REQUIRE( count == 3 );
+            }
+        }
+    }
+}
+
+SCENARIO( "the tiled engine matches the bitwise engine", "[world][step][tiled]" ) {
+
+    GIVEN( "random worlds with partial tiles on the right and bottom" ) {
+
+        unsigned int const sizes[][2] = { {1, 1}, {2, 3}, {63, 65}, {64, 64}, {65, 130}, {129, 63}, {200, 191}, {1100, 70}, {1024, 129}, {2100, 129} };
+
+        for (auto const & size : sizes) {
+            for (int toroidal = 0; toroidal < 2; toroidal++) {
+
+                Grid initial = random_grid(size[0], size[1], size[0] * 31 + size[1]);
+                World bitwise(initial), tiled(initial);
+                bitwise.set_engine(StepEngine::Bitwise);
+                tiled.set_engine(StepEngine::Tiled);
+
+                bool same = true;
+                for (int generation = 0; generation < 8 && same; generation++) {
+                    bitwise.step(toroidal);
+                    tiled.step(toroidal);
+                    same = tiled.get_packed_state() == bitwise.get_packed_state();
+                }
+
+                THEN( "every generation of the " + std::to_string(size[0]) + "x" + std::to_string(size[1])
+                      + (toroidal ? " toroidal" : " bounded") + " world is identical" ) {
+
+                    REQUIRE( same );
+                }
+            }
+        }
+    }
+
+    GIVEN( "a mostly empty world with a glider crossing tile edges and wrapping around" ) {
+
+        //The glider sits across the corner where four tiles meet.
+        Grid initial(2200, 200);
+        initial.set(1023, 62, Cell::ALIVE);
+        initial.set(1024, 63, Cell::ALIVE);
+        initial.set(1022, 64, Cell::ALIVE);
+        initial.set(1023, 64, Cell::ALIVE);
+        initial.set(1024, 64, Cell::ALIVE);
+
+        World bitwise(initial), tiled(initial);
+        bitwise.set_engine(StepEngine::Bitwise);
+        tiled.set_engine(StepEngine::Tiled);
+        tiled.set_threads(3);
+
+        bool same = true;
+        for (int generation = 0; generation < 2500 && same; generation++) {
+            bitwise.step(true);
+            tiled.step(true);
+            same = tiled.get_packed_state() == bitwise.get_packed_state();
+        }
+
+        THEN( "the worlds agree and the glider survives" ) {
+
+            REQUIRE( same );
+            REQUIRE( tiled.get_alive_cells() == 5 );
+        }
+    }
+
+    GIVEN( "a random world stepped on several threads" ) {
+
+        Grid initial = random_grid(2500, 300, 5);
+        World single(initial), threaded(initial);
+        single.set_engine(StepEngine::Bitwise);
+        threaded.set_engine(StepEngine::Tiled);
+        threaded.set_threads(4);
+
+        single.advance(10, true);
+        threaded.advance(10, true);
+
+        THEN( "the states are identical" ) {
+
+            REQUIRE( threaded.get_packed_state() == single.get_packed_state() );
+        }
+    }
+
+    GIVEN( "the engine name" ) {
+
+        THEN( "it parses and prints as tiled" ) {
+
+            REQUIRE( parse_step_engine("tiled") == StepEngine::Tiled );
+            REQUIRE( to_string(StepEngine::Tiled) == "tiled" );
+        }
+    }
+}
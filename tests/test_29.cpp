@@ -0,0 +1,212 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+
+static void add_glider(Grid & grid, unsigned int x, unsigned int y)
+{
+    grid.set(x + 1, y, Cell::ALIVE);
+    grid.set(x + 2, y + 1, Cell::ALIVE);
+    grid.set(x, y + 2, Cell::ALIVE);
+    grid.set(x + 1, y + 2, Cell::ALIVE);
+    grid.set(x + 2, y + 2, Cell::ALIVE);
+}
+
+static void add_soup(Grid & grid, unsigned int x0, unsigned int y0, unsigned int size, unsigned int seed)
+{
+    std::mt19937 rng(seed);
+
+    for (unsigned int y = y0; y < y0 + size; y++) {
+        for (unsigned int x = x0; x < x0 + size; x++) {
+            grid.set(x, y, (rng() % 3 == 0) ? Cell::ALIVE : Cell::DEAD);
+        }
+    }
+}
+
+SCENARIO( "the tiled engine only recomputes tiles near changes", "[world][step][tiled]" ) {
+
+    GIVEN( "a world of 3x4 tiles" ) {
+
+        Grid initial(3 * 1024, 4 * 64);
+
+        THEN( "it reports its tiles, and no active tiles before stepping" ) {
+
+            World world(initial);
+            REQUIRE( world.get_tiles() == 12 );
+            REQUIRE( world.get_active_tiles() == 0 );
+        }
+
+        WHEN( "the world is empty" ) {
+
+            World world(initial);
+            world.set_engine(StepEngine::Tiled);
+            world.step();
+            unsigned int const first = world.get_active_tiles();
+            world.step();
+
+            THEN( "the first step recomputes every tile and the next recomputes none" ) {
+
+                REQUIRE( first == 12 );
+                REQUIRE( world.get_active_tiles() == 0 );
+            }
+        }
+
+        WHEN( "the world holds only a block" ) {
+
+            initial.set(1500, 100, Cell::ALIVE);
+            initial.set(1501, 100, Cell::ALIVE);
+            initial.set(1500, 101, Cell::ALIVE);
+            initial.set(1501, 101, Cell::ALIVE);
+
+            World world(initial);
+            world.set_engine(StepEngine::Tiled);
+            world.advance(3);
+
+            THEN( "it settles to no active tiles and keeps the block" ) {
+
+                REQUIRE( world.get_active_tiles() == 0 );
+                REQUIRE( world.get_alive_cells() == 4 );
+            }
+        }
+
+        WHEN( "the world holds a glider in the middle of one tile" ) {
+
+            add_glider(initial, 1500, 100);
+
+            World world(initial);
+            world.set_engine(StepEngine::Tiled);
+            world.advance(4);
+
+            THEN( "only that tile and its eight neighbours are recomputed" ) {
+
+                REQUIRE( world.get_active_tiles() == 9 );
+                REQUIRE( world.get_alive_cells() == 5 );
+            }
+        }
+
+        WHEN( "the same world is stepped with the bitwise engine" ) {
+
+            World world(initial);
+            world.set_engine(StepEngine::Bitwise);
+            world.step();
+
+            THEN( "every tile counts as recomputed" ) {
+
+                REQUIRE( world.get_active_tiles() == 12 );
+            }
+        }
+    }
+}
+
+SCENARIO( "skipping tiles never changes the generations", "[world][step][tiled]" ) {
+
+    GIVEN( "a sparse world with gliders crossing tile edges and a soup settling" ) {
+
+        Grid initial(5000, 640);
+        add_glider(initial, 1020, 60);
+        add_glider(initial, 4990, 630);
+        add_glider(initial, 10, 200);
+        add_soup(initial, 400, 100, 80, 3);
+
+        for (int toroidal = 0; toroidal < 2; toroidal++) {
+
+            World bitwise(initial), tiled(initial);
+            bitwise.set_engine(StepEngine::Bitwise);
+            tiled.set_engine(StepEngine::Tiled);
+            tiled.set_threads(3);
+
+            bool same = true;
+            unsigned int fewest = tiled.get_tiles();
+
+            for (int generation = 0; generation < 600 && same; generation++) {
+                bitwise.step(toroidal);
+                tiled.step(toroidal);
+                same = tiled.get_packed_state() == bitwise.get_packed_state();
+
+                if (generation > 0) {
+                    fewest = std::min(fewest, tiled.get_active_tiles());
+                }
+            }
+
+            THEN( std::string("every ") + (toroidal ? "toroidal" : "bounded") + " generation is identical and tiles were skipped" ) {
+
+                REQUIRE( same );
+                REQUIRE( fewest < tiled.get_tiles() );
+            }
+        }
+    }
+
+    GIVEN( "a tiled world that is changed between steps" ) {
+
+        Grid initial(2100, 130);
+        add_glider(initial, 100, 10);
+
+        World bitwise(initial), tiled(initial);
+        bitwise.set_engine(StepEngine::Bitwise);
+        tiled.set_engine(StepEngine::Tiled);
+        tiled.advance(8);
+        bitwise.advance(8);
+
+        WHEN( "its state is edited" ) {
+
+            add_glider(tiled.get_state(), 2000, 50);
+            add_glider(bitwise.get_state(), 2000, 50);
+            tiled.advance(8);
+            bitwise.advance(8);
+
+            THEN( "the edit is stepped" ) {
+
+                REQUIRE( tiled.get_alive_cells() == 10 );
+                REQUIRE( tiled.get_packed_state() == bitwise.get_packed_state() );
+            }
+        }
+
+        WHEN( "the topology changes" ) {
+
+            tiled.advance(300, true);
+            bitwise.advance(300, true);
+
+            THEN( "the wrapped edges are stepped" ) {
+
+                REQUIRE( tiled.get_packed_state() == bitwise.get_packed_state() );
+            }
+        }
+
+        WHEN( "it is resized" ) {
+
+            tiled.resize(3000, 200);
+            bitwise.resize(3000, 200);
+            tiled.advance(8);
+            bitwise.advance(8);
+
+            THEN( "the new tiles are stepped" ) {
+
+                REQUIRE( tiled.get_tiles() == 12 );
+                REQUIRE( tiled.get_packed_state() == bitwise.get_packed_state() );
+            }
+        }
+
+        WHEN( "it takes a step with another engine in between" ) {
+
+            tiled.set_engine(StepEngine::Bitwise);
+            tiled.step();
+            tiled.set_engine(StepEngine::Tiled);
+            tiled.advance(8);
+            bitwise.advance(9);
+
+            THEN( "the generations still agree" ) {
+
+                REQUIRE( tiled.get_packed_state() == bitwise.get_packed_state() );
+            }
+        }
+    }
+}
@@ -0,0 +1,282 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../zoo.h"
+#include "../hashlife.h"
+#include "test_helpers.h"
+
+static Grid gosper_glider_gun()
+{
+    std::string const rows[] = {
+        "                        #           ",
+        "                      # #           ",
+        "            ##      ##            ##",
+        "           #   #    ##            ##",
+        "##        #     #   ##              ",
+        "##        #   # ##    # #           ",
+        "          #     #       #           ",
+        "           #   #                    ",
+        "            ##                      "
+    };
+
+    Grid grid(36, 9);
+    for (unsigned int y = 0; y < 9; y++) {
+        for (unsigned int x = 0; x < 36; x++) {
+            grid.set(x, y, rows[y][x] == '#' ? Cell::ALIVE : Cell::DEAD);
+        }
+    }
+    return grid;
+}
+
+SCENARIO( "a HashLife universe converts to and from a grid", "[hashlife]" ) {
+
+    GIVEN( "an empty universe" ) {
+
+        HashLife life;
+
+        THEN( "it has no cells and stays empty" ) {
+
+            REQUIRE( life.get_population() == 0 );
+            REQUIRE_FALSE( life.is_toroidal() );
+            life.advance(1000);
+            REQUIRE( life.get_population() == 0 );
+            REQUIRE( life.get_generation() == 1000 );
+        }
+    }
+
+    GIVEN( "a random grid" ) {
+
+        Grid grid = random_grid(70, 33, 1);
+        HashLife life(grid);
+
+        THEN( "the cells read back unchanged" ) {
+
+            REQUIRE( life.get_population() == grid.get_alive_cells() );
+            REQUIRE( BitGrid(life.to_grid()) == BitGrid(grid) );
+            REQUIRE( life.get(5, 5) == grid.get(5, 5) );
+            REQUIRE( life.get(-1, 0) == Cell::DEAD );
+            REQUIRE( life.get(-1000000000000ll, 1000000000000ll) == Cell::DEAD );
+        }
+
+        WHEN( "cells are set far outside the grid" ) {
+
+            life.set(-5000, 3, Cell::ALIVE);
+            life.set(2, 2, grid.get(2, 2) == Cell::ALIVE ? Cell::DEAD : Cell::ALIVE);
+
+            THEN( "the universe grows to hold them" ) {
+
+                REQUIRE( life.get(-5000, 3) == Cell::ALIVE );
+                REQUIRE( life.get_population() == grid.get_alive_cells() + 1 + (grid.get(2, 2) == Cell::ALIVE ? -1 : 1) );
+                REQUIRE( life.get_level() >= 14 );
+
+                Grid window = life.to_grid(-5001, 2, 3, 3);
+                REQUIRE( window.get_alive_cells() == 1 );
+                REQUIRE( window.get(1, 1) == Cell::ALIVE );
+            }
+        }
+    }
+
+    GIVEN( "grids that cannot be a toroidal universe" ) {
+
+        THEN( "they are rejected" ) {
+
+            REQUIRE_THROWS_AS( HashLife(Grid(48), true), std::invalid_argument );
+            REQUIRE_THROWS_AS( HashLife(Grid(64, 32), true), std::invalid_argument );
+            REQUIRE_THROWS_AS( HashLife(Grid(1), true), std::invalid_argument );
+            REQUIRE_NOTHROW( HashLife(Grid(2), true) );
+        }
+    }
+
+    GIVEN( "a toroidal universe" ) {
+
+        HashLife torus(Grid(16), true);
+
+        THEN( "cells outside it cannot be read or written" ) {
+
+            REQUIRE( torus.is_toroidal() );
+            REQUIRE_THROWS_AS( torus.get(16, 0), coord_exception );
+            REQUIRE_THROWS_AS( torus.set(0, -1, Cell::ALIVE), coord_exception );
+        }
+    }
+}
+
+SCENARIO( "HashLife matches World on the plane and on the torus", "[hashlife][world]" ) {
+
+    GIVEN( "an r-pentomino far from the edges of a bounded world" ) {
+
+        Grid initial(1024, 1024);
+        initial.merge(Zoo::r_pentomino(), 510, 510);
+
+        World world(initial);
+        world.set_engine(StepEngine::Bitwise);
+        HashLife life(initial);
+
+        unsigned int const checkpoints[] = { 1, 2, 3, 8, 31, 64, 100, 300, 600 };
+        unsigned int done = 0;
+
+        for (unsigned int checkpoint : checkpoints) {
+            world.advance(checkpoint - done);
+            life.advance(checkpoint - done);
+            done = checkpoint;
+
+            THEN( "generation " + std::to_string(checkpoint) + " is identical" ) {
+
+                REQUIRE( life.get_generation() == checkpoint );
+                REQUIRE( life.get_population() == world.get_alive_cells() );
+                REQUIRE( BitGrid(life.to_grid()) == world.get_packed_state() );
+            }
+        }
+    }
+
+    GIVEN( "random tori of every small power of two size" ) {
+
+        unsigned int const sides[] = { 2, 4, 8, 32, 128 };
+
+        for (unsigned int side : sides) {
+
+            Grid initial = random_grid(side, side, side);
+            World world(initial);
+            world.set_engine(StepEngine::Bitwise);
+            HashLife life(initial, true);
+
+            bool same = true;
+            unsigned int const steps[] = { 1, 1, 2, 5, 16, 64, 100, 256 };
+
+            for (unsigned int steps_taken : steps) {
+                world.advance(steps_taken, true);
+                life.advance(steps_taken);
+                same = same && BitGrid(life.to_grid()) == world.get_packed_state();
+            }
+
+            THEN( "the " + std::to_string(side) + "x" + std::to_string(side) + " torus matches" ) {
+
+                REQUIRE( same );
+                REQUIRE( (1u << life.get_level()) == side );
+            }
+        }
+    }
+
+    GIVEN( "a glider gun" ) {
+
+        Grid initial(2048, 2048);
+        initial.merge(gosper_glider_gun(), 100, 100);
+
+        World world(initial);
+        world.set_engine(StepEngine::Tiled);
+        world.advance(1500);
+
+        HashLife life(initial);
+        life.advance_pow2(10);
+        life.advance(1500 - 1024);
+
+        THEN( "the gun and its gliders match" ) {
+
+            REQUIRE( BitGrid(life.to_grid()) == world.get_packed_state() );
+        }
+    }
+}
+
+SCENARIO( "HashLife advances astronomically far", "[hashlife]" ) {
+
+    GIVEN( "a glider" ) {
+
+        HashLife life(Zoo::glider());
+
+        WHEN( "it is advanced by 2^40 generations" ) {
+
+            life.advance_pow2(40);
+
+            THEN( "it has moved 2^38 cells diagonally" ) {
+
+                std::int64_t const moved = std::int64_t(1) << 38;
+                Grid window = life.to_grid(moved, moved, 3, 3);
+
+                REQUIRE( life.get_generation() == (std::uint64_t(1) << 40) );
+                REQUIRE( life.get_population() == 5 );
+                REQUIRE( BitGrid(window) == BitGrid(Zoo::glider()) );
+            }
+        }
+    }
+
+    GIVEN( "a glider gun" ) {
+
+        HashLife life(gosper_glider_gun());
+
+        WHEN( "it is advanced by a billion generations" ) {
+
+            life.advance(1000000000);
+
+            THEN( "it has fired one glider every 30 generations" ) {
+
+                //36 cells in the gun and 5 per glider. A glider is fired every 30 generations once the first
+                //appears, the last ones may still be forming, so allow for the gun's phase.
+                std::uint64_t const gliders = (life.get_population() - 36) / 5;
+                REQUIRE( life.get_generation() == 1000000000 );
+                REQUIRE( gliders >= 1000000000 / 30 - 2 );
+                REQUIRE( gliders <= 1000000000 / 30 + 2 );
+            }
+        }
+    }
+
+    GIVEN( "a torus" ) {
+
+        Grid initial = random_grid(32, 32, 9);
+        World world(initial);
+        world.set_engine(StepEngine::Bitwise);
+        world.advance(1 << 16, true);
+
+        HashLife life(initial, true);
+        life.advance_pow2(16);
+
+        THEN( "2^16 generations match in one step of the algorithm" ) {
+
+            REQUIRE( BitGrid(life.to_grid()) == world.get_packed_state() );
+        }
+    }
+
+    GIVEN( "a universe with garbage" ) {
+
+        HashLife life(Zoo::r_pentomino());
+        life.advance(2000);
+        std::size_t const before = life.get_node_count();
+        std::uint64_t const population = life.get_population();
+
+        life.collect_garbage();
+
+        THEN( "collecting it frees nodes but keeps the universe" ) {
+
+            REQUIRE( life.get_node_count() < before );
+            REQUIRE( life.get_population() == population );
+            REQUIRE( population == 116 );
+        }
+
+        THEN( "stepping still works after collecting" ) {
+
+            life.collect_garbage();
+            life.advance(3000);
+            REQUIRE( life.get_population() == 116 );
+        }
+    }
+
+    GIVEN( "a step too large to represent" ) {
+
+        HashLife life(Zoo::glider());
+
+        THEN( "it is rejected" ) {
+
+            REQUIRE_THROWS_AS( life.advance_pow2(61), std::out_of_range );
+        }
+    }
+}
@@ -0,0 +1,172 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <cstdint>
+#include <random>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../zoo.h"
+#include "../unbounded_world.h"
+#include "test_helpers.h"
+
+SCENARIO( "an unbounded world stores cells anywhere on the plane", "[unbounded]" ) {
+
+    GIVEN( "an empty unbounded world" ) {
+
+        UnboundedWorld world;
+
+        THEN( "it has no cells, no tiles and no bounds" ) {
+            std::int64_t x0, y0, x1, y1;
+            REQUIRE( world.get_alive_cells() == 0 );
+            REQUIRE( world.get_tile_count() == 0 );
+            REQUIRE( world.get_generation() == 0 );
+            REQUIRE_FALSE( world.get_bounds(x0, y0, x1, y1) );
+        }
+
+        WHEN( "cells are set far apart at positive and negative coordinates" ) {
+            world.set(-1, -1, Cell::ALIVE);
+            world.set(0, 0, Cell::ALIVE);
+            world.set(-5000000000ll, 7, Cell::ALIVE);
+            world.set(123456789012ll, -64, Cell::ALIVE);
+
+            THEN( "each cell reads back and its neighbours are dead" ) {
+                REQUIRE( world.get(-1, -1) == Cell::ALIVE );
+                REQUIRE( world.get(0, 0) == Cell::ALIVE );
+                REQUIRE( world.get(-5000000000ll, 7) == Cell::ALIVE );
+                REQUIRE( world.get(123456789012ll, -64) == Cell::ALIVE );
+                REQUIRE( world.get(-1, 0) == Cell::DEAD );
+                REQUIRE( world.get(0, -1) == Cell::DEAD );
+                REQUIRE( world.get(123456789012ll, -65) == Cell::DEAD );
+            }
+
+            THEN( "only the tiles holding a cell are stored" ) {
+                REQUIRE( world.get_alive_cells() == 4 );
+                REQUIRE( world.get_tile_count() == 4 );
+            }
+
+            THEN( "the bounds cover every cell" ) {
+                std::int64_t x0, y0, x1, y1;
+                REQUIRE( world.get_bounds(x0, y0, x1, y1) );
+                REQUIRE( x0 == -5000000000ll );
+                REQUIRE( x1 == 123456789013ll );
+                REQUIRE( y0 == -64 );
+                REQUIRE( y1 == 8 );
+            }
+
+            THEN( "killing a cell frees its tile" ) {
+                world.set(-5000000000ll, 7, Cell::DEAD);
+                REQUIRE( world.get_tile_count() == 3 );
+                REQUIRE( world.get(-5000000000ll, 7) == Cell::DEAD );
+
+                world.set(7, 7, Cell::DEAD);
+                REQUIRE( world.get_tile_count() == 3 );
+            }
+        }
+    }
+
+    GIVEN( "a grid placed at a negative origin" ) {
+
+        Grid initial = random_grid(100, 70, 31);
+        UnboundedWorld world(initial, -50, -35);
+
+        THEN( "copying the same area out gives the grid back" ) {
+            REQUIRE( BitGrid(world.to_grid(-50, -35, 100, 70)) == BitGrid(initial) );
+            REQUIRE( world.get_alive_cells() == initial.get_alive_cells() );
+        }
+    }
+}
+
+SCENARIO( "an unbounded world steps like a bounded world that is never reached", "[unbounded][world]" ) {
+
+    GIVEN( "a soup straddling the origin and a world big enough to hold everything it could reach" ) {
+
+        unsigned int const size = 150, steps = 100, margin = steps + 20;
+        Grid soup = random_grid(size, size, 9);
+
+        UnboundedWorld unbounded(soup, -75, -75);
+
+        Grid padded(size + 2 * margin, size + 2 * margin);
+        for (unsigned int y = 0; y < size; y++) {
+            for (unsigned int x = 0; x < size; x++) {
+                padded.set(x + margin, y + margin, soup.get(x, y));
+            }
+        }
+        World world(padded);
+        world.set_engine(StepEngine::Bitwise);
+
+        WHEN( "both are advanced" ) {
+            unbounded.advance(steps);
+            world.advance(steps);
+
+            THEN( "they hold the same cells" ) {
+                std::int64_t const origin = -75 - std::int64_t(margin);
+                Grid view = unbounded.to_grid(origin, origin, size + 2 * margin, size + 2 * margin);
+
+                REQUIRE( unbounded.get_generation() == steps );
+                REQUIRE( unbounded.get_alive_cells() == world.get_alive_cells() );
+                REQUIRE( BitGrid(view) == world.get_packed_state() );
+            }
+        }
+
+        WHEN( "the unbounded world is stepped on several threads" ) {
+            UnboundedWorld threaded(soup, -75, -75);
+            threaded.set_threads(4);
+            REQUIRE( threaded.get_threads() == 4 );
+
+            threaded.advance(steps);
+            unbounded.advance(steps);
+
+            THEN( "it matches the single threaded result" ) {
+                std::int64_t const origin = -75 - std::int64_t(margin);
+                unsigned int const span = size + 2 * margin;
+                REQUIRE( threaded.get_tile_count() == unbounded.get_tile_count() );
+                REQUIRE( BitGrid(threaded.to_grid(origin, origin, span, span)) == BitGrid(unbounded.to_grid(origin, origin, span, span)) );
+            }
+        }
+    }
+}
+
+SCENARIO( "memory in an unbounded world follows the population", "[unbounded]" ) {
+
+    GIVEN( "a light weight spaceship flying west from the origin" ) {
+
+        UnboundedWorld world(Zoo::light_weight_spaceship());
+        std::uint64_t const population = world.get_alive_cells();
+
+        WHEN( "it flies far beyond where it started" ) {
+            world.advance(4000);
+
+            THEN( "it has moved two cells every four generations and still fits in a few tiles" ) {
+                std::int64_t x0, y0, x1, y1;
+                REQUIRE( world.get_bounds(x0, y0, x1, y1) );
+                REQUIRE( world.get_alive_cells() == population );
+                REQUIRE( world.get_tile_count() <= 4 );
+                REQUIRE( (x0 <= -1990 || x0 >= 1990) );
+                REQUIRE( y1 - y0 <= 5 );
+            }
+        }
+    }
+
+    GIVEN( "a pattern that dies out" ) {
+
+        UnboundedWorld world;
+        world.set(-64, -64, Cell::ALIVE);
+        world.set(-63, -64, Cell::ALIVE);
+
+        WHEN( "it is stepped" ) {
+            world.step();
+
+            THEN( "every tile is freed" ) {
+                REQUIRE( world.get_alive_cells() == 0 );
+                REQUIRE( world.get_tile_count() == 0 );
+            }
+        }
+    }
+}
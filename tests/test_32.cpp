@@ -0,0 +1,128 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../perf_counter.h"
+#include "test_helpers.h"
+
+SCENARIO( "the halo engine matches the reference engine", "[world][step][halo]" ) {
+
+    GIVEN( "the halo engine by name" ) {
+
+        THEN( "it parses and prints as halo" ) {
+            REQUIRE( parse_step_engine("halo") == StepEngine::Halo );
+            REQUIRE( to_string(StepEngine::Halo) == "halo" );
+        }
+    }
+
+    GIVEN( "random worlds of awkward sizes" ) {
+
+        unsigned int const sizes[][2] = { {1, 1}, {1, 9}, {9, 1}, {2, 2}, {3, 5}, {64, 64}, {67, 131} };
+
+        for (auto const & size : sizes) {
+            for (int toroidal = 0; toroidal < 2; toroidal++) {
+
+                Grid initial = random_grid(size[0], size[1], size[0] * 31 + size[1]);
+                World reference(initial), halo(initial);
+                reference.set_engine(StepEngine::Reference);
+                halo.set_engine(StepEngine::Halo);
+
+                reference.advance(12, toroidal);
+                halo.advance(12, toroidal);
+
+                THEN( "the " + std::to_string(size[0]) + "x" + std::to_string(size[1])
+                      + (toroidal ? " toroidal" : " bounded") + " states are identical" ) {
+
+                    REQUIRE( BitGrid(halo.get_state()) == BitGrid(reference.get_state()) );
+                }
+            }
+        }
+    }
+
+    GIVEN( "a random world stepped on several threads" ) {
+
+        Grid initial = random_grid(200, 301, 5);
+
+        for (int toroidal = 0; toroidal < 2; toroidal++) {
+
+            World reference(initial), halo(initial);
+            halo.set_engine(StepEngine::Halo);
+            halo.set_threads(4);
+
+            reference.advance(6, toroidal);
+            halo.advance(6, toroidal);
+
+            THEN( std::string("the ") + (toroidal ? "toroidal" : "bounded") + " states are identical" ) {
+
+                REQUIRE( BitGrid(halo.get_state()) == BitGrid(reference.get_state()) );
+            }
+        }
+    }
+
+    GIVEN( "a halo world that changes engine and size between steps" ) {
+
+        World world(random_grid(40, 30, 8));
+        World reference(world.get_state());
+        world.set_engine(StepEngine::Halo);
+
+        world.step(true);
+        reference.step(true);
+
+        world.set_engine(StepEngine::Bitwise);
+        world.step(true);
+        reference.step(true);
+
+        world.set_engine(StepEngine::Halo);
+        world.step(true);
+        reference.step(true);
+
+        THEN( "it still matches the reference engine" ) {
+            REQUIRE( BitGrid(world.get_state()) == BitGrid(reference.get_state()) );
+        }
+
+        WHEN( "it is resized" ) {
+            world.resize(50, 45);
+            reference.resize(50, 45);
+            world.advance(3);
+            reference.advance(3);
+
+            THEN( "it still matches the reference engine" ) {
+                REQUIRE( BitGrid(world.get_state()) == BitGrid(reference.get_state()) );
+            }
+        }
+    }
+}
+
+SCENARIO( "a perf counter runs whether or not perf events are available", "[perf]" ) {
+
+    GIVEN( "a branch miss counter" ) {
+
+        PerfCounter misses(PerfEvent::BranchMisses);
+
+        WHEN( "it counts a loop" ) {
+            misses.start();
+            volatile unsigned int sum = 0;
+            for (unsigned int i = 0; i < 100000; i++) {
+                sum += (i * 2654435761u) >> 31;
+            }
+            misses.stop();
+
+            THEN( "it reads 0 only if it is unavailable" ) {
+                if (!misses.is_available()) {
+                    REQUIRE( misses.read() == 0 );
+                }
+                REQUIRE( to_string(PerfEvent::BranchMisses) == "branch misses" );
+            }
+        }
+    }
+}
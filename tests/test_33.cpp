@@ -0,0 +1,197 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../rule.h"
+#include "test_helpers.h"
+
+static Grid complement(Grid const & grid)
+{
+    Grid result(grid.get_width(), grid.get_height());
+
+    for (unsigned int y = 0; y < grid.get_height(); y++) {
+        for (unsigned int x = 0; x < grid.get_width(); x++) {
+            result.set(x, y, grid.get(x, y) == Cell::ALIVE ? Cell::DEAD : Cell::ALIVE);
+        }
+    }
+
+    return result;
+}
+
+//Rule masks are compile time constants.
+static_assert(RULE_CONWAY == ((1u << 3) | (1u << (RULE_SURVIVAL_SHIFT + 2)) | (1u << (RULE_SURVIVAL_SHIFT + 3))),
+              "B3/S23 is birth on 3 and survival on 2 and 3");
+static_assert(rule_next(RULE_HIGHLIFE, false, 6) && !rule_next(RULE_CONWAY, false, 6), "HighLife is born on 6");
+static_assert(rule_mask("B2/S") == (1u << 2), "Seeds has no survival counts");
+
+SCENARIO( "rules are read from and written as rulestrings", "[rule]" ) {
+
+    GIVEN( "the default rule" ) {
+
+        Rule rule;
+
+        THEN( "it is Conway's Game of Life" ) {
+            REQUIRE( rule == Rule::conway() );
+            REQUIRE( rule.to_string() == "B3/S23" );
+            REQUIRE( rule.births(3) );
+            REQUIRE_FALSE( rule.births(2) );
+            REQUIRE( rule.survives(2) );
+            REQUIRE( rule.survives(3) );
+            REQUIRE_FALSE( rule.survives(4) );
+            REQUIRE_FALSE( rule.next(true, 9) );
+        }
+    }
+
+    GIVEN( "rulestrings in different spellings" ) {
+
+        THEN( "they all parse to the same rule" ) {
+            REQUIRE( Rule::parse("B36/S23") == Rule::highlife() );
+            REQUIRE( Rule::parse("b36/s23") == Rule::highlife() );
+            REQUIRE( Rule::parse("S23/B36") == Rule::highlife() );
+            REQUIRE( Rule::parse("23/36") == Rule::highlife() );
+            REQUIRE( Rule::parse("B3678/S34678") == Rule::day_and_night() );
+            REQUIRE( Rule::parse("B2/S") == Rule::seeds() );
+            REQUIRE( Rule::parse("B63/S32") == Rule::highlife() );
+        }
+
+        THEN( "they are written back in the canonical spelling" ) {
+            REQUIRE( Rule::parse("s32/b63").to_string() == "B36/S23" );
+            REQUIRE( Rule::parse("B/S").to_string() == "B/S" );
+            REQUIRE( Rule::parse("B012345678/S012345678").get_mask() == 0x3FFFFu );
+        }
+    }
+
+    GIVEN( "malformed rulestrings" ) {
+
+        THEN( "they throw" ) {
+            REQUIRE_THROWS_AS( Rule::parse(""), std::invalid_argument );
+            REQUIRE_THROWS_AS( Rule::parse("B3S23"), std::invalid_argument );
+            REQUIRE_THROWS_AS( Rule::parse("B3/S2/3"), std::invalid_argument );
+            REQUIRE_THROWS_AS( Rule::parse("B3/B23"), std::invalid_argument );
+            REQUIRE_THROWS_AS( Rule::parse("X3/S23"), std::invalid_argument );
+            REQUIRE_THROWS_AS( Rule::parse("B39/S23"), std::invalid_argument );
+            REQUIRE_THROWS_AS( Rule::parse("B3/S2 3"), std::invalid_argument );
+            REQUIRE_THROWS_AS( Rule(1u << 18), std::invalid_argument );
+        }
+    }
+}
+
+SCENARIO( "every engine steps every rule like the reference engine", "[rule][world][step]" ) {
+
+    GIVEN( "compiled rules, runtime rules and a rule with birth on 0 neighbours" ) {
+
+        std::string const rulestrings[] = { "B3/S23", "B36/S23", "B3678/S34678", "B2/S", "B35678/S5678", "B1357/S1357", "B0/S8" };
+        StepEngine const engines[] = { StepEngine::Halo, StepEngine::Table, StepEngine::Columns,
+                                       StepEngine::Bytewise, StepEngine::Bitwise, StepEngine::Tiled, StepEngine::Temporal };
+        Grid initial = random_grid(1100, 70, 3);
+
+        for (std::string const & rulestring : rulestrings) {
+            for (int toroidal = 0; toroidal < 2; toroidal++) {
+
+                World reference(initial);
+                reference.set_rule(Rule::parse(rulestring));
+                reference.advance(5, toroidal);
+
+                for (StepEngine engine : engines) {
+
+                    World world(initial);
+                    world.set_engine(engine);
+                    world.set_rule(Rule::parse(rulestring));
+                    world.set_threads(engine == StepEngine::Tiled ? 3 : 1);
+                    world.advance(5, toroidal);
+
+                    THEN( rulestring + " on the " + to_string(engine) + (toroidal ? " toroidal" : " bounded") + " engine matches" ) {
+                        REQUIRE( world.get_rule() == Rule::parse(rulestring) );
+                        REQUIRE( BitGrid(world.get_state()) == BitGrid(reference.get_state()) );
+                    }
+                }
+            }
+        }
+    }
+
+    GIVEN( "an empty world under a rule with birth on 0 neighbours" ) {
+
+        World world(2100, 130);
+        world.set_engine(StepEngine::Tiled);
+        world.set_rule(Rule::parse("B0/S"));
+
+        WHEN( "it is stepped once" ) {
+            world.step();
+
+            THEN( "every cell is born, including in tiles with no live cells" ) {
+                REQUIRE( world.get_alive_cells() == world.get_total_cells() );
+            }
+        }
+    }
+
+    GIVEN( "a tiled world that settles and then changes rule" ) {
+
+        Grid initial = random_grid(2100, 130, 17);
+        World world(initial), reference(initial);
+        world.set_engine(StepEngine::Tiled);
+
+        world.advance(300);
+        reference.advance(300);
+
+        world.set_rule(Rule::highlife());
+        reference.set_rule(Rule::highlife());
+
+        world.advance(20);
+        reference.advance(20);
+
+        THEN( "tiles that were settled under the old rule are recomputed" ) {
+            REQUIRE( BitGrid(world.get_state()) == BitGrid(reference.get_state()) );
+        }
+    }
+}
+
+SCENARIO( "rules behave as their rulestrings say", "[rule][world]" ) {
+
+    GIVEN( "a random world under Seeds" ) {
+
+        Grid initial = random_grid(200, 200, 5);
+        World world(initial);
+        world.set_engine(StepEngine::Bitwise);
+        world.set_rule(Rule::seeds());
+        world.step();
+
+        THEN( "no live cell survives" ) {
+            unsigned int survivors = 0;
+            for (unsigned int y = 0; y < 200; y++) {
+                for (unsigned int x = 0; x < 200; x++) {
+                    survivors += (initial.get(x, y) == Cell::ALIVE && world.get_state().get(x, y) == Cell::ALIVE);
+                }
+            }
+            REQUIRE( survivors == 0 );
+            REQUIRE( world.get_alive_cells() > 0 );
+        }
+    }
+
+    GIVEN( "a random torus under Day & Night" ) {
+
+        Grid initial = random_grid(256, 128, 6);
+        World world(initial), inverse(complement(initial));
+        world.set_engine(StepEngine::Bitwise);
+        inverse.set_engine(StepEngine::Bitwise);
+        world.set_rule(Rule::day_and_night());
+        inverse.set_rule(Rule::day_and_night());
+
+        world.advance(10, true);
+        inverse.advance(10, true);
+
+        THEN( "dead and live cells follow the same rule, so the complement evolves into the complement" ) {
+            REQUIRE( BitGrid(complement(world.get_state())) == BitGrid(inverse.get_state()) );
+        }
+    }
+}
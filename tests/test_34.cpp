@@ -0,0 +1,297 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../rule.h"
+#include "../generations.h"
+#include "../cpu_features.h"
+#include "../zoo.h"
+
+static GenerationsWorld random_world(unsigned int width, unsigned int height, GenerationsRule const & rule, unsigned int seed)
+{
+    GenerationsWorld world(width, height, rule);
+    std::mt19937 rng(seed);
+
+    for (unsigned int y = 0; y < height; y++) {
+        for (unsigned int x = 0; x < width; x++) {
+            world.set(x, y, rng() % rule.get_states());
+        }
+    }
+
+    return world;
+}
+
+//One step of a Generations rule a cell at a time, straight from the definition.
+static GenerationsWorld reference_step(GenerationsWorld const & world, bool toroidal)
+{
+    unsigned int const width = world.get_width();
+    unsigned int const height = world.get_height();
+    unsigned int const states = world.get_rule().get_states();
+    GenerationsWorld next(width, height, world.get_rule());
+
+    for (unsigned int y = 0; y < height; y++) {
+        for (unsigned int x = 0; x < width; x++) {
+            unsigned int neighbours = 0;
+
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    int nx = int(x) + dx;
+                    int ny = int(y) + dy;
+
+                    if (dx == 0 && dy == 0) {
+                        continue;
+                    }
+                    if (toroidal) {
+                        nx = (nx + int(width)) % int(width);
+                        ny = (ny + int(height)) % int(height);
+                    }
+                    else if (nx < 0 || ny < 0 || nx >= int(width) || ny >= int(height)) {
+                        continue;
+                    }
+                    neighbours += world.get(nx, ny) == 1 ? 1 : 0;
+                }
+            }
+
+            unsigned int const state = world.get(x, y);
+            unsigned int result;
+
+            if (state == 0) {
+                result = world.get_rule().get_rule().births(neighbours) ? 1 : 0;
+            }
+            else if (state == 1 && world.get_rule().get_rule().survives(neighbours)) {
+                result = 1;
+            }
+            else {
+                result = (state + 1) % states;
+            }
+
+            next.set(x, y, result);
+        }
+    }
+
+    return next;
+}
+
+SCENARIO( "Generations rules are read from rulestrings", "[generations]" ) {
+
+    GIVEN( "the named rules" ) {
+
+        THEN( "they have their rulestrings and state counts" ) {
+            REQUIRE( GenerationsRule() == GenerationsRule::brians_brain() );
+            REQUIRE( GenerationsRule::brians_brain().to_string() == "B2/S/C3" );
+            REQUIRE( GenerationsRule::brians_brain().get_states() == 3 );
+            REQUIRE( GenerationsRule::star_wars().to_string() == "B2/S345/C4" );
+        }
+    }
+
+    GIVEN( "rulestrings in different spellings" ) {
+
+        THEN( "they parse to the same rule" ) {
+            REQUIRE( GenerationsRule::parse("B2/S/C3") == GenerationsRule::brians_brain() );
+            REQUIRE( GenerationsRule::parse("b2/s/c3") == GenerationsRule::brians_brain() );
+            REQUIRE( GenerationsRule::parse("/2/3") == GenerationsRule::brians_brain() );
+            REQUIRE( GenerationsRule::parse("345/2/4") == GenerationsRule::star_wars() );
+            REQUIRE( GenerationsRule::parse("B2/S345/G4") == GenerationsRule::star_wars() );
+            REQUIRE( GenerationsRule::parse("B3/S23/C2").get_rule() == Rule::conway() );
+        }
+    }
+
+    GIVEN( "invalid rulestrings" ) {
+
+        THEN( "parsing throws" ) {
+            REQUIRE_THROWS_AS( GenerationsRule::parse("B3/S23"), std::invalid_argument );
+            REQUIRE_THROWS_AS( GenerationsRule::parse("B2/S/C"), std::invalid_argument );
+            REQUIRE_THROWS_AS( GenerationsRule::parse("B2/S/C1"), std::invalid_argument );
+            REQUIRE_THROWS_AS( GenerationsRule::parse("B2/S/C17"), std::invalid_argument );
+            REQUIRE_THROWS_AS( GenerationsRule::parse("B2/S/Cx"), std::invalid_argument );
+            REQUIRE_THROWS_AS( GenerationsRule(Rule(), 1), std::invalid_argument );
+        }
+    }
+}
+
+SCENARIO( "Generations worlds store states compactly", "[generations]" ) {
+
+    GIVEN( "worlds with different numbers of states" ) {
+
+        THEN( "each uses the fewest bits per cell that hold every state" ) {
+            REQUIRE( GenerationsWorld(8, 8, GenerationsRule(Rule(), 2)).get_bits_per_cell() == 1 );
+            REQUIRE( GenerationsWorld(8, 8, GenerationsRule::brians_brain()).get_bits_per_cell() == 2 );
+            REQUIRE( GenerationsWorld(8, 8, GenerationsRule::star_wars()).get_bits_per_cell() == 2 );
+            REQUIRE( GenerationsWorld(8, 8, GenerationsRule(Rule(), 5)).get_bits_per_cell() == 3 );
+            REQUIRE( GenerationsWorld(8, 8, GenerationsRule(Rule(), 16)).get_bits_per_cell() == 4 );
+        }
+    }
+
+    GIVEN( "a Star Wars world" ) {
+
+        GenerationsWorld world(70, 3, GenerationsRule::star_wars());
+
+        WHEN( "cells are set" ) {
+
+            world.set(0, 0, 1);
+            world.set(64, 1, 2);
+            world.set(69, 2, 3);
+
+            THEN( "they read back, and are counted by state" ) {
+                REQUIRE( world.get(0, 0) == 1 );
+                REQUIRE( world.get(64, 1) == 2 );
+                REQUIRE( world.get(69, 2) == 3 );
+                REQUIRE( world.get(1, 0) == 0 );
+                REQUIRE( world.get_alive_cells() == 1 );
+                REQUIRE( world.get_cells_in_state(2) == 1 );
+                REQUIRE( world.get_cells_in_state(3) == 1 );
+                REQUIRE( world.get_cells_in_state(0) == 70 * 3 - 3 );
+            }
+        }
+
+        THEN( "invalid cells and states throw" ) {
+            REQUIRE_THROWS_AS( world.set(0, 0, 4), std::invalid_argument );
+            REQUIRE_THROWS_AS( world.set(70, 0, 1), std::exception );
+            REQUIRE_THROWS_AS( world.get(0, 3), std::exception );
+        }
+    }
+}
+
+SCENARIO( "Generations worlds step", "[generations]" ) {
+
+    GIVEN( "a Brian's Brain world with two alive cells side by side" ) {
+
+        GenerationsWorld world(6, 5, GenerationsRule::brians_brain());
+        world.set(2, 2, 1);
+        world.set(3, 2, 1);
+
+        WHEN( "it steps once" ) {
+
+            world.step();
+
+            THEN( "the alive cells are dying and the cells next to both are born" ) {
+                REQUIRE( world.get(2, 2) == 2 );
+                REQUIRE( world.get(3, 2) == 2 );
+                REQUIRE( world.get(2, 1) == 1 );
+                REQUIRE( world.get(3, 1) == 1 );
+                REQUIRE( world.get(2, 3) == 1 );
+                REQUIRE( world.get(3, 3) == 1 );
+                REQUIRE( world.get_alive_cells() == 4 );
+                REQUIRE( world.get_cells_in_state(2) == 2 );
+            }
+        }
+
+        WHEN( "it steps twice" ) {
+
+            world.advance(2);
+
+            THEN( "the dying cells are dead again" ) {
+                REQUIRE( world.get(2, 2) == 0 );
+                REQUIRE( world.get(3, 2) == 0 );
+                REQUIRE( world.get_cells_in_state(2) == 4 );
+            }
+        }
+    }
+
+    GIVEN( "a two state rule" ) {
+
+        Grid const initial = Zoo::glider();
+        GenerationsWorld world(9, 9, GenerationsRule(Rule::conway(), 2));
+        World life(9, 9);
+
+        for (unsigned int y = 0; y < initial.get_height(); y++) {
+            for (unsigned int x = 0; x < initial.get_width(); x++) {
+                if (initial.get(x, y) == Cell::ALIVE) {
+                    world.set(x + 2, y + 2, 1);
+                    life.get_state().set(x + 2, y + 2, Cell::ALIVE);
+                }
+            }
+        }
+
+        WHEN( "both step on a torus" ) {
+
+            world.advance(40, true);
+            life.advance(40, true);
+
+            THEN( "the Generations world is the Game of Life" ) {
+                REQUIRE( world.get_alive_grid() == BitGrid(life.get_state()) );
+            }
+        }
+    }
+
+    GIVEN( "random worlds of several rules" ) {
+
+        std::string const rules[] = { "B2/S/C3", "345/2/4", "B3/S23/C5", "B36/S23/C8", "B0/S8/C6" };
+        SimdLevel const levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+
+        for (SimdLevel level : levels) {
+
+            if ((int)level > (int)detected_simd_level()) {
+                continue;
+            }
+
+            set_simd_level(level);
+
+            THEN( "bitwise steps match stepping a cell at a time at " + to_string(level) ) {
+                unsigned int mismatches = 0;
+
+                for (std::string const & rulestring : rules) {
+                    for (int toroidal = 0; toroidal < 2; toroidal++) {
+                        GenerationsWorld world = random_world(300, 75, GenerationsRule::parse(rulestring), 7);
+                        GenerationsWorld expected = world;
+
+                        for (unsigned int i = 0; i < 6; i++) {
+                            world.step(toroidal);
+                            expected = reference_step(expected, toroidal);
+                            mismatches += (world == expected) ? 0 : 1;
+                        }
+                    }
+                }
+
+                REQUIRE( mismatches == 0 );
+            }
+        }
+
+        set_simd_level(detected_simd_level());
+    }
+}
+
+SCENARIO( "Generations worlds are saved and loaded", "[generations][zoo]" ) {
+
+    GIVEN( "a random Star Wars world" ) {
+
+        GenerationsWorld const world = random_world(37, 11, GenerationsRule::star_wars(), 3);
+
+        WHEN( "it is saved as ascii and loaded" ) {
+
+            Zoo::save_generations_ascii("../test_outputs/SAVE_GENERATIONS_ASCII.gen", world);
+
+            THEN( "the loaded world equals it" ) {
+                REQUIRE( Zoo::load_generations_ascii("../test_outputs/SAVE_GENERATIONS_ASCII.gen") == world );
+            }
+        }
+
+        WHEN( "it is saved as binary and loaded" ) {
+
+            Zoo::save_generations_binary("../test_outputs/SAVE_GENERATIONS_BINARY.bgen", world);
+
+            THEN( "the loaded world equals it" ) {
+                REQUIRE( Zoo::load_generations_binary("../test_outputs/SAVE_GENERATIONS_BINARY.bgen") == world );
+            }
+        }
+    }
+
+    GIVEN( "files that do not exist" ) {
+
+        THEN( "loading throws" ) {
+            REQUIRE_THROWS_AS( Zoo::load_generations_ascii("../test_outputs/DOES_NOT_EXIST.gen"), std::runtime_error );
+            REQUIRE_THROWS_AS( Zoo::load_generations_binary("../test_outputs/DOES_NOT_EXIST.bgen"), std::runtime_error );
+        }
+    }
+}
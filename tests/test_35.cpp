@@ -0,0 +1,178 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../larger_than_life.h"
+#include "../cpu_features.h"
+#include "test_helpers.h"
+
+//One step counting every cell of every neighbourhood, straight from the definition.
+static Grid reference_step(Grid const & grid, LargerThanLifeRule const & rule, bool toroidal)
+{
+    int const width = (int)grid.get_width();
+    int const height = (int)grid.get_height();
+    int const range = (int)rule.get_range();
+    Grid next(grid.get_width(), grid.get_height());
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            unsigned int count = 0;
+
+            for (int dy = -range; dy <= range; dy++) {
+                for (int dx = -range; dx <= range; dx++) {
+                    int nx = x + dx;
+                    int ny = y + dy;
+
+                    if (dx == 0 && dy == 0 && !rule.includes_middle()) {
+                        continue;
+                    }
+                    if (toroidal) {
+                        nx = ((nx % width) + width) % width;
+                        ny = ((ny % height) + height) % height;
+                    }
+                    else if (nx < 0 || ny < 0 || nx >= width || ny >= height) {
+                        continue;
+                    }
+                    count += grid.get(nx, ny) == Cell::ALIVE ? 1 : 0;
+                }
+            }
+
+            bool const alive = grid.get(x, y) == Cell::ALIVE;
+            next.set(x, y, (alive ? rule.survives(count) : rule.births(count)) ? Cell::ALIVE : Cell::DEAD);
+        }
+    }
+
+    return next;
+}
+
+SCENARIO( "Larger than Life rules are read from rulestrings", "[ltl]" ) {
+
+    GIVEN( "Bosco's rule" ) {
+
+        LargerThanLifeRule const bosco = LargerThanLifeRule::bosco();
+
+        THEN( "it is written in Golly's notation and parses back" ) {
+            REQUIRE( bosco.to_string() == "R5,C0,M1,S34..58,B34..45,NM" );
+            REQUIRE( LargerThanLifeRule::parse(bosco.to_string()) == bosco );
+            REQUIRE( LargerThanLifeRule::parse("r5,m1,b34..45,s34..58") == bosco );
+            REQUIRE( bosco.births(34) );
+            REQUIRE_FALSE( bosco.births(46) );
+            REQUIRE( bosco.survives(58) );
+            REQUIRE_FALSE( bosco.survives(33) );
+        }
+    }
+
+    GIVEN( "the default rule" ) {
+
+        THEN( "it is Conway's Game of Life" ) {
+            REQUIRE( LargerThanLifeRule() == LargerThanLifeRule::parse("R1,C0,M0,S2..3,B3..3,NM") );
+        }
+    }
+
+    GIVEN( "invalid rulestrings" ) {
+
+        THEN( "parsing throws" ) {
+            REQUIRE_THROWS_AS( LargerThanLifeRule::parse("R11,C0,M1,S34..58,B34..45,NM"), std::invalid_argument );
+            REQUIRE_THROWS_AS( LargerThanLifeRule::parse("R0,C0,M1,S0..0,B1..1,NM"), std::invalid_argument );
+            REQUIRE_THROWS_AS( LargerThanLifeRule::parse("R5,C3,M1,S34..58,B34..45,NM"), std::invalid_argument );
+            REQUIRE_THROWS_AS( LargerThanLifeRule::parse("R5,C0,M1,S34..58,B34..45,NN"), std::invalid_argument );
+            REQUIRE_THROWS_AS( LargerThanLifeRule::parse("R5,C0,M1,S58..34,B34..45,NM"), std::invalid_argument );
+            REQUIRE_THROWS_AS( LargerThanLifeRule::parse("R1,C0,M0,S2..3,B3..10,NM"), std::invalid_argument );
+            REQUIRE_THROWS_AS( LargerThanLifeRule::parse("R5,C0,M1,S34..58"), std::invalid_argument );
+            REQUIRE_THROWS_AS( LargerThanLifeRule::parse("R5;S34..58;B34..45"), std::invalid_argument );
+        }
+    }
+}
+
+SCENARIO( "Larger than Life worlds step", "[ltl]" ) {
+
+    GIVEN( "a random grid and the range 1 rule for Conway's Game of Life" ) {
+
+        Grid const initial = random_grid(50, 40, 11);
+
+        WHEN( "it steps as a Larger than Life world and as a World" ) {
+
+            LargerThanLifeWorld ltl(initial, LargerThanLifeRule());
+            World life(initial);
+
+            ltl.advance(12, true);
+            life.advance(12, true);
+
+            THEN( "they agree" ) {
+                REQUIRE( BitGrid(ltl.get_state()) == BitGrid(life.get_state()) );
+                REQUIRE( ltl.get_alive_cells() == life.get_alive_cells() );
+            }
+        }
+    }
+
+    GIVEN( "random grids and rules of every range" ) {
+
+        SimdLevel const levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+
+        for (SimdLevel level : levels) {
+
+            if ((int)level > (int)detected_simd_level()) {
+                continue;
+            }
+
+            set_simd_level(level);
+
+            THEN( "running sums match counting every cell at " + to_string(level) ) {
+                unsigned int mismatches = 0;
+
+                for (unsigned int range = 1; range <= LTL_MAX_RANGE; range++) {
+                    unsigned int const cells = (2 * range + 1) * (2 * range + 1);
+                    LargerThanLifeRule const rule(range, cells / 4, cells / 3, cells / 5, cells / 2, range % 2 == 0);
+
+                    for (int toroidal = 0; toroidal < 2; toroidal++) {
+                        Grid grid = random_grid(37 + range, 29, range);
+                        LargerThanLifeWorld world(grid, rule);
+
+                        for (unsigned int i = 0; i < 3; i++) {
+                            world.step(toroidal);
+                            grid = reference_step(grid, rule, toroidal);
+                            mismatches += BitGrid(world.get_state()) == BitGrid(grid) ? 0 : 1;
+                        }
+                    }
+                }
+
+                REQUIRE( mismatches == 0 );
+            }
+        }
+
+        set_simd_level(detected_simd_level());
+    }
+
+    GIVEN( "a torus narrower than its neighbourhood" ) {
+
+        LargerThanLifeRule const rule(10, 20, 60, 30, 90, true);
+        Grid const initial = random_grid(7, 5, 3);
+
+        THEN( "the neighbourhood wraps around more than once" ) {
+            LargerThanLifeWorld world(initial, rule);
+            world.step(true);
+            REQUIRE( BitGrid(world.get_state()) == BitGrid(reference_step(initial, rule, true)) );
+        }
+    }
+
+    GIVEN( "an empty world" ) {
+
+        LargerThanLifeWorld world(0, 0, LargerThanLifeRule::bosco());
+
+        THEN( "stepping does nothing" ) {
+            REQUIRE_NOTHROW( world.advance(3) );
+            REQUIRE( world.get_alive_cells() == 0 );
+        }
+    }
+}
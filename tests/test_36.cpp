@@ -0,0 +1,123 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../rule.h"
+#include "../step_kernels.h"
+#include "test_helpers.h"
+
+SCENARIO( "the block table holds the next state of the centre of every 4x4 block", "[step][table]" ) {
+
+    GIVEN( "the table for Conway's Game of Life" ) {
+
+        std::vector<std::uint8_t> table(STEP_BLOCK_TABLE_SIZE);
+        block_table(Rule::conway(), &table[0]);
+
+        THEN( "an empty block stays empty" ) {
+            REQUIRE( table[0] == 0 );
+        }
+
+        THEN( "a full block dies of overpopulation" ) {
+            REQUIRE( table[0xFFFF] == 0 );
+        }
+
+        THEN( "a block of four alive centre cells is still" ) {
+            REQUIRE( table[0x0660] == 0xF );
+        }
+
+        THEN( "a vertical blinker through column 1 turns horizontal" ) {
+            //Cells (1, 0), (1, 1) and (1, 2) become (0, 1), (1, 1) and (2, 1), of which the centre row holds (1, 1) and (2, 1).
+            REQUIRE( table[0x0222] == 0x3 );
+        }
+    }
+}
+
+SCENARIO( "the table engine matches the reference engine", "[world][step][table]" ) {
+
+    GIVEN( "the table engine by name" ) {
+
+        THEN( "it parses and prints as table" ) {
+            REQUIRE( parse_step_engine("table") == StepEngine::Table );
+            REQUIRE( to_string(StepEngine::Table) == "table" );
+        }
+    }
+
+    GIVEN( "random worlds of awkward sizes" ) {
+
+        unsigned int const sizes[][2] = { {1, 1}, {1, 9}, {9, 1}, {2, 2}, {3, 5}, {8, 8}, {17, 3}, {64, 64}, {67, 131} };
+
+        for (auto const & size : sizes) {
+            for (int toroidal = 0; toroidal < 2; toroidal++) {
+
+                Grid initial = random_grid(size[0], size[1], size[0] * 31 + size[1]);
+                World reference(initial), table(initial);
+                reference.set_engine(StepEngine::Reference);
+                table.set_engine(StepEngine::Table);
+
+                reference.advance(12, toroidal);
+                table.advance(12, toroidal);
+
+                THEN( "the " + std::to_string(size[0]) + "x" + std::to_string(size[1])
+                      + (toroidal ? " toroidal" : " bounded") + " states are identical" ) {
+
+                    REQUIRE( BitGrid(table.get_state()) == BitGrid(reference.get_state()) );
+                }
+            }
+        }
+    }
+
+    GIVEN( "a random world stepped on several threads in bands of odd heights" ) {
+
+        Grid initial = random_grid(201, 301, 5);
+
+        for (int toroidal = 0; toroidal < 2; toroidal++) {
+
+            World reference(initial), table(initial);
+            table.set_engine(StepEngine::Table);
+            table.set_threads(7);
+
+            reference.advance(6, toroidal);
+            table.advance(6, toroidal);
+
+            THEN( std::string("the ") + (toroidal ? "toroidal" : "bounded") + " states are identical" ) {
+
+                REQUIRE( BitGrid(table.get_state()) == BitGrid(reference.get_state()) );
+            }
+        }
+    }
+
+    GIVEN( "a table world whose rule changes between steps" ) {
+
+        World world(random_grid(40, 30, 8));
+        World reference(world.get_state());
+        world.set_engine(StepEngine::Table);
+
+        world.step(true);
+        reference.step(true);
+
+        world.set_rule(Rule::highlife());
+        reference.set_rule(Rule::highlife());
+        world.advance(3, true);
+        reference.advance(3, true);
+
+        world.set_rule(Rule::day_and_night());
+        reference.set_rule(Rule::day_and_night());
+        world.advance(3);
+        reference.advance(3);
+
+        THEN( "the table follows the rule" ) {
+            REQUIRE( BitGrid(world.get_state()) == BitGrid(reference.get_state()) );
+        }
+    }
+}
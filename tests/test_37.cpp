@@ -0,0 +1,100 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../rule.h"
+#include "../step_kernels.h"
+#include "test_helpers.h"
+
+SCENARIO( "running column sums step like the byte kernels", "[step][columns]" ) {
+
+    GIVEN( "random grids of widths around a word of cells" ) {
+
+        unsigned int const widths[] = { 1, 6, 7, 8, 9, 15, 16, 17, 100 };
+
+        THEN( "every band of rows matches step_bytes in both topologies" ) {
+            unsigned int mismatches = 0;
+
+            for (unsigned int width : widths) {
+                for (int toroidal = 0; toroidal < 2; toroidal++) {
+                    Grid const curr = random_grid(width, 13, width);
+                    Grid expected(width, 13), next(width, 13);
+
+                    step_bytes(curr, expected, toroidal, 0, 13, Rule::highlife());
+                    step_column_sums(curr, next, toroidal, 0, 5, Rule::highlife());
+                    step_column_sums(curr, next, toroidal, 5, 6, Rule::highlife());
+                    step_column_sums(curr, next, toroidal, 6, 13, Rule::highlife());
+
+                    mismatches += (BitGrid(next) == BitGrid(expected)) ? 0 : 1;
+                }
+            }
+
+            REQUIRE( mismatches == 0 );
+        }
+    }
+}
+
+SCENARIO( "the columns engine matches the reference engine", "[world][step][columns]" ) {
+
+    GIVEN( "the columns engine by name" ) {
+
+        THEN( "it parses and prints as columns" ) {
+            REQUIRE( parse_step_engine("columns") == StepEngine::Columns );
+            REQUIRE( to_string(StepEngine::Columns) == "columns" );
+        }
+    }
+
+    GIVEN( "random worlds of awkward sizes" ) {
+
+        unsigned int const sizes[][2] = { {1, 1}, {1, 9}, {9, 1}, {2, 2}, {3, 5}, {8, 8}, {17, 3}, {64, 64}, {67, 131} };
+
+        for (auto const & size : sizes) {
+            for (int toroidal = 0; toroidal < 2; toroidal++) {
+
+                Grid initial = random_grid(size[0], size[1], size[0] * 31 + size[1]);
+                World reference(initial), columns(initial);
+                reference.set_engine(StepEngine::Reference);
+                columns.set_engine(StepEngine::Columns);
+
+                reference.advance(12, toroidal);
+                columns.advance(12, toroidal);
+
+                THEN( "the " + std::to_string(size[0]) + "x" + std::to_string(size[1])
+                      + (toroidal ? " toroidal" : " bounded") + " states are identical" ) {
+
+                    REQUIRE( BitGrid(columns.get_state()) == BitGrid(reference.get_state()) );
+                }
+            }
+        }
+    }
+
+    GIVEN( "a random world stepped on several threads" ) {
+
+        Grid initial = random_grid(201, 301, 5);
+
+        for (int toroidal = 0; toroidal < 2; toroidal++) {
+
+            World reference(initial), columns(initial);
+            columns.set_engine(StepEngine::Columns);
+            columns.set_threads(5);
+
+            reference.advance(6, toroidal);
+            columns.advance(6, toroidal);
+
+            THEN( std::string("the ") + (toroidal ? "toroidal" : "bounded") + " states are identical" ) {
+
+                REQUIRE( BitGrid(columns.get_state()) == BitGrid(reference.get_state()) );
+            }
+        }
+    }
+}
@@ -0,0 +1,126 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../rule.h"
+#include "../step_kernels.h"
+#include "test_helpers.h"
+
+SCENARIO( "bands stepped several generations at once match stepping one generation at a time", "[step][temporal]" ) {
+
+    GIVEN( "random packed grids, split into bands of various heights" ) {
+
+        unsigned int const sizes[][2] = { {64, 40}, {70, 3}, {130, 37}, {9, 1} };
+        unsigned int const band_rows[] = { 1, 5, 16, 40 };
+        unsigned int const generations[] = { 0, 1, 3, 8, 11 };
+
+        THEN( "every split matches step_bits in both topologies and for several rules" ) {
+            unsigned int mismatches = 0;
+
+            for (auto const & size : sizes) {
+                for (int toroidal = 0; toroidal < 2; toroidal++) {
+                    for (Rule const & rule : { Rule::conway(), Rule::day_and_night(), Rule::parse("B0/S8") }) {
+                        BitGrid const initial(random_grid(size[0], size[1], size[0] + size[1]));
+
+                        for (unsigned int g : generations) {
+                            BitGrid expected(initial), scratch(size[0], size[1]);
+                            for (unsigned int i = 0; i < g; i++) {
+                                step_bits(expected, scratch, toroidal, 0, size[1], rule);
+                                std::swap(expected, scratch);
+                            }
+
+                            for (unsigned int rows : band_rows) {
+                                BitGrid next(size[0], size[1]);
+                                for (unsigned int y = 0; y < size[1]; y += rows) {
+                                    step_bits_generations(initial, next, toroidal, y, std::min(y + rows, size[1]), g, rule);
+                                }
+
+                                mismatches += (next == expected) ? 0 : 1;
+                            }
+                        }
+                    }
+                }
+            }
+
+            REQUIRE( mismatches == 0 );
+        }
+    }
+}
+
+SCENARIO( "the temporal engine matches the bitwise engine", "[world][step][temporal]" ) {
+
+    GIVEN( "the temporal engine by name" ) {
+
+        THEN( "it parses and prints as temporal" ) {
+            REQUIRE( parse_step_engine("temporal") == StepEngine::Temporal );
+            REQUIRE( to_string(StepEngine::Temporal) == "temporal" );
+        }
+    }
+
+    GIVEN( "random worlds advanced by steps that are and are not multiples of a pass" ) {
+
+        unsigned int const sizes[][2] = { {1, 1}, {2, 2}, {17, 3}, {64, 64}, {67, 131}, {300, 9} };
+        unsigned int const steps[] = { 1, STEP_TEMPORAL_GENERATIONS, STEP_TEMPORAL_GENERATIONS + 1, 3 * STEP_TEMPORAL_GENERATIONS - 1 };
+
+        for (auto const & size : sizes) {
+            for (int toroidal = 0; toroidal < 2; toroidal++) {
+
+                Grid initial = random_grid(size[0], size[1], size[0] * 31 + size[1]);
+                unsigned int mismatches = 0;
+
+                for (unsigned int n : steps) {
+                    World bitwise(initial), temporal(initial);
+                    bitwise.set_engine(StepEngine::Bitwise);
+                    temporal.set_engine(StepEngine::Temporal);
+
+                    bitwise.advance(n, toroidal);
+                    temporal.advance(n, toroidal);
+
+                    //World::step takes a single generation on the temporal engine.
+                    bitwise.step(toroidal);
+                    temporal.step(toroidal);
+
+                    mismatches += (temporal.get_packed_state() == bitwise.get_packed_state()) ? 0 : 1;
+                }
+
+                THEN( "the " + std::to_string(size[0]) + "x" + std::to_string(size[1])
+                      + (toroidal ? " toroidal" : " bounded") + " states are identical" ) {
+
+                    REQUIRE( mismatches == 0 );
+                }
+            }
+        }
+    }
+
+    GIVEN( "a world taller than one band, stepped on several threads with HighLife" ) {
+
+        Grid initial = random_grid(4000, 700, 9);
+
+        for (int toroidal = 0; toroidal < 2; toroidal++) {
+
+            World bitwise(initial), temporal(initial);
+            bitwise.set_rule(Rule::highlife());
+            temporal.set_rule(Rule::highlife());
+            temporal.set_engine(StepEngine::Temporal);
+            temporal.set_threads(3);
+
+            bitwise.advance(2 * STEP_TEMPORAL_GENERATIONS + 3, toroidal);
+            temporal.advance(2 * STEP_TEMPORAL_GENERATIONS + 3, toroidal);
+
+            THEN( std::string("the ") + (toroidal ? "toroidal" : "bounded") + " states are identical" ) {
+
+                REQUIRE( BitGrid(temporal.get_state()) == BitGrid(bitwise.get_state()) );
+            }
+        }
+    }
+}
@@ -0,0 +1,219 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../rule.h"
+#include "../step_kernels.h"
+#include "test_helpers.h"
+
+static Grid with_cells(unsigned int width, unsigned int height, std::initializer_list<std::pair<unsigned int, unsigned int> > cells)
+{
+    Grid grid(width, height);
+    for (auto const & cell : cells) {
+        grid.set(cell.first, cell.second, Cell::ALIVE);
+    }
+    return grid;
+}
+
+SCENARIO( "tile hashes are the same for a Grid and a BitGrid of the same cells", "[step][hash]" ) {
+
+    GIVEN( "random grids whose widths and heights are not whole tiles" ) {
+
+        unsigned int const sizes[][2] = { {1, 1}, {63, 5}, {64, 64}, {1100, 70}, {2049, 130} };
+
+        THEN( "every tile hashes equally from either layout, and differently once a cell changes" ) {
+            unsigned int mismatches = 0, collisions = 0;
+
+            for (auto const & size : sizes) {
+                Grid grid = random_grid(size[0], size[1], size[0]);
+                BitGrid bits(grid);
+
+                unsigned int const tiles_x = (bits.get_words_per_row() + STEP_TILE_WORDS - 1) / STEP_TILE_WORDS;
+                unsigned int const tiles_y = (size[1] + STEP_TILE_ROWS - 1) / STEP_TILE_ROWS;
+
+                for (unsigned int ty = 0; ty < tiles_y; ty++) {
+                    for (unsigned int tx = 0; tx < tiles_x; tx++) {
+                        std::uint64_t const hash = hash_bits_tile(bits, tx, ty);
+                        mismatches += (hash == hash_cells_tile(grid, tx, ty)) ? 0 : 1;
+
+                        unsigned int const x = std::min(size[0] - 1, tx * STEP_TILE_WORDS * BITGRID_WORD_BITS + 5);
+                        unsigned int const y = std::min(size[1] - 1, ty * STEP_TILE_ROWS + 3);
+                        BitGrid flipped(bits);
+                        flipped.set(x, y, (bits.get(x, y) == Cell::ALIVE) ? Cell::DEAD : Cell::ALIVE);
+                        collisions += (hash == hash_bits_tile(flipped, tx, ty)) ? 1 : 0;
+                    }
+                }
+            }
+
+            REQUIRE( mismatches == 0 );
+            REQUIRE( collisions == 0 );
+        }
+    }
+}
+
+SCENARIO( "worlds detect when they settle into a still life or oscillator", "[world][cycle]" ) {
+
+    GIVEN( "a world that is not detecting cycles" ) {
+
+        World world(with_cells(8, 8, { {1, 1}, {2, 1}, {1, 2}, {2, 2} }));
+        world.advance(5);
+
+        THEN( "it counts generations but never reports being stable" ) {
+            REQUIRE( world.get_generation() == 5 );
+            REQUIRE( world.get_cycle_window() == 0 );
+            REQUIRE_FALSE( world.is_stable() );
+            REQUIRE( world.get_period() == 0 );
+        }
+    }
+
+    GIVEN( "a block, a still life" ) {
+
+        World world(with_cells(8, 8, { {1, 1}, {2, 1}, {1, 2}, {2, 2} }));
+        world.set_cycle_window(4);
+        world.step();
+
+        THEN( "it is stable from generation 0 with period 1 after one step" ) {
+            REQUIRE( world.is_stable() );
+            REQUIRE( world.get_stable_generation() == 0 );
+            REQUIRE( world.get_period() == 1 );
+        }
+    }
+
+    GIVEN( "a blinker that first forms from a three cell L" ) {
+
+        //The L becomes a block after one generation, a pre-block that settles as a still life.
+        World block(with_cells(8, 8, { {2, 2}, {3, 2}, {2, 3} }));
+        block.set_cycle_window(4);
+        block.advance(3);
+
+        World blinker(with_cells(9, 9, { {3, 4}, {4, 4}, {5, 4} }));
+        blinker.set_cycle_window(4);
+        blinker.advance(3);
+
+        THEN( "the L is stable from generation 1 and the blinker from generation 0 with period 2" ) {
+            REQUIRE( block.get_stable_generation() == 1 );
+            REQUIRE( block.get_period() == 1 );
+            REQUIRE( blinker.get_stable_generation() == 0 );
+            REQUIRE( blinker.get_period() == 2 );
+        }
+    }
+
+    GIVEN( "a glider on an 8x8 torus, which returns to its start every 32 generations" ) {
+
+        Grid glider = with_cells(8, 8, { {1, 0}, {2, 1}, {0, 2}, {1, 2}, {2, 2} });
+
+        World wide(glider), narrow(glider);
+        wide.set_cycle_window(32);
+        narrow.set_cycle_window(31);
+        wide.advance(40, true);
+        narrow.advance(40, true);
+
+        THEN( "a window of 32 finds the period and a window of 31 does not" ) {
+            REQUIRE( wide.is_stable() );
+            REQUIRE( wide.get_stable_generation() == 0 );
+            REQUIRE( wide.get_period() == 32 );
+            REQUIRE_FALSE( narrow.is_stable() );
+        }
+    }
+
+    GIVEN( "a random soup stepped by every engine" ) {
+
+        Grid soup = random_grid(1100, 24, 4);
+
+        World reference(soup);
+        reference.set_engine(StepEngine::Bitwise);
+        reference.set_cycle_window(16);
+        reference.advance(800);
+
+        StepEngine const engines[] = { StepEngine::Bytewise, StepEngine::Tiled, StepEngine::Temporal };
+
+        THEN( "each engine finds the same generation and period" ) {
+            REQUIRE( reference.is_stable() );
+
+            for (StepEngine engine : engines) {
+                World world(soup);
+                world.set_engine(engine);
+                world.set_threads(engine == StepEngine::Tiled ? 3 : 1);
+                world.set_cycle_window(16);
+                world.advance(800);
+
+                REQUIRE( world.get_generation() == 800 );
+                REQUIRE( world.get_stable_generation() == reference.get_stable_generation() );
+                REQUIRE( world.get_period() == reference.get_period() );
+            }
+        }
+    }
+
+    GIVEN( "a stable world that is edited" ) {
+
+        World world(with_cells(8, 8, { {1, 1}, {2, 1}, {1, 2}, {2, 2} }));
+        world.set_cycle_window(4);
+        world.advance(2);
+
+        THEN( "changing the rule or size forgets the cycle" ) {
+            REQUIRE( world.is_stable() );
+
+            world.set_rule(Rule::seeds());
+            REQUIRE_FALSE( world.is_stable() );
+
+            world.set_rule(Rule::conway());
+            world.advance(2);
+            REQUIRE( world.is_stable() );
+            REQUIRE( world.get_stable_generation() == 2 );
+
+            world.resize(10, 10);
+            REQUIRE_FALSE( world.is_stable() );
+        }
+    }
+}
+
+SCENARIO( "stable worlds can fast forward", "[world][cycle]" ) {
+
+    GIVEN( "a blinker advanced a very large number of steps" ) {
+
+        Grid blinker = with_cells(9, 9, { {3, 4}, {4, 4}, {5, 4} });
+
+        World skipping(blinker);
+        skipping.set_cycle_window(4);
+        skipping.set_fast_forward(true);
+        skipping.advance(4000000001u);
+
+        World one(blinker);
+        one.step();
+
+        THEN( "it ends in the same phase as after one step, having counted every generation" ) {
+            REQUIRE( skipping.get_generation() == 4000000001ull );
+            REQUIRE( BitGrid(skipping.get_state()) == BitGrid(one.get_state()) );
+        }
+    }
+
+    GIVEN( "a random soup advanced with and without fast forwarding" ) {
+
+        Grid soup = random_grid(64, 64, 3);
+
+        World skipping(soup), stepping(soup);
+        skipping.set_engine(StepEngine::Tiled);
+        skipping.set_cycle_window(8);
+        skipping.set_fast_forward(true);
+        stepping.set_engine(StepEngine::Tiled);
+
+        skipping.advance(3001, true);
+        stepping.advance(3001, true);
+
+        THEN( "both reach the same state" ) {
+            REQUIRE( skipping.is_stable() );
+            REQUIRE( skipping.get_generation() == stepping.get_generation() );
+            REQUIRE( BitGrid(skipping.get_state()) == BitGrid(stepping.get_state()) );
+        }
+    }
+}
@@ -0,0 +1,204 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../rule.h"
+#include "../cpu_features.h"
+#include "../ensemble.h"
+#include "test_helpers.h"
+
+SCENARIO( "an ensemble holds many worlds of one size", "[ensemble]" ) {
+
+    GIVEN( "an ensemble of 70 dead 5x4 worlds" ) {
+
+        Ensemble ensemble(5, 4, 70);
+
+        THEN( "it reports its size and every world is dead" ) {
+            REQUIRE( ensemble.get_width() == 5 );
+            REQUIRE( ensemble.get_height() == 4 );
+            REQUIRE( ensemble.get_count() == 70 );
+            REQUIRE( ensemble.get_populations() == std::vector<unsigned int>(70, 0) );
+            REQUIRE( ensemble.get_stable_count() == 0 );
+        }
+
+        THEN( "worlds read back as they were set" ) {
+            Grid a = random_grid(5, 4, 1), b = random_grid(5, 4, 2);
+            ensemble.set_world(63, a);
+            ensemble.set_world(64, b);
+
+            REQUIRE( BitGrid(ensemble.get_world(63)) == BitGrid(a) );
+            REQUIRE( BitGrid(ensemble.get_world(64)) == BitGrid(b) );
+            REQUIRE( ensemble.get_population(63) == a.get_alive_cells() );
+            REQUIRE( ensemble.get_populations()[64] == b.get_alive_cells() );
+            REQUIRE( ensemble.get_population(0) == 0 );
+        }
+
+        THEN( "worlds out of range or of the wrong size are rejected" ) {
+            REQUIRE_THROWS_AS( ensemble.set_world(70, Grid(5, 4)), std::out_of_range );
+            REQUIRE_THROWS_AS( ensemble.get_world(70), std::out_of_range );
+            REQUIRE_THROWS_AS( ensemble.set_world(0, Grid(4, 5)), std::invalid_argument );
+        }
+    }
+}
+
+SCENARIO( "an ensemble steps every world like World", "[ensemble][step]" ) {
+
+    GIVEN( "130 random worlds, filling two groups and part of a third" ) {
+
+        unsigned int const sizes[][2] = { {16, 16}, {3, 7}, {37, 9} };
+        SimdLevel const levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+
+        for (SimdLevel level : levels) {
+
+            if ((int)level > (int)detected_simd_level()) {
+                continue;
+            }
+
+            set_simd_level(level);
+
+            THEN( "every world matches its own World in both topologies and for several rules at " + to_string(level) ) {
+                unsigned int mismatches = 0;
+
+                for (auto const & size : sizes) {
+                    for (int toroidal = 0; toroidal < 2; toroidal++) {
+                        for (Rule const & rule : { Rule::conway(), Rule::highlife(), Rule::parse("B0/S8") }) {
+                            Ensemble ensemble(size[0], size[1], 130);
+                            ensemble.set_rule(rule);
+                            for (unsigned int i = 0; i < 130; i++) {
+                                ensemble.set_world(i, random_grid(size[0], size[1], i));
+                            }
+
+                            ensemble.advance(9, toroidal);
+
+                            for (unsigned int i = 0; i < 130; i += 7) {
+                                World world(random_grid(size[0], size[1], i));
+                                world.set_rule(rule);
+                                world.advance(9, toroidal);
+
+                                mismatches += (BitGrid(ensemble.get_world(i)) == BitGrid(world.get_state())) ? 0 : 1;
+                                mismatches += (ensemble.get_population(i) == world.get_alive_cells()) ? 0 : 1;
+                            }
+                        }
+                    }
+                }
+
+                REQUIRE( mismatches == 0 );
+            }
+        }
+
+        set_simd_level(detected_simd_level());
+    }
+
+    GIVEN( "random worlds on tori a single cell wide or high, where a cell's own copies wrap round beside it" ) {
+
+        unsigned int const sizes[][2] = { {1, 1}, {1, 2}, {2, 1}, {1, 7}, {9, 1} };
+        Rule const rules[] = { Rule::conway(), Rule::highlife(), Rule::parse("B0/S8"), Rule::parse("B36/S0246"), Rule::parse("B/S012345678") };
+        unsigned int mismatches = 0;
+
+        for (auto const & size : sizes) {
+            for (Rule const & rule : rules) {
+                Ensemble ensemble(size[0], size[1], 70);
+                ensemble.set_rule(rule);
+                for (unsigned int i = 0; i < 70; i++) {
+                    ensemble.set_world(i, random_grid(size[0], size[1], i));
+                }
+
+                ensemble.advance(5, true);
+
+                for (unsigned int i = 0; i < 70; i += 3) {
+                    World world(random_grid(size[0], size[1], i));
+                    world.set_rule(rule);
+                    world.advance(5, true);
+
+                    mismatches += (BitGrid(ensemble.get_world(i)) == BitGrid(world.get_state())) ? 0 : 1;
+                }
+            }
+        }
+
+        THEN( "every world matches its own World, which never counts a cell as its own neighbour" ) {
+            REQUIRE( mismatches == 0 );
+        }
+    }
+}
+
+SCENARIO( "an ensemble finds the worlds that have settled", "[ensemble][cycle]" ) {
+
+    GIVEN( "200 random 16x16 soups run until stable on several threads" ) {
+
+        Ensemble ensemble(16, 16, 200);
+        ensemble.set_threads(3);
+        ensemble.set_cycle_window(16);
+        for (unsigned int i = 0; i < 200; i++) {
+            ensemble.set_world(i, random_grid(16, 16, 1000 + i));
+        }
+
+        ensemble.advance_until_stable(2000);
+
+        THEN( "each world's generation and period match World's cycle detection" ) {
+            unsigned int mismatches = 0;
+
+            for (unsigned int i = 0; i < 200; i++) {
+                World world(random_grid(16, 16, 1000 + i));
+                world.set_cycle_window(16);
+                world.advance(ensemble.get_generation(i));
+
+                mismatches += (ensemble.is_stable(i) == world.is_stable()) ? 0 : 1;
+                mismatches += (ensemble.get_stable_generation(i) == world.get_stable_generation()) ? 0 : 1;
+                mismatches += (ensemble.get_period(i) == world.get_period()) ? 0 : 1;
+                mismatches += (BitGrid(ensemble.get_world(i)) == BitGrid(world.get_state())) ? 0 : 1;
+            }
+
+            REQUIRE( mismatches == 0 );
+            REQUIRE( ensemble.get_stable_count() == 200 );
+        }
+    }
+
+    GIVEN( "a blinker and a block in one group" ) {
+
+        Grid blinker(5, 5), block(5, 5);
+        blinker.set(1, 2, Cell::ALIVE);
+        blinker.set(2, 2, Cell::ALIVE);
+        blinker.set(3, 2, Cell::ALIVE);
+        block.set(1, 1, Cell::ALIVE);
+        block.set(2, 1, Cell::ALIVE);
+        block.set(1, 2, Cell::ALIVE);
+        block.set(2, 2, Cell::ALIVE);
+
+        Ensemble ensemble(5, 5, 2);
+        ensemble.set_world(0, blinker);
+        ensemble.set_world(1, block);
+
+        THEN( "a window of 1 finds only the block, and growing the window finds the blinker later" ) {
+            ensemble.set_cycle_window(1);
+            ensemble.advance(4);
+            REQUIRE_FALSE( ensemble.is_stable(0) );
+            REQUIRE( ensemble.get_period(1) == 1 );
+            REQUIRE( ensemble.get_stable_generation(1) == 0 );
+
+            ensemble.set_cycle_window(2);
+            ensemble.advance(2);
+            REQUIRE( ensemble.get_period(0) == 2 );
+            REQUIRE( ensemble.get_stable_generation(0) == 4 );
+            REQUIRE( ensemble.get_generation(0) == 6 );
+            REQUIRE( BitGrid(ensemble.get_world(0)) == BitGrid(blinker) );
+        }
+
+        THEN( "without a window nothing is found and advance_until_stable takes every step" ) {
+            ensemble.set_cycle_window(0);
+            ensemble.advance_until_stable(5);
+            REQUIRE( ensemble.get_generation(1) == 5 );
+            REQUIRE( ensemble.get_stable_count() == 0 );
+        }
+    }
+}
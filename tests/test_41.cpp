@@ -0,0 +1,178 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <stdexcept>
+#include <sstream>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../ensemble.h"
+#include "../soup.h"
+
+SCENARIO( "soups are reproducible from their seed and index", "[soup]" ) {
+
+    GIVEN( "the counter based generator" ) {
+
+        THEN( "each word depends only on its seed, stream and counter" ) {
+            REQUIRE( Soup::random(1, 2, 3) == Soup::random(1, 2, 3) );
+            REQUIRE( Soup::random(1, 2, 3) != Soup::random(1, 2, 4) );
+            REQUIRE( Soup::random(1, 2, 3) != Soup::random(1, 3, 3) );
+            REQUIRE( Soup::random(1, 2, 3) != Soup::random(2, 2, 3) );
+        }
+
+        THEN( "its words are close to evenly spread over their bits" ) {
+            unsigned int ones = 0;
+            for (unsigned int i = 0; i < 4096; i++) {
+                ones += popcount64(Soup::random(7, i / 64, i % 64));
+            }
+
+            REQUIRE( ones > 4096 * 32 - 2048 );
+            REQUIRE( ones < 4096 * 32 + 2048 );
+        }
+    }
+
+    GIVEN( "soups generated one at a time" ) {
+
+        Grid soup = Soup::generate(16, 16, 0.5, 1, 42);
+
+        THEN( "the same soup comes out every time and others differ" ) {
+            REQUIRE( BitGrid(Soup::generate(16, 16, 0.5, 1, 42)) == BitGrid(soup) );
+            REQUIRE_FALSE( BitGrid(Soup::generate(16, 16, 0.5, 1, 43)) == BitGrid(soup) );
+            REQUIRE_FALSE( BitGrid(Soup::generate(16, 16, 0.5, 2, 42)) == BitGrid(soup) );
+        }
+
+        THEN( "the density sets the fraction of live cells" ) {
+            unsigned int alive = 0;
+            for (unsigned int i = 0; i < 100; i++) {
+                alive += Soup::generate(32, 32, 0.25, 3, i).get_alive_cells();
+            }
+
+            REQUIRE( alive > 102400 / 4 - 1000 );
+            REQUIRE( alive < 102400 / 4 + 1000 );
+            REQUIRE( Soup::generate(9, 5, 0.0, 1, 0).get_alive_cells() == 0 );
+            REQUIRE( Soup::generate(9, 5, 1.0, 1, 0).get_alive_cells() == 45 );
+        }
+
+        THEN( "densities outside 0 to 1 are rejected" ) {
+            REQUIRE_THROWS_AS( Soup::generate(4, 4, -0.1, 1, 0), std::invalid_argument );
+            REQUIRE_THROWS_AS( Soup::generate(4, 4, 1.5, 1, 0), std::invalid_argument );
+        }
+    }
+
+    GIVEN( "an ensemble filled with soups on several threads" ) {
+
+        Ensemble soups(12, 10, 150);
+        soups.set_threads(3);
+        Soup::generate(soups, 0.4, 9, 500);
+
+        THEN( "world i holds soup first_index + i, and refilling starts again from generation 0" ) {
+            soups.advance(5);
+            Soup::generate(soups, 0.4, 9, 500);
+            REQUIRE( soups.get_generation(149) == 0 );
+
+            unsigned int mismatches = 0;
+            for (unsigned int i = 0; i < 150; i++) {
+                mismatches += (BitGrid(soups.get_world(i)) == BitGrid(Soup::generate(12, 10, 0.4, 9, 500 + i))) ? 0 : 1;
+            }
+
+            REQUIRE( mismatches == 0 );
+        }
+    }
+}
+
+SCENARIO( "a census counts what a batch of soups settled into", "[soup][census]" ) {
+
+    GIVEN( "300 16x16 soups run until they settle" ) {
+
+        Ensemble soups(16, 16, 300);
+        soups.set_cycle_window(SOUP_CYCLE_WINDOW);
+        Soup::generate(soups, 0.5, 1);
+        soups.advance_until_stable(SOUP_MAX_GENERATIONS);
+
+        SoupCensus census = Soup::census(soups, 1000);
+
+        THEN( "every soup is counted once and the counts agree with the ensemble" ) {
+            unsigned int periodic = 0;
+            for (auto const & period : census.periods) {
+                periodic += period.second;
+            }
+
+            REQUIRE( census.soups == 300 );
+            REQUIRE( census.soups - census.unsettled == soups.get_stable_count() );
+            REQUIRE( periodic == soups.get_stable_count() );
+            REQUIRE( census.died + census.still + census.oscillating == soups.get_stable_count() );
+            REQUIRE( census.still + census.died == census.periods[1] );
+        }
+
+        THEN( "the longest soup is the settled soup that took most generations, numbered in the batch" ) {
+            unsigned int const longest = (unsigned int)(census.longest_soup - 1000);
+
+            unsigned int longer = 0;
+            for (unsigned int i = 0; i < 300; i++) {
+                longer += (soups.is_stable(i) && soups.get_stable_generation(i) > census.longest_generations) ? 1 : 0;
+            }
+
+            REQUIRE( soups.is_stable(longest) );
+            REQUIRE( soups.get_stable_generation(longest) == census.longest_generations );
+            REQUIRE( longer == 0 );
+        }
+
+        THEN( "the longest soup settles at the same generation when run on its own in a World" ) {
+            World world(Soup::generate(16, 16, 0.5, 1, census.longest_soup - 1000));
+            world.set_cycle_window(SOUP_CYCLE_WINDOW);
+            world.advance(census.longest_generations + SOUP_CYCLE_WINDOW);
+
+            REQUIRE( world.is_stable() );
+            REQUIRE( world.get_stable_generation() == census.longest_generations );
+        }
+
+        THEN( "the report names every outcome" ) {
+            std::ostringstream report;
+            report << census;
+
+            REQUIRE( report.str().find("Soups 300") != std::string::npos );
+            REQUIRE( report.str().find("Still lifes") != std::string::npos );
+            REQUIRE( report.str().find("Generations to settle") != std::string::npos );
+        }
+    }
+
+    GIVEN( "150 soups run in batches through an ensemble of 64" ) {
+
+        Ensemble batch(10, 10, 64);
+        batch.set_cycle_window(SOUP_CYCLE_WINDOW);
+        batch.set_rule(Rule::highlife());
+        SoupCensus census = Soup::run(batch, 0.5, 5, 150, 2000, true);
+
+        THEN( "the census matches running every soup in one ensemble" ) {
+            Ensemble soups(10, 10, 150);
+            soups.set_cycle_window(SOUP_CYCLE_WINDOW);
+            soups.set_rule(Rule::highlife());
+            Soup::generate(soups, 0.5, 5);
+            soups.advance_until_stable(2000, true);
+            SoupCensus whole = Soup::census(soups);
+
+            REQUIRE( census.soups == 150 );
+            REQUIRE( census.unsettled == whole.unsettled );
+            REQUIRE( census.died == whole.died );
+            REQUIRE( census.still == whole.still );
+            REQUIRE( census.oscillating == whole.oscillating );
+            REQUIRE( census.periods == whole.periods );
+            REQUIRE( census.total_generations == whole.total_generations );
+            REQUIRE( census.longest_generations == whole.longest_generations );
+            REQUIRE( census.longest_soup == whole.longest_soup );
+            REQUIRE( census.total_population == whole.total_population );
+            REQUIRE( census.largest_population == whole.largest_population );
+        }
+
+        THEN( "soups cannot be run in an empty ensemble" ) {
+            Ensemble empty;
+            REQUIRE_THROWS_AS( Soup::run(empty, 0.5, 1, 10), std::invalid_argument );
+        }
+    }
+}
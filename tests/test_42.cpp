@@ -0,0 +1,254 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <sstream>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+#include "../zoo.h"
+#include "../census.h"
+
+static Grid pentadecathlon()
+{
+    Grid grid(10, 3);
+    for (unsigned int x = 0; x < 10; x++) {
+        grid.set(x, 1, (x == 2 || x == 7) ? Cell::DEAD : Cell::ALIVE);
+    }
+    grid.set(2, 0, Cell::ALIVE);
+    grid.set(2, 2, Cell::ALIVE);
+    grid.set(7, 0, Cell::ALIVE);
+    grid.set(7, 2, Cell::ALIVE);
+
+    return grid;
+}
+
+SCENARIO( "grids can be reflected", "[grid][reflect]" ) {
+
+    GIVEN( "a 3x2 grid with two live cells" ) {
+
+        Grid grid(3, 2);
+        grid.set(0, 0, Cell::ALIVE);
+        grid.set(1, 1, Cell::ALIVE);
+
+        Grid reflected = grid.reflect();
+
+        THEN( "the reflection is mirrored left to right and keeps its size" ) {
+            REQUIRE( reflected.get_width() == 3 );
+            REQUIRE( reflected.get_height() == 2 );
+            REQUIRE( reflected.get(2, 0) == Cell::ALIVE );
+            REQUIRE( reflected.get(1, 1) == Cell::ALIVE );
+            REQUIRE( reflected.get_alive_cells() == 2 );
+        }
+
+        THEN( "reflecting twice gives the original" ) {
+            REQUIRE( BitGrid(reflected.reflect()) == BitGrid(grid) );
+        }
+    }
+}
+
+SCENARIO( "grids are split into objects", "[census][components]" ) {
+
+    GIVEN( "a grid with a block, a glider and a lightweight spaceship far apart" ) {
+
+        Grid grid(40, 30);
+        grid.merge(Zoo::glider(), 30, 2);
+        grid.merge(Zoo::light_weight_spaceship(), 4, 20);
+        grid.set(2, 2, Cell::ALIVE);
+        grid.set(3, 2, Cell::ALIVE);
+        grid.set(2, 3, Cell::ALIVE);
+        grid.set(3, 3, Cell::ALIVE);
+
+        std::vector<Grid> objects = ObjectCensus::components(grid);
+
+        THEN( "each is one object cropped to its bounding box, in order of their first cell" ) {
+            REQUIRE( objects.size() == 3 );
+            REQUIRE( objects[0].get_width() == 2 );
+            REQUIRE( objects[0].get_alive_cells() == 4 );
+            REQUIRE( BitGrid(objects[1]) == BitGrid(Zoo::glider()) );
+            REQUIRE( BitGrid(objects[2]) == BitGrid(Zoo::light_weight_spaceship()) );
+        }
+    }
+
+    GIVEN( "live cells at different distances" ) {
+
+        Grid grid(20, 5);
+        grid.set(0, 0, Cell::ALIVE);
+        grid.set(2, 2, Cell::ALIVE);
+        grid.set(5, 2, Cell::ALIVE);
+        grid.set(19, 4, Cell::ALIVE);
+
+        THEN( "cells within two of each other join and cells three apart do not" ) {
+            std::vector<Grid> objects = ObjectCensus::components(grid);
+
+            REQUIRE( objects.size() == 3 );
+            REQUIRE( objects[0].get_width() == 3 );
+            REQUIRE( objects[0].get_height() == 3 );
+            REQUIRE( objects[0].get_alive_cells() == 2 );
+            REQUIRE( objects[1].get_alive_cells() == 1 );
+            REQUIRE( objects[2].get_alive_cells() == 1 );
+        }
+
+        THEN( "an object's box holds only its own cells" ) {
+            Grid hook(9, 9);
+            for (unsigned int i = 0; i < 9; i++) {
+                hook.set(i, 0, Cell::ALIVE);
+                hook.set(0, i, Cell::ALIVE);
+            }
+            hook.set(5, 5, Cell::ALIVE);
+
+            std::vector<Grid> objects = ObjectCensus::components(hook);
+
+            REQUIRE( objects.size() == 2 );
+            REQUIRE( objects[0].get_width() == 9 );
+            REQUIRE( objects[0].get_alive_cells() == 17 );
+            REQUIRE( objects[1].get_alive_cells() == 1 );
+        }
+
+        THEN( "an empty grid has no objects" ) {
+            REQUIRE( ObjectCensus::components(Grid(8, 8)).empty() );
+            REQUIRE( ObjectCensus::components(Grid()).empty() );
+        }
+    }
+}
+
+SCENARIO( "objects are the same in every orientation", "[census][canonical]" ) {
+
+    GIVEN( "the r-pentomino" ) {
+
+        Grid r = Zoo::r_pentomino();
+        std::string key = ObjectCensus::canonical(r);
+
+        THEN( "all eight rotations and reflections have the same canonical form" ) {
+            unsigned int mismatches = 0;
+            for (int rotation = 0; rotation < 4; rotation++) {
+                mismatches += (ObjectCensus::canonical(r.rotate(rotation)) == key) ? 0 : 1;
+                mismatches += (ObjectCensus::canonical(r.reflect().rotate(rotation)) == key) ? 0 : 1;
+            }
+
+            REQUIRE( mismatches == 0 );
+        }
+
+        THEN( "other objects have other forms" ) {
+            REQUIRE( ObjectCensus::canonical(Zoo::glider()) != key );
+            REQUIRE( ObjectCensus::canonical(Zoo::light_weight_spaceship()) != key );
+        }
+    }
+}
+
+SCENARIO( "a census counts known and unknown objects", "[census]" ) {
+
+    GIVEN( "a grid of known objects in various phases and orientations" ) {
+
+        World lwss(Grid(12, 12));
+        Grid phase(12, 12);
+        phase.merge(Zoo::light_weight_spaceship(), 2, 4);
+        lwss = World(phase);
+        lwss.step();
+
+        Grid grid(64, 48);
+        grid.merge(Zoo::glider().rotate(1).reflect(), 2, 2);
+        grid.merge(Zoo::glider(), 40, 2);
+        grid.merge(lwss.get_state(), 20, 30);
+        grid.merge(Zoo::r_pentomino(), 50, 40);
+        for (unsigned int x : { 10u, 20u, 30u }) {
+            grid.set(x, 14, Cell::ALIVE);
+            grid.set(x + 1, 14, Cell::ALIVE);
+            grid.set(x, 15, Cell::ALIVE);
+            grid.set(x + 1, 15, Cell::ALIVE);
+        }
+        grid.set(50, 10, Cell::ALIVE);
+        grid.set(50, 11, Cell::ALIVE);
+        grid.set(50, 12, Cell::ALIVE);
+
+        ObjectCensus census;
+        census.count(grid);
+
+        THEN( "each object is counted under its name" ) {
+            REQUIRE( census.get_count("block") == 3 );
+            REQUIRE( census.get_count("glider") == 2 );
+            REQUIRE( census.get_count("lightweight spaceship") == 1 );
+            REQUIRE( census.get_count("blinker") == 1 );
+            REQUIRE( census.get_count("r-pentomino") == 1 );
+            REQUIRE( census.get_count("beehive") == 0 );
+            REQUIRE( census.get_total() == 8 );
+        }
+
+        THEN( "entries are most common first and know their kind and period" ) {
+            std::vector<CensusEntry> entries = census.get_entries();
+
+            REQUIRE( entries.size() == 5 );
+            REQUIRE( entries[0].name == "block" );
+            REQUIRE( entries[0].kind == ObjectKind::StillLife );
+            REQUIRE( entries[0].period == 1 );
+            REQUIRE( entries[1].name == "glider" );
+            REQUIRE( entries[1].kind == ObjectKind::Spaceship );
+            REQUIRE( entries[1].period == 4 );
+
+            unsigned int checked = 0;
+            for (CensusEntry const & entry : entries) {
+                if (entry.name == "blinker") {
+                    REQUIRE( entry.kind == ObjectKind::Oscillator );
+                    REQUIRE( entry.period == 2 );
+                    checked++;
+                }
+                if (entry.name == "r-pentomino") {
+                    REQUIRE( entry.kind == ObjectKind::Other );
+                    REQUIRE( entry.period == 0 );
+                    checked++;
+                }
+            }
+            REQUIRE( checked == 2 );
+        }
+
+        THEN( "counts add up over grids until cleared, and are reported by name" ) {
+            census.count(grid);
+            REQUIRE( census.get_count("glider") == 4 );
+
+            std::ostringstream report;
+            report << census;
+            REQUIRE( report.str().find("6 | block | still life") != std::string::npos );
+            REQUIRE( report.str().find("blinker | oscillator p2") != std::string::npos );
+
+            census.clear_counts();
+            REQUIRE( census.get_total() == 0 );
+            REQUIRE( census.get_entries().empty() );
+        }
+    }
+
+    GIVEN( "objects the census does not know" ) {
+
+        Grid grid(40, 24);
+        grid.merge(pentadecathlon(), 4, 6);
+        grid.merge(pentadecathlon().rotate(1), 25, 6);
+
+        ObjectCensus census;
+        census.count(grid);
+
+        THEN( "they are stepped to find their kind and counted together under a description" ) {
+            std::vector<CensusEntry> entries = census.get_entries();
+
+            REQUIRE( entries.size() == 1 );
+            REQUIRE( entries[0].kind == ObjectKind::Oscillator );
+            REQUIRE( entries[0].period == 15 );
+            REQUIRE( entries[0].count == 2 );
+            REQUIRE( entries[0].name == "unnamed p15 oscillator (12 cells)" );
+        }
+
+        THEN( "naming one renames its entry, and its other phases are found under that name" ) {
+            census.add_known("pentadecathlon", pentadecathlon());
+
+            World world(grid);
+            world.advance(3);
+            census.count(world.get_state());
+
+            REQUIRE( census.get_count("pentadecathlon") == 4 );
+        }
+    }
+}
@@ -0,0 +1,163 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../rule.h"
+#include "../zoo.h"
+#include "test_helpers.h"
+
+static std::uint64_t file_size(std::string const & path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    return std::uint64_t(file.tellg());
+}
+
+SCENARIO( "binary files hold grids of any size with their rule and generation", "[zoo][binary]" ) {
+
+    GIVEN( "a 1000x37 random grid, not a whole number of words wide" ) {
+
+        Grid grid = random_grid(1000, 37, 5);
+        std::string const path = "../test_outputs/SAVE_BINARY_LARGE.bgol";
+
+        Zoo::save_binary(path, grid, Rule::highlife(), 123456789012ULL);
+
+        THEN( "the file is the header then 16 words per row" ) {
+            REQUIRE( file_size(path) == BGOL_HEADER_BYTES + 37 * 16 * 8 );
+        }
+
+        THEN( "it reads back with its rule and generation, unpacked or packed" ) {
+            Rule rule;
+            std::uint64_t generation = 0;
+
+            Grid loaded = Zoo::load_binary(path, rule, generation);
+            REQUIRE( BitGrid(loaded) == BitGrid(grid) );
+            REQUIRE( rule == Rule::highlife() );
+            REQUIRE( generation == 123456789012ULL );
+
+            REQUIRE( Zoo::load_packed_binary(path, rule, generation) == BitGrid(grid) );
+            REQUIRE( BitGrid(Zoo::load_binary(path)) == BitGrid(grid) );
+        }
+
+        THEN( "a packed grid saves to the same file" ) {
+            std::string const packed = "../test_outputs/SAVE_BINARY_LARGE_PACKED.bgol";
+            Zoo::save_binary(packed, BitGrid(grid), Rule::highlife(), 123456789012ULL);
+
+            std::ifstream a(path, std::ios::binary), b(packed, std::ios::binary);
+            std::string bytes_a((std::istreambuf_iterator<char>(a)), std::istreambuf_iterator<char>());
+            std::string bytes_b((std::istreambuf_iterator<char>(b)), std::istreambuf_iterator<char>());
+            REQUIRE( bytes_a == bytes_b );
+        }
+
+        THEN( "a grid saved without a rule reads as Conway's Game of Life at generation 0" ) {
+            Zoo::save_binary(path, grid);
+
+            Rule rule = Rule::seeds();
+            std::uint64_t generation = 1;
+            Zoo::load_binary(path, rule, generation);
+
+            REQUIRE( rule == Rule::conway() );
+            REQUIRE( generation == 0 );
+        }
+    }
+
+    GIVEN( "grids with no cells" ) {
+
+        THEN( "they round trip" ) {
+            Zoo::save_binary("../test_outputs/SAVE_BINARY_EMPTY.bgol", Grid(0, 0));
+            Zoo::save_binary("../test_outputs/SAVE_BINARY_FLAT.bgol", Grid(70, 0));
+
+            REQUIRE( Zoo::load_binary("../test_outputs/SAVE_BINARY_EMPTY.bgol").get_total_cells() == 0 );
+            REQUIRE( Zoo::load_binary("../test_outputs/SAVE_BINARY_FLAT.bgol").get_width() == 70 );
+        }
+    }
+
+    GIVEN( "a legacy 16 byte file" ) {
+
+        THEN( "it still reads, as Conway's Game of Life at generation 0" ) {
+            Rule rule = Rule::seeds();
+            std::uint64_t generation = 1;
+            Grid glider = Zoo::load_binary("../test_inputs/GLIDER.bgol", rule, generation);
+
+            REQUIRE( glider.get_width() == 6 );
+            REQUIRE( glider.get_alive_cells() == 5 );
+            REQUIRE( glider.get(2, 1) == Cell::ALIVE );
+            REQUIRE( glider.get(3, 2) == Cell::ALIVE );
+            REQUIRE( glider.get(1, 3) == Cell::ALIVE );
+            REQUIRE( rule == Rule::conway() );
+            REQUIRE( generation == 0 );
+        }
+
+        THEN( "a truncated one still throws" ) {
+            REQUIRE_THROWS_AS( Zoo::load_binary("../test_inputs/MALFORMED_DATA.bgol"), std::runtime_error );
+        }
+    }
+}
+
+SCENARIO( "corrupt binary files are rejected", "[zoo][binary][exception]" ) {
+
+    GIVEN( "a valid 100x10 file" ) {
+
+        std::string const path = "../test_outputs/SAVE_BINARY_CORRUPT.bgol";
+        Zoo::save_binary(path, random_grid(100, 10, 6));
+
+        THEN( "an unknown version is rejected" ) {
+            std::uint32_t const version = 99;
+            patch_file(path, 4, &version, sizeof(version));
+            REQUIRE_THROWS_AS( Zoo::load_binary(path), std::runtime_error );
+        }
+
+        THEN( "a row size that does not match the width is rejected" ) {
+            std::uint32_t const words = 3;
+            patch_file(path, 20, &words, sizeof(words));
+            REQUIRE_THROWS_AS( Zoo::load_binary(path), std::runtime_error );
+        }
+
+        THEN( "a rule with bits above survival on 8 set is rejected" ) {
+            std::uint32_t const rule = 0xFFFFFFFF;
+            patch_file(path, 16, &rule, sizeof(rule));
+            REQUIRE_THROWS_AS( Zoo::load_binary(path), std::runtime_error );
+        }
+
+        THEN( "a height larger than the file holds is rejected before anything is allocated" ) {
+            std::uint32_t const height = 0x7FFFFFFF;
+            patch_file(path, 12, &height, sizeof(height));
+            REQUIRE_THROWS_AS( Zoo::load_binary(path), std::runtime_error );
+        }
+
+        THEN( "a live cell past the end of a row is rejected" ) {
+            std::uint64_t const word = std::uint64_t(1) << 63;
+            patch_file(path, BGOL_HEADER_BYTES + 8, &word, sizeof(word));
+            REQUIRE_THROWS_AS( Zoo::load_binary(path), std::runtime_error );
+        }
+
+        THEN( "a file cut short is rejected" ) {
+            std::ifstream in(path, std::ios::binary);
+            std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            in.close();
+
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out.write(bytes.data(), bytes.size() - 1);
+            out.close();
+
+            REQUIRE_THROWS_AS( Zoo::load_binary(path), std::runtime_error );
+
+            std::ofstream header(path, std::ios::binary | std::ios::trunc);
+            header.write(bytes.data(), 20);
+            header.close();
+
+            REQUIRE_THROWS_AS( Zoo::load_binary(path), std::runtime_error );
+        }
+    }
+}
@@ -0,0 +1,236 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../rule.h"
+#include "../world.h"
+#include "../zoo.h"
+#include "test_helpers.h"
+
+SCENARIO( "binary files map into memory as packed grids", "[zoo][binary][map]" ) {
+
+    GIVEN( "files of grids a whole number of words wide and not" ) {
+
+        unsigned int const widths[] = { 128, 1000 };
+        unsigned int mismatches = 0;
+
+        for (unsigned int width : widths) {
+            Grid grid = random_grid(width, 45, width);
+            std::string const path = "../test_outputs/MAP_BINARY_" + std::to_string(width) + ".bgol";
+            Zoo::save_binary(path, grid, Rule::highlife(), 42);
+
+            Rule rule;
+            std::uint64_t generation = 0;
+            BitGrid mapped = Zoo::map_binary(path, rule, generation);
+
+            mismatches += (mapped == BitGrid(grid)) ? 0 : 1;
+            mismatches += (rule == Rule::highlife() && generation == 42) ? 0 : 1;
+            mismatches += mapped.is_external() ? 0 : 1;
+            mismatches += (mapped.get_alive_cells() == grid.get_alive_cells()) ? 0 : 1;
+            mismatches += (std::uintptr_t(mapped.row(0)) % 64 == 0) ? 0 : 1;
+        }
+
+        THEN( "each maps to the grid saved, with its rule and generation, borrowing aligned words" ) {
+            REQUIRE( mismatches == 0 );
+        }
+    }
+
+    GIVEN( "a mapped grid" ) {
+
+        Grid grid = random_grid(200, 30, 7);
+        std::string const path = "../test_outputs/MAP_BINARY_200.bgol";
+        Zoo::save_binary(path, grid);
+
+        Rule rule;
+        std::uint64_t generation = 0;
+        BitGrid mapped = Zoo::map_binary(path, rule, generation);
+
+        THEN( "a copy owns its words, so writing to it leaves the mapped grid alone" ) {
+            BitGrid copy = mapped;
+            REQUIRE_FALSE( copy.is_external() );
+
+            copy.clear();
+            REQUIRE( mapped == BitGrid(grid) );
+
+            copy = mapped;
+            REQUIRE( copy == mapped );
+            REQUIRE_FALSE( copy.is_external() );
+        }
+
+        THEN( "writing to it never changes the file" ) {
+            mapped.set(0, 0, mapped.get(0, 0) == Cell::ALIVE ? Cell::DEAD : Cell::ALIVE);
+            mapped.clear();
+            REQUIRE( mapped.get_alive_cells() == 0 );
+
+            REQUIRE( Zoo::load_packed_binary(path, rule, generation) == BitGrid(grid) );
+        }
+
+        THEN( "it outlives a resize, which copies it into words of its own" ) {
+            mapped.resize(250, 30);
+            REQUIRE_FALSE( mapped.is_external() );
+            REQUIRE( mapped.crop(0, 0, 200, 30) == BitGrid(grid) );
+        }
+    }
+
+    GIVEN( "a world moved from a mapped grid" ) {
+
+        Grid grid = random_grid(300, 120, 8);
+        std::string const path = "../test_outputs/MAP_BINARY_300.bgol";
+        Zoo::save_binary(path, grid, Rule::highlife(), 0);
+
+        StepEngine const engines[] = { StepEngine::Bitwise, StepEngine::Tiled, StepEngine::Temporal };
+        unsigned int mismatches = 0;
+        unsigned int still_mapped = 0;
+
+        for (StepEngine engine : engines) {
+            for (bool toroidal : { false, true }) {
+                Rule rule;
+                std::uint64_t generation = 0;
+
+                World mapped(Zoo::map_binary(path, rule, generation));
+                mapped.set_engine(engine);
+                mapped.set_rule(rule);
+
+                World loaded(grid);
+                loaded.set_engine(engine);
+                loaded.set_rule(Rule::highlife());
+
+                for (unsigned int step = 0; step < 9; step++) {
+                    mapped.step(toroidal);
+                    loaded.step(toroidal);
+                    mismatches += (BitGrid(mapped.get_state()) == BitGrid(loaded.get_state())) ? 0 : 1;
+                    still_mapped += mapped.get_packed_state().is_external() ? 1 : 0;
+                }
+
+                mapped.advance(20, toroidal);
+                loaded.advance(20, toroidal);
+                mismatches += (BitGrid(mapped.get_state()) == BitGrid(loaded.get_state())) ? 0 : 1;
+            }
+        }
+
+        THEN( "it steps the same as a world of the loaded grid, under every packed engine" ) {
+            REQUIRE( mismatches == 0 );
+        }
+
+        THEN( "it lets go of the mapping after its first step rather than stepping into it" ) {
+            REQUIRE( still_mapped == 0 );
+        }
+
+        THEN( "the file still holds the initial state" ) {
+            Rule rule;
+            std::uint64_t generation = 0;
+            REQUIRE( Zoo::load_packed_binary(path, rule, generation) == BitGrid(grid) );
+        }
+    }
+
+    GIVEN( "files that cannot be mapped" ) {
+
+        THEN( "a legacy file is read instead, as Conway's Game of Life at generation 0" ) {
+            Rule rule = Rule::seeds();
+            std::uint64_t generation = 1;
+            BitGrid glider = Zoo::map_binary("../test_inputs/GLIDER.bgol", rule, generation);
+
+            REQUIRE( glider == BitGrid(Zoo::load_binary("../test_inputs/GLIDER.bgol")) );
+            REQUIRE_FALSE( glider.is_external() );
+            REQUIRE( rule == Rule::conway() );
+            REQUIRE( generation == 0 );
+        }
+
+        THEN( "a grid with no cells opens without a mapping" ) {
+            Zoo::save_binary("../test_outputs/MAP_BINARY_FLAT.bgol", Grid(70, 0));
+
+            Rule rule;
+            std::uint64_t generation = 0;
+            BitGrid flat = Zoo::map_binary("../test_outputs/MAP_BINARY_FLAT.bgol", rule, generation);
+
+            REQUIRE( flat.get_width() == 70 );
+            REQUIRE( flat.get_total_cells() == 0 );
+        }
+    }
+}
+
+SCENARIO( "mapped files are opened without checking the bits past the end of each row", "[zoo][binary][map]" ) {
+
+    GIVEN( "a 100x10 file with a live cell past the end of every row" ) {
+
+        Grid grid = random_grid(100, 10, 10);
+        std::string const path = "../test_outputs/MAP_BINARY_PADDING.bgol";
+        Zoo::save_binary(path, grid);
+
+        BitGrid const loaded(grid);
+        for (unsigned int y = 0; y < 10; y++) {
+            std::uint64_t const word = loaded.row(y)[1] | (std::uint64_t(1) << 63);
+            patch_file(path, BGOL_HEADER_BYTES + (y * 2 + 1) * sizeof(word), &word, sizeof(word));
+        }
+
+        Rule rule;
+        std::uint64_t generation = 0;
+        BitGrid mapped = Zoo::map_binary(path, rule, generation);
+
+        THEN( "the cells past the end are ignored when counted, compared and copied" ) {
+            REQUIRE( mapped.get_alive_cells() == loaded.get_alive_cells() );
+            REQUIRE( mapped == loaded );
+            REQUIRE( BitGrid(mapped).row(0)[1] == loaded.row(0)[1] );
+        }
+
+        THEN( "a world moved from the grid steps as if they were not there" ) {
+            World mapped_world(std::move(mapped));
+            World loaded_world(grid);
+
+            mapped_world.advance(5);
+            loaded_world.advance(5);
+
+            REQUIRE( BitGrid(mapped_world.get_state()) == BitGrid(loaded_world.get_state()) );
+            REQUIRE( mapped_world.get_packed_state().row(0)[1] >> 36 == 0 );
+        }
+    }
+}
+
+SCENARIO( "corrupt binary files are rejected when mapped", "[zoo][binary][map][exception]" ) {
+
+    GIVEN( "a valid 100x10 file" ) {
+
+        std::string const path = "../test_outputs/MAP_BINARY_CORRUPT.bgol";
+        Zoo::save_binary(path, random_grid(100, 10, 9));
+
+        Rule rule;
+        std::uint64_t generation = 0;
+
+        THEN( "a missing file is rejected" ) {
+            REQUIRE_THROWS_AS( Zoo::map_binary("../test_outputs/MAP_BINARY_MISSING.bgol", rule, generation), std::runtime_error );
+        }
+
+        THEN( "an unknown version is rejected" ) {
+            std::uint32_t const version = 99;
+            patch_file(path, 4, &version, sizeof(version));
+            REQUIRE_THROWS_AS( Zoo::map_binary(path, rule, generation), std::runtime_error );
+        }
+
+        THEN( "a height larger than the file holds is rejected" ) {
+            std::uint32_t const height = 0x7FFFFFFF;
+            patch_file(path, 12, &height, sizeof(height));
+            REQUIRE_THROWS_AS( Zoo::map_binary(path, rule, generation), std::runtime_error );
+        }
+
+        THEN( "a file cut short of its header is rejected" ) {
+            std::ofstream header(path, std::ios::binary | std::ios::trunc);
+            header.write(BGOL_MAGIC, 4);
+            header.close();
+
+            REQUIRE_THROWS_AS( Zoo::map_binary(path, rule, generation), std::runtime_error );
+        }
+    }
+}
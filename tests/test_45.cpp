@@ -0,0 +1,171 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../cpu_features.h"
+#include "../zoo.h"
+#include "test_helpers.h"
+
+SCENARIO( "ascii files are read a block of rows at a time", "[zoo][load_ascii]" ) {
+
+    SimdLevel const levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+
+    for (SimdLevel level : levels) {
+
+        if ((int)level > (int)detected_simd_level()) {
+            continue;
+        }
+
+        set_simd_level(level);
+
+        GIVEN( "grids of many sizes saved as ascii at " + to_string(level) ) {
+
+            unsigned int const sizes[][2] = { {0, 0}, {1, 1}, {31, 5}, {32, 3}, {33, 7}, {100, 40}, {2000, 700} };
+            unsigned int mismatches = 0;
+
+            for (auto const & size : sizes) {
+                Grid grid = random_grid(size[0], size[1], size[0] + size[1]);
+                Zoo::save_ascii("../test_outputs/LOAD_ASCII_BLOCKS.gol", grid);
+
+                Grid loaded = Zoo::load_ascii("../test_outputs/LOAD_ASCII_BLOCKS.gol");
+                mismatches += (loaded.get_width() == size[0] && loaded.get_height() == size[1]) ? 0 : 1;
+                mismatches += (BitGrid(loaded) == BitGrid(grid)) ? 0 : 1;
+            }
+
+            //The largest is over a megabyte, too big to keep
+            std::remove("../test_outputs/LOAD_ASCII_BLOCKS.gol");
+
+            THEN( "they read back unchanged" ) {
+                REQUIRE( mismatches == 0 );
+            }
+        }
+
+        GIVEN( "grids saved with Windows line endings at " + to_string(level) ) {
+
+            unsigned int const sizes[][2] = { {0, 0}, {1, 1}, {31, 5}, {32, 3}, {33, 7}, {100, 40} };
+            unsigned int mismatches = 0;
+
+            for (auto const & size : sizes) {
+                Grid grid = random_grid(size[0], size[1], size[0] * size[1]);
+
+                std::string text = std::to_string(size[0]) + " " + std::to_string(size[1]) + "\r\n";
+                for (unsigned int y = 0; y < size[1]; y++) {
+                    for (unsigned int x = 0; x < size[0]; x++) {
+                        text += char(grid.get(x, y));
+                    }
+                    text += "\r\n";
+                }
+
+                write_file("../test_outputs/LOAD_ASCII_CRLF.gol", text);
+
+                Grid loaded = Zoo::load_ascii("../test_outputs/LOAD_ASCII_CRLF.gol");
+                mismatches += (loaded.get_width() == size[0] && loaded.get_height() == size[1]) ? 0 : 1;
+                mismatches += (BitGrid(loaded) == BitGrid(grid)) ? 0 : 1;
+            }
+
+            THEN( "they read back unchanged" ) {
+                REQUIRE( mismatches == 0 );
+            }
+        }
+
+        GIVEN( "a bad character at every position of a row at " + to_string(level) ) {
+
+            unsigned int const width = 70;
+            unsigned int missed = 0;
+
+            for (unsigned int x = 0; x <= width; x++) {
+                std::string row(width, ' ');
+                row += '\n';
+                row[x] = 'O';
+
+                write_file("../test_outputs/LOAD_ASCII_BAD.gol", "70 2\n" + std::string(width, '#') + "\n" + row);
+
+                try {
+                    Zoo::load_ascii("../test_outputs/LOAD_ASCII_BAD.gol");
+                    missed++;
+                }
+                catch (std::runtime_error const &) {
+                }
+            }
+
+            THEN( "every one is rejected" ) {
+                REQUIRE( missed == 0 );
+            }
+        }
+    }
+
+    set_simd_level(detected_simd_level());
+}
+
+SCENARIO( "malformed ascii files are rejected with std::runtime_error", "[zoo][load_ascii][exception]" ) {
+
+    GIVEN( "the malformed test inputs" ) {
+
+        THEN( "a negative size, a long row and a bad cell are each rejected" ) {
+            REQUIRE_THROWS_AS( Zoo::load_ascii("../test_inputs/MALFORMED_SIZE.gol"), std::runtime_error );
+            REQUIRE_THROWS_AS( Zoo::load_ascii("../test_inputs/MALFORMED_NEWLINE.gol"), std::runtime_error );
+            REQUIRE_THROWS_AS( Zoo::load_ascii("../test_inputs/MALFORMED_CELL.gol"), std::runtime_error );
+        }
+    }
+
+    GIVEN( "files broken in other ways" ) {
+
+        std::string const path = "../test_outputs/LOAD_ASCII_BAD.gol";
+
+        THEN( "a size that is not a number is rejected" ) {
+            write_file(path, "six 6\n");
+            REQUIRE_THROWS_AS( Zoo::load_ascii(path), std::runtime_error );
+        }
+
+        THEN( "a size too large for an unsigned int is rejected" ) {
+            write_file(path, "4294967296 1\n");
+            REQUIRE_THROWS_AS( Zoo::load_ascii(path), std::runtime_error );
+        }
+
+        THEN( "a header without its newline is rejected" ) {
+            write_file(path, "2 1 \n  \n");
+            REQUIRE_THROWS_AS( Zoo::load_ascii(path), std::runtime_error );
+
+            write_file(path, "2 1");
+            REQUIRE_THROWS_AS( Zoo::load_ascii(path), std::runtime_error );
+        }
+
+        THEN( "a row ending differently to the header is rejected" ) {
+            write_file(path, "3 2\r\n # \r\n###\n\n");
+            REQUIRE_THROWS_AS( Zoo::load_ascii(path), std::runtime_error );
+
+            write_file(path, "3 2\n # \r\n###\n");
+            REQUIRE_THROWS_AS( Zoo::load_ascii(path), std::runtime_error );
+
+            write_file(path, "3 1\r\n # \r\r");
+            REQUIRE_THROWS_AS( Zoo::load_ascii(path), std::runtime_error );
+        }
+
+        THEN( "a short row is rejected" ) {
+            write_file(path, "3 2\n # \n#\n  \n");
+            REQUIRE_THROWS_AS( Zoo::load_ascii(path), std::runtime_error );
+        }
+
+        THEN( "a file cut short is rejected" ) {
+            write_file(path, "3 2\n # \n###");
+            REQUIRE_THROWS_AS( Zoo::load_ascii(path), std::runtime_error );
+        }
+
+        THEN( "a size far larger than the file is rejected before anything is allocated" ) {
+            write_file(path, "4000000000 4000000000\n   \n");
+            REQUIRE_THROWS_AS( Zoo::load_ascii(path), std::runtime_error );
+        }
+    }
+}
@@ -0,0 +1,154 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../zoo.h"
+#include "test_helpers.h"
+
+// The bordered print of a grid built a cell at a time
+static std::string reference_print(Grid const & grid)
+{
+    std::string const border = "+" + std::string(grid.get_width(), '-') + "+\n";
+    std::string text = border;
+
+    for (unsigned int y = 0; y < grid.get_height(); y++) {
+        text += '|';
+        for (unsigned int x = 0; x < grid.get_width(); x++) {
+            text += char(grid.get(x, y));
+        }
+        text += "|\n";
+    }
+
+    return text + border;
+}
+
+// A stream buffer that keeps what is written to it and counts the writes and flushes it is sent
+class CountingBuffer : public std::streambuf {
+public:
+    std::string text;
+    unsigned int writes = 0;
+    unsigned int flushes = 0;
+
+protected:
+    std::streamsize xsputn(char const * s, std::streamsize n) override
+    {
+        text.append(s, std::size_t(n));
+        writes++;
+        return n;
+    }
+
+    int_type overflow(int_type c) override
+    {
+        if (c != traits_type::eof()) {
+            text += traits_type::to_char_type(c);
+            writes++;
+        }
+        return c;
+    }
+
+    int sync() override
+    {
+        flushes++;
+        return 0;
+    }
+};
+
+SCENARIO( "grids are printed a frame at a time", "[grid][print]" ) {
+
+    GIVEN( "grids of many sizes" ) {
+
+        unsigned int const sizes[][2] = { {0, 0}, {5, 0}, {0, 3}, {1, 1}, {3, 3}, {64, 20}, {500, 300} };
+        unsigned int mismatches = 0;
+        unsigned int extra_writes = 0;
+
+        for (auto const & size : sizes) {
+            Grid grid = random_grid(size[0], size[1], size[0] * 7 + size[1]);
+
+            CountingBuffer buffer;
+            std::ostream output(&buffer);
+            output << grid;
+
+            mismatches += (buffer.text == reference_print(grid)) ? 0 : 1;
+            extra_writes += (buffer.writes == 1 && buffer.flushes == 0) ? 0 : 1;
+        }
+
+        THEN( "each prints as before, in a single write and without flushing a row at a time" ) {
+            REQUIRE( mismatches == 0 );
+            REQUIRE( extra_writes == 0 );
+        }
+    }
+
+    GIVEN( "a grid larger than a single write can hold" ) {
+
+        Grid grid = random_grid(3000, 1000, 3);
+
+        CountingBuffer buffer;
+        std::ostream output(&buffer);
+        output << grid;
+
+        THEN( "it prints the same in a few large writes" ) {
+            REQUIRE( buffer.text == reference_print(grid) );
+            REQUIRE( buffer.writes > 1 );
+            REQUIRE( buffer.writes <= (3003 * 1002) / GRID_WRITE_BLOCK_BYTES + 1 );
+        }
+    }
+
+    GIVEN( "a printed bit grid" ) {
+
+        Grid grid = random_grid(130, 40, 4);
+        std::ostringstream packed;
+        packed << BitGrid(grid);
+
+        THEN( "it prints the same as its grid" ) {
+            REQUIRE( packed.str() == reference_print(grid) );
+        }
+    }
+}
+
+SCENARIO( "ascii files are written a block of rows at a time", "[zoo][save_ascii]" ) {
+
+    GIVEN( "grids of many sizes" ) {
+
+        unsigned int const sizes[][2] = { {0, 0}, {1, 1}, {6, 6}, {100, 40}, {3000, 1000} };
+        unsigned int mismatches = 0;
+
+        for (auto const & size : sizes) {
+            Grid grid = random_grid(size[0], size[1], size[0] + size[1]);
+            Zoo::save_ascii("../test_outputs/SAVE_ASCII_BLOCKS.gol", grid);
+
+            std::ifstream file("../test_outputs/SAVE_ASCII_BLOCKS.gol", std::ios::binary);
+            std::string const text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+            std::string expected = std::to_string(size[0]) + " " + std::to_string(size[1]) + "\n";
+            for (unsigned int y = 0; y < size[1]; y++) {
+                for (unsigned int x = 0; x < size[0]; x++) {
+                    expected += char(grid.get(x, y));
+                }
+                expected += '\n';
+            }
+
+            mismatches += (text == expected) ? 0 : 1;
+            mismatches += (BitGrid(Zoo::load_ascii("../test_outputs/SAVE_ASCII_BLOCKS.gol")) == BitGrid(grid)) ? 0 : 1;
+        }
+
+        //The largest is a few megabytes, too big to keep
+        std::remove("../test_outputs/SAVE_ASCII_BLOCKS.gol");
+
+        THEN( "each is saved in the .gol format and reads back unchanged" ) {
+            REQUIRE( mismatches == 0 );
+        }
+    }
+}
@@ -0,0 +1,201 @@
+/**
+ * @author 963653
+ * @date October, 2026
+ */
+
+// Uses Catch2 from https://github.com/catchorg/Catch2 under the BOOST license
+#include "../catch2/catch.hpp"
+
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../rule.h"
+#include "../zoo.h"
+#include "test_helpers.h"
+
+static std::string read_file(std::string const & path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+SCENARIO( "RLE files are loaded and saved", "[zoo][rle]" ) {
+
+    GIVEN( "the Gosper glider gun from a pattern collection" ) {
+
+        Rule rule = Rule::seeds();
+        Grid gun = Zoo::load_rle("../test_inputs/GOSPER_GLIDER_GUN.rle", rule);
+
+        THEN( "its comments are skipped and its size, rule and cells read" ) {
+            REQUIRE( gun.get_width() == 36 );
+            REQUIRE( gun.get_height() == 9 );
+            REQUIRE( rule == Rule::conway() );
+            REQUIRE( gun.get_alive_cells() == 36 );
+            REQUIRE( gun.get(24, 0) == Cell::ALIVE );
+            REQUIRE( gun.get(0, 4) == Cell::ALIVE );
+            REQUIRE( gun.get(35, 3) == Cell::ALIVE );
+            REQUIRE( gun.get(23, 0) == Cell::DEAD );
+        }
+    }
+
+    GIVEN( "a glider" ) {
+
+        std::string const path = "../test_outputs/SAVE_RLE_GLIDER.rle";
+        Zoo::save_rle(path, Zoo::glider());
+
+        THEN( "it saves in the usual form" ) {
+            REQUIRE( read_file(path) == "x = 3, y = 3, rule = B3/S23\nbo$2bo$3o!\n" );
+        }
+
+        THEN( "it reads back" ) {
+            REQUIRE( BitGrid(Zoo::load_rle(path)) == BitGrid(Zoo::glider()) );
+        }
+    }
+
+    GIVEN( "random grids and rules" ) {
+
+        unsigned int const sizes[][2] = { {0, 0}, {1, 1}, {7, 0}, {70, 3}, {300, 200} };
+        Rule const rules[] = { Rule::conway(), Rule::highlife(), Rule::seeds(), Rule::parse("B/S012345678") };
+        unsigned int mismatches = 0;
+        unsigned int long_lines = 0;
+
+        for (auto const & size : sizes) {
+            for (Rule const & rule : rules) {
+                Grid grid = random_grid(size[0], size[1], size[0] + size[1]);
+                std::string const path = "../test_outputs/SAVE_RLE_RANDOM.rle";
+                Zoo::save_rle(path, grid, rule);
+
+                Rule loaded_rule;
+                Grid loaded = Zoo::load_rle(path, loaded_rule);
+                mismatches += (loaded.get_width() == size[0] && loaded.get_height() == size[1]) ? 0 : 1;
+                mismatches += (BitGrid(loaded) == BitGrid(grid) && loaded_rule == rule) ? 0 : 1;
+
+                std::ifstream file(path);
+                std::string line;
+                while (std::getline(file, line)) {
+                    long_lines += (line.size() > RLE_LINE_LENGTH) ? 1 : 0;
+                }
+            }
+        }
+
+        THEN( "they round trip, with no line longer than RLE_LINE_LENGTH" ) {
+            REQUIRE( mismatches == 0 );
+            REQUIRE( long_lines == 0 );
+        }
+    }
+
+    GIVEN( "grids with empty rows and dead cells at the end of rows" ) {
+
+        Grid grid(10, 8);
+        grid.set(0, 0, Cell::ALIVE);
+        grid.set(9, 7, Cell::ALIVE);
+
+        Zoo::save_rle("../test_outputs/SAVE_RLE_SPARSE.rle", grid);
+
+        THEN( "the empty rows are a single count of $ and the dead ends of rows are left out" ) {
+            REQUIRE( read_file("../test_outputs/SAVE_RLE_SPARSE.rle") == "x = 10, y = 8, rule = B3/S23\no7$9bo!\n" );
+            REQUIRE( BitGrid(Zoo::load_rle("../test_outputs/SAVE_RLE_SPARSE.rle")) == BitGrid(grid) );
+        }
+    }
+
+    GIVEN( "files written by other programs" ) {
+
+        std::string const path = "../test_outputs/LOAD_RLE.rle";
+
+        THEN( "a header without a rule is Conway's Game of Life" ) {
+            write_file(path, "x=3,y=1\n3o!");
+            Rule rule = Rule::seeds();
+            REQUIRE( Zoo::load_rle(path, rule).get_alive_cells() == 3 );
+            REQUIRE( rule == Rule::conway() );
+        }
+
+        THEN( "the older rule notation and a topology suffix are accepted" ) {
+            write_file(path, "x = 2, y = 2, rule = 23/36:T2,2\r\n2o$\r\n2o!\r\n");
+            Rule rule;
+            REQUIRE( Zoo::load_rle(path, rule).get_alive_cells() == 4 );
+            REQUIRE( rule == Rule::highlife() );
+        }
+
+        THEN( "multistate tags and runs broken over lines are read" ) {
+            write_file(path, "x = 30, y = 1\n.A2\n0b.A!");
+            Grid grid = Zoo::load_rle(path);
+            REQUIRE( grid.get(1, 0) == Cell::ALIVE );
+            REQUIRE( grid.get(22, 0) == Cell::DEAD );
+            REQUIRE( grid.get(23, 0) == Cell::ALIVE );
+            REQUIRE( grid.get_alive_cells() == 2 );
+        }
+
+        THEN( "anything after the ! is ignored" ) {
+            write_file(path, "x = 1, y = 1\no!\nnot part of the pattern");
+            REQUIRE( Zoo::load_rle(path).get_alive_cells() == 1 );
+        }
+    }
+}
+
+SCENARIO( "malformed RLE files are rejected with std::runtime_error", "[zoo][rle][exception]" ) {
+
+    GIVEN( "broken files" ) {
+
+        std::string const path = "../test_outputs/LOAD_RLE.rle";
+
+        THEN( "a missing file is rejected" ) {
+            REQUIRE_THROWS_AS( Zoo::load_rle("../test_inputs/DOES_NOT_EXIST.rle"), std::runtime_error );
+        }
+
+        THEN( "a file of only comments is rejected" ) {
+            write_file(path, "#C nothing here\n");
+            REQUIRE_THROWS_AS( Zoo::load_rle(path), std::runtime_error );
+        }
+
+        THEN( "a header without a width or height, or with a bad one, is rejected" ) {
+            write_file(path, "x = 3\n3o!");
+            REQUIRE_THROWS_AS( Zoo::load_rle(path), std::runtime_error );
+
+            write_file(path, "x = -3, y = 1\n3o!");
+            REQUIRE_THROWS_AS( Zoo::load_rle(path), std::runtime_error );
+
+            write_file(path, "x = 99999999999, y = 1\n3o!");
+            REQUIRE_THROWS_AS( Zoo::load_rle(path), std::runtime_error );
+        }
+
+        THEN( "a size too large to allocate is rejected before anything is allocated" ) {
+            REQUIRE_THROWS_AS( Zoo::load_rle("../test_inputs/MALFORMED_SIZE.rle"), std::runtime_error );
+
+            write_file(path, "x = 65536, y = 65536\n3o!");
+            REQUIRE_THROWS_AS( Zoo::load_rle(path), std::runtime_error );
+        }
+
+        THEN( "an invalid rule is rejected" ) {
+            write_file(path, "x = 3, y = 1, rule = B9/S23\n3o!");
+            REQUIRE_THROWS_AS( Zoo::load_rle(path), std::runtime_error );
+        }
+
+        THEN( "runs past the width or height are rejected" ) {
+            write_file(path, "x = 3, y = 1\n4o!");
+            REQUIRE_THROWS_AS( Zoo::load_rle(path), std::runtime_error );
+
+            write_file(path, "x = 3, y = 1\n3b2b!");
+            REQUIRE_THROWS_AS( Zoo::load_rle(path), std::runtime_error );
+
+            write_file(path, "x = 3, y = 1\no$o!");
+            REQUIRE_THROWS_AS( Zoo::load_rle(path), std::runtime_error );
+
+            write_file(path, "x = 3, y = 1\n99999999999o!");
+            REQUIRE_THROWS_AS( Zoo::load_rle(path), std::runtime_error );
+        }
+
+        THEN( "an invalid character is rejected" ) {
+            write_file(path, "x = 3, y = 1\no*o!");
+            REQUIRE_THROWS_AS( Zoo::load_rle(path), std::runtime_error );
+        }
+
+        THEN( "a pattern without its ! is rejected" ) {
+            write_file(path, "x = 3, y = 1\n3o");
+            REQUIRE_THROWS_AS( Zoo::load_rle(path), std::runtime_error );
+        }
+    }
+}
@@ -0,0 +1,67 @@
+/**
+ * Helpers shared by the tests. They are inline so every test can include them and still link into
+ * test_all_monolithic.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include "../grid.h"
+#include "../bitgrid.h"
+#include "../world.h"
+
+// A grid with about a third of its cells alive, the same for the same seed
+inline Grid random_grid(unsigned int width, unsigned int height, unsigned int seed)
+{
+    Grid grid(width, height);
+    std::mt19937 rng(seed);
+
+    for (unsigned int y = 0; y < height; y++) {
+        for (unsigned int x = 0; x < width; x++) {
+            grid.set(x, y, (rng() % 3 == 0) ? Cell::ALIVE : Cell::DEAD);
+        }
+    }
+
+    return grid;
+}
+
+/**
+ * Step a copy of the grid with each engine and check every generation matches.
+ */
+inline bool engines_agree(Grid const & initial, StepEngine engine, bool toroidal, unsigned int generations)
+{
+    World reference(initial), candidate(initial);
+    candidate.set_engine(engine);
+
+    for (unsigned int i = 0; i < generations; i++) {
+        reference.step(toroidal);
+        candidate.step(toroidal);
+
+        if (BitGrid(reference.get_state()) != candidate.get_packed_state()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Overwrite bytes of a file in place
+inline void patch_file(std::string const & path, std::size_t offset, void const * bytes, std::size_t size)
+{
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(offset);
+    file.write(static_cast<char const *>(bytes), size);
+}
+
+// Replace a file with the given text
+inline void write_file(std::string const & path, std::string const & text)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << text;
+}
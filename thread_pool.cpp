@@ -0,0 +1,301 @@
+/**
+ * Implements a persistent pool of worker threads for running parallel loops.
+ *      - The pool is sized once, threads - 1 workers are started and the caller is the last thread.
+ *      - ThreadPool::parallel_for(count, task) runs task(0) ... task(count - 1) across the threads
+ *        and returns once every index has finished.
+ *          - Each thread starts with its own contiguous share of the indices and takes them in order,
+ *            so neighbouring indices (neighbouring tiles or bands) stay on the same core.
+ *          - A thread that runs out steals the back half of the largest remaining share of another
+ *            thread, so uneven loops (mostly idle tiles with a few busy ones) still keep every thread busy.
+ *          - If any task throws, the first exception is rethrown to the caller after the loop ends.
+ *      - Calls to parallel_for from different threads are serialized.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#include "thread_pool.h"
+
+/**
+ * ThreadPool::ThreadPool(threads)
+ *
+ * Start a pool that runs loops on the given number of threads, including the calling thread.
+ *
+ * @example
+ *
+ *      // Use every core on the machine
+ *      ThreadPool pool(std::thread::hardware_concurrency());
+ *
+ * @param threads
+ *      The total number of threads to run loops on. 0 is treated as 1.
+ */
+ThreadPool::ThreadPool(unsigned int threads)
+    : m_ranges(new Range[threads == 0 ? 1 : threads]),
+      m_task(nullptr), m_generation(0), m_busy(0), m_stop(false)
+{
+    for(unsigned int i = 0; i < (threads == 0 ? 1 : threads); i++)
+    {
+        m_ranges[i].bounds = 0;
+    }
+
+    for(unsigned int i = 1; i < threads; i++)
+    {
+        m_workers.push_back(std::thread(&ThreadPool::worker_loop, this, i));
+    }
+}
+
+
+/**
+ * ThreadPool::~ThreadPool()
+ *
+ * Wake and join every worker.
+ */
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+
+    for(std::thread & worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+
+/**
+ * ThreadPool::get_threads()
+ *
+ * Gets the number of threads loops run on, including the calling thread.
+ */
+unsigned int ThreadPool::get_threads() const
+{
+    return (unsigned int)m_workers.size() + 1;
+}
+
+
+static std::uint64_t pack_range(unsigned int begin, unsigned int end)
+{
+    return ((std::uint64_t)end << 32) | begin;
+}
+
+static unsigned int range_begin(std::uint64_t bounds)
+{
+    return (unsigned int)bounds;
+}
+
+static unsigned int range_end(std::uint64_t bounds)
+{
+    return (unsigned int)(bounds >> 32);
+}
+
+
+/**
+ * ThreadPool::take(id, index)
+ *
+ * Private helper popping the next index from the front of thread id's own range.
+ *
+ * @return
+ *      false if the range is empty.
+ */
+bool ThreadPool::take(unsigned int id, unsigned int & index)
+{
+    std::atomic<std::uint64_t> & bounds = m_ranges[id].bounds;
+    std::uint64_t current = bounds.load();
+
+    while(range_begin(current) < range_end(current))
+    {
+        if(bounds.compare_exchange_weak(current, pack_range(range_begin(current) + 1, range_end(current))))
+        {
+            index = range_begin(current);
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * ThreadPool::steal(id)
+ *
+ * Private helper moving the back half of the largest range left on another thread into thread id's
+ * own (empty) range. A lone index is stolen whole.
+ *
+ * @return
+ *      false if every other thread has run out of indices.
+ */
+bool ThreadPool::steal(unsigned int id)
+{
+    unsigned int const threads = get_threads();
+
+    while(true)
+    {
+        unsigned int victim = id;
+        unsigned int largest = 0;
+        std::uint64_t victim_bounds = 0;
+
+        for(unsigned int i = 1; i < threads; i++)
+        {
+            unsigned int const other = (id + i) % threads;
+            std::uint64_t const bounds = m_ranges[other].bounds.load();
+            unsigned int const left = range_end(bounds) - range_begin(bounds);
+
+            if(range_begin(bounds) < range_end(bounds) && left > largest)
+            {
+                victim = other;
+                largest = left;
+                victim_bounds = bounds;
+            }
+        }
+
+        if(victim == id)
+        {
+            return false;
+        }
+
+        unsigned int const begin = range_begin(victim_bounds);
+        unsigned int const end = range_end(victim_bounds);
+        unsigned int const middle = begin + (end - begin) / 2;
+
+        //If the victim took or lost indices since the scan, look again.
+        if(m_ranges[victim].bounds.compare_exchange_strong(victim_bounds, pack_range(begin, middle)))
+        {
+            m_ranges[id].bounds = pack_range(middle, end);
+            return true;
+        }
+    }
+}
+
+
+/**
+ * ThreadPool::run_indices(id)
+ *
+ * Private helper running thread id's own indices, then stolen ones, until no thread has any left.
+ * Indices in the middle of being stolen are invisible to other thieves, so a thread may stop a
+ * little early, but the thief always runs what it took.
+ */
+void ThreadPool::run_indices(unsigned int id)
+{
+    unsigned int i = 0;
+
+    while(take(id, i) || (steal(id) && take(id, i)))
+    {
+        try
+        {
+            (*m_task)(i);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(!m_error)
+            {
+                m_error = std::current_exception();
+            }
+        }
+    }
+}
+
+
+/**
+ * ThreadPool::worker_loop(id)
+ *
+ * Private body of worker thread id, sleeping until a loop starts or the pool is destroyed.
+ */
+void ThreadPool::worker_loop(unsigned int id)
+{
+    unsigned long long seen = 0;
+
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+
+            if(m_stop)
+            {
+                return;
+            }
+            seen = m_generation;
+        }
+
+        run_indices(id);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(--m_busy == 0)
+            {
+                m_done.notify_one();
+            }
+        }
+    }
+}
+
+
+/**
+ * ThreadPool::parallel_for(count, task)
+ *
+ * Run task(i) for every i in [0, count) across the pool and wait for them all to finish.
+ *
+ * @example
+ *
+ *      // Step a grid in 8 horizontal bands
+ *      pool.parallel_for(8, [&](unsigned int band) {
+ *          step_bits(curr, next, toroidal, band * height / 8, (band + 1) * height / 8);
+ *      });
+ *
+ * @param count
+ *      The number of indices to run.
+ *
+ * @param task
+ *      The function to run for each index. Must be safe to call concurrently for different indices.
+ *
+ * @throws
+ *      The first exception thrown by any task.
+ */
+void ThreadPool::parallel_for(unsigned int count, std::function<void(unsigned int)> const & task)
+{
+    std::lock_guard<std::mutex> run_lock(m_run_mutex);
+
+    if(m_workers.empty() || count <= 1)
+    {
+        for(unsigned int i = 0; i < count; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    unsigned int const threads = get_threads();
+    for(unsigned int t = 0; t < threads; t++)
+    {
+        m_ranges[t].bounds = pack_range((unsigned int)((unsigned long long)count * t / threads),
+                                        (unsigned int)((unsigned long long)count * (t + 1) / threads));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_busy = (unsigned int)m_workers.size();
+        m_error = nullptr;
+        m_generation++;
+    }
+    m_wake.notify_all();
+
+    run_indices(0);
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [&] { return m_busy == 0; });
+
+        m_task = nullptr;
+        error = m_error;
+        m_error = nullptr;
+    }
+
+    if(error)
+    {
+        std::rethrow_exception(error);
+    }
+}
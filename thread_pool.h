@@ -0,0 +1,75 @@
+/**
+ * Declares a persistent pool of worker threads for running parallel loops.
+ * Rich documentation for the api and behaviour the ThreadPool class can be found in thread_pool.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Declare the structure of the ThreadPool class.
+ *
+ * Workers are started once by the constructor and sleep between loops, so running a loop
+ * costs a wake-up rather than a thread creation. The calling thread works on the loop too.
+ *
+ * Loops are scheduled by work stealing, each thread owns a contiguous range of indices and
+ * threads that run out steal half of the remaining range of another thread.
+ */
+class ThreadPool {
+
+private:
+
+    /**
+     * The indices a thread still has to run, [begin, end) packed into one word so that the owner
+     * taking an index and a thief taking half the range are both a single compare and swap.
+     * Padded to a cache line so threads do not contend on each other's ranges.
+     */
+    struct Range {
+        std::atomic<std::uint64_t> bounds;
+        char padding[64 - sizeof(std::atomic<std::uint64_t>)];
+    };
+
+    std::vector<std::thread> m_workers;
+    std::unique_ptr<Range[]> m_ranges;      //One per thread, the calling thread is 0.
+
+    std::mutex m_run_mutex;                 //Serializes calls to parallel_for.
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+
+    std::function<void(unsigned int)> const * m_task;
+
+    unsigned long long m_generation;        //Bumped for every loop so workers know there is new work.
+    unsigned int m_busy;                    //Workers that have not finished the current loop.
+    bool m_stop;
+
+    std::exception_ptr m_error;
+
+    void worker_loop(unsigned int id);
+    void run_indices(unsigned int id);
+    bool take(unsigned int id, unsigned int & index);
+    bool steal(unsigned int id);
+
+public:
+
+    explicit ThreadPool(unsigned int threads);
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const &) = delete;
+    ThreadPool & operator=(ThreadPool const &) = delete;
+
+    unsigned int get_threads() const;
+
+    void parallel_for(unsigned int count, std::function<void(unsigned int)> const & task);
+};
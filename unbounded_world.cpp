@@ -0,0 +1,540 @@
+/**
+ * Implements a world on the infinite plane for simulating Conway's Game of Life without edges.
+ *
+ *      - Cells have 64-bit signed coordinates and the world has no edges, a spaceship keeps flying forever.
+ *
+ *      - Cells are stored in 64x64 tiles, one std::uint64_t per row with the cell at x in bit x.
+ *          - Tiles live in a hash map keyed by tile coordinates, floor(x / 64) and floor(y / 64).
+ *          - A tile is only stored while it has live cells, so memory follows the population,
+ *            two gliders flying apart cost two or four tiles however far apart they get.
+ *
+ *      - UnboundedWorld::step() computes every stored tile, and every missing tile next to a live cell
+ *        on the edge of a stored tile, as that is the only place a cell can be born.
+ *          - Each tile is gathered with the rows and words around it from its eight neighbours, then
+ *            stepped by the same packed kernels as World, see step_padded_words in step_kernels.cpp.
+ *          - Tiles are stepped in parallel if the world has more than one thread, see UnboundedWorld::set_threads(threads).
+ *          - Tiles that die out are dropped from the map.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#include "unbounded_world.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <unordered_set>
+
+#include "bitgrid.h"
+#include "step_kernels.h"
+
+/**
+ * Rounds a coordinate down to the coordinate of the tile holding it.
+ */
+static inline std::int64_t tile_of(std::int64_t v)
+{
+    return (v >= 0) ? v / UNBOUNDED_TILE_SIZE : -((-(v + 1)) / UNBOUNDED_TILE_SIZE) - 1;
+}
+
+/**
+ * The position of a coordinate within its tile, in [0, 64).
+ */
+static inline unsigned int offset_in_tile(std::int64_t v)
+{
+    return (unsigned int)(v - tile_of(v) * UNBOUNDED_TILE_SIZE);
+}
+
+
+/**
+ * UnboundedWorld::TileKeyHash::operator()(key)
+ *
+ * Mixes both tile coordinates so that neighbouring tiles land in unrelated buckets.
+ */
+std::size_t UnboundedWorld::TileKeyHash::operator()(TileKey const & key) const
+{
+    std::uint64_t h = std::uint64_t(key.x) * 0x9E3779B97F4A7C15ull;
+    h ^= std::uint64_t(key.y) * 0xC2B2AE3D27D4EB4Full;
+    return (std::size_t)(h ^ (h >> 31));
+}
+
+
+/**
+ * UnboundedWorld::UnboundedWorld()
+ *
+ * Construct an empty world.
+ *
+ * @example
+ *
+ *      // Make an empty infinite world
+ *      UnboundedWorld world;
+ */
+UnboundedWorld::UnboundedWorld()
+    : m_generation(0)
+{
+
+}
+
+
+/**
+ * UnboundedWorld::UnboundedWorld(initial_state, x0, y0)
+ *
+ * Construct a world holding the alive cells of a grid, with every other cell dead.
+ *
+ * @example
+ *
+ *      // Launch a spaceship that never reaches an edge
+ *      UnboundedWorld world(Zoo::light_weight_spaceship());
+ *      world.advance(1000000);
+ *
+ * @param initial_state
+ *      The cells to place in the world.
+ *
+ * @param x0
+ *      Optional parameter. The x coordinate of the grid's top left cell. Defaults to 0.
+ *
+ * @param y0
+ *      Optional parameter. The y coordinate of the grid's top left cell. Defaults to 0.
+ */
+UnboundedWorld::UnboundedWorld(Grid const & initial_state, std::int64_t x0, std::int64_t y0)
+    : m_generation(0)
+{
+    for(unsigned int y = 0; y < initial_state.get_height(); y++)
+    {
+        Cell const * row = initial_state.row(y);
+        for(unsigned int x = 0; x < initial_state.get_width(); x++)
+        {
+            if(row[x] == Cell::ALIVE)
+            {
+                set(x0 + x, y0 + y, Cell::ALIVE);
+            }
+        }
+    }
+}
+
+
+/**
+ * UnboundedWorld::get(x, y)
+ *
+ * Gets the state of a cell.
+ *
+ * @param x
+ *      The x coordinate of the cell.
+ *
+ * @param y
+ *      The y coordinate of the cell.
+ *
+ * @return
+ *      The state of the cell.
+ */
+Cell UnboundedWorld::get(std::int64_t x, std::int64_t y) const
+{
+    std::uint64_t const * rows = find_rows(tile_of(x), tile_of(y));
+    if(rows == nullptr)
+    {
+        return Cell::DEAD;
+    }
+    return ((rows[offset_in_tile(y)] >> offset_in_tile(x)) & 1) ? Cell::ALIVE : Cell::DEAD;
+}
+
+
+/**
+ * UnboundedWorld::set(x, y, value)
+ *
+ * Sets the state of a cell, adding or dropping its tile as needed.
+ *
+ * @param x
+ *      The x coordinate of the cell.
+ *
+ * @param y
+ *      The y coordinate of the cell.
+ *
+ * @param value
+ *      The new state of the cell.
+ */
+void UnboundedWorld::set(std::int64_t x, std::int64_t y, Cell value)
+{
+    TileKey const key = { tile_of(x), tile_of(y) };
+    std::uint64_t const bit = std::uint64_t(1) << offset_in_tile(x);
+
+    if(value == Cell::ALIVE)
+    {
+        TileMap::iterator tile = m_tiles.find(key);
+        if(tile == m_tiles.end())
+        {
+            Tile empty;
+            std::memset(empty.rows, 0, sizeof(empty.rows));
+            tile = m_tiles.insert(std::make_pair(key, empty)).first;
+        }
+        tile->second.rows[offset_in_tile(y)] |= bit;
+        return;
+    }
+
+    TileMap::iterator tile = m_tiles.find(key);
+    if(tile != m_tiles.end())
+    {
+        tile->second.rows[offset_in_tile(y)] &= ~bit;
+
+        std::uint64_t any = 0;
+        for(std::uint64_t row : tile->second.rows)
+        {
+            any |= row;
+        }
+        if(any == 0)
+        {
+            m_tiles.erase(tile);
+        }
+    }
+}
+
+
+/**
+ * UnboundedWorld::get_alive_cells()
+ *
+ * Gets the number of alive cells in the world.
+ */
+std::uint64_t UnboundedWorld::get_alive_cells() const
+{
+    std::uint64_t count = 0;
+    for(TileMap::value_type const & tile : m_tiles)
+    {
+        for(std::uint64_t row : tile.second.rows)
+        {
+            count += popcount64(row);
+        }
+    }
+    return count;
+}
+
+
+/**
+ * UnboundedWorld::get_tile_count()
+ *
+ * Gets the number of 64x64 tiles currently stored, each of which holds at least one alive cell.
+ */
+std::size_t UnboundedWorld::get_tile_count() const
+{
+    return m_tiles.size();
+}
+
+
+/**
+ * UnboundedWorld::get_generation()
+ *
+ * Gets the number of steps taken since the world was constructed.
+ */
+std::uint64_t UnboundedWorld::get_generation() const
+{
+    return m_generation;
+}
+
+
+/**
+ * UnboundedWorld::get_bounds(x0, y0, x1, y1)
+ *
+ * Gets the smallest rectangle holding every alive cell, [x0, x1) by [y0, y1).
+ *
+ * @example
+ *
+ *      // Copy the whole pattern into a grid
+ *      std::int64_t x0, y0, x1, y1;
+ *      if(world.get_bounds(x0, y0, x1, y1))
+ *      {
+ *          Grid grid = world.to_grid(x0, y0, x1 - x0, y1 - y0);
+ *      }
+ *
+ * @return
+ *      False if the world is empty, in which case the coordinates are left unchanged.
+ */
+bool UnboundedWorld::get_bounds(std::int64_t & x0, std::int64_t & y0, std::int64_t & x1, std::int64_t & y1) const
+{
+    bool found = false;
+
+    for(TileMap::value_type const & tile : m_tiles)
+    {
+        std::int64_t const left = tile.first.x * UNBOUNDED_TILE_SIZE;
+        std::int64_t const top = tile.first.y * UNBOUNDED_TILE_SIZE;
+
+        for(unsigned int y = 0; y < UNBOUNDED_TILE_SIZE; y++)
+        {
+            std::uint64_t const row = tile.second.rows[y];
+            if(row == 0)
+            {
+                continue;
+            }
+
+            unsigned int first = 0, last = UNBOUNDED_TILE_SIZE - 1;
+            while(((row >> first) & 1) == 0)
+            {
+                first++;
+            }
+            while(((row >> last) & 1) == 0)
+            {
+                last--;
+            }
+
+            if(!found)
+            {
+                x0 = left + first;
+                x1 = left + last + 1;
+                y0 = top + y;
+                y1 = top + y + 1;
+                found = true;
+            }
+            else
+            {
+                x0 = std::min(x0, left + first);
+                x1 = std::max(x1, left + last + 1);
+                y0 = std::min(y0, top + y);
+                y1 = std::max(y1, top + y + 1);
+            }
+        }
+    }
+
+    return found;
+}
+
+
+/**
+ * UnboundedWorld::to_grid(x0, y0, width, height)
+ *
+ * Copy a rectangle of the world into a grid.
+ *
+ * @example
+ *
+ *      // Watch the area around the origin
+ *      std::cout << world.to_grid(-40, -20, 80, 40) << std::endl;
+ *
+ * @param x0
+ *      The x coordinate of the top left cell of the rectangle.
+ *
+ * @param y0
+ *      The y coordinate of the top left cell of the rectangle.
+ *
+ * @param width
+ *      The width of the rectangle.
+ *
+ * @param height
+ *      The height of the rectangle.
+ *
+ * @return
+ *      A grid of width x height cells.
+ */
+Grid UnboundedWorld::to_grid(std::int64_t x0, std::int64_t y0, unsigned int width, unsigned int height) const
+{
+    Grid grid(width, height);
+
+    for(TileMap::value_type const & tile : m_tiles)
+    {
+        std::int64_t const left = tile.first.x * UNBOUNDED_TILE_SIZE;
+        std::int64_t const top = tile.first.y * UNBOUNDED_TILE_SIZE;
+
+        if(left >= x0 + width || top >= y0 + height || left + UNBOUNDED_TILE_SIZE <= x0 || top + UNBOUNDED_TILE_SIZE <= y0)
+        {
+            continue;
+        }
+
+        for(unsigned int y = 0; y < UNBOUNDED_TILE_SIZE; y++)
+        {
+            std::int64_t const gy = top + y - y0;
+            if(gy < 0 || gy >= height)
+            {
+                continue;
+            }
+
+            for(unsigned int x = 0; x < UNBOUNDED_TILE_SIZE; x++)
+            {
+                std::int64_t const gx = left + x - x0;
+                if(gx >= 0 && gx < width && ((tile.second.rows[y] >> x) & 1))
+                {
+                    grid.set((unsigned int)gx, (unsigned int)gy, Cell::ALIVE);
+                }
+            }
+        }
+    }
+
+    return grid;
+}
+
+
+/**
+ * UnboundedWorld::set_threads(threads)
+ *
+ * Choose how many threads UnboundedWorld::step() runs on, as World::set_threads(threads).
+ *
+ * @param threads
+ *      The number of threads to step with including the calling thread, or 0 for one per hardware thread.
+ */
+void UnboundedWorld::set_threads(unsigned int threads)
+{
+    if(threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    if(threads != get_threads())
+    {
+        m_pool = (threads > 1) ? std::make_shared<ThreadPool>(threads) : nullptr;
+    }
+}
+
+
+/**
+ * UnboundedWorld::get_threads()
+ *
+ * Gets the number of threads UnboundedWorld::step() runs on.
+ */
+unsigned int UnboundedWorld::get_threads() const
+{
+    return m_pool ? m_pool->get_threads() : 1;
+}
+
+
+/**
+ * UnboundedWorld::step()
+ *
+ * Take one step in Conway's Game of Life on the infinite plane.
+ */
+void UnboundedWorld::step()
+{
+    //Every stored tile, plus the missing neighbours that a live edge cell could give birth in.
+    std::unordered_set<TileKey, TileKeyHash> candidates;
+
+    for(TileMap::value_type const & tile : m_tiles)
+    {
+        TileKey const & key = tile.first;
+        std::uint64_t const * rows = tile.second.rows;
+
+        std::uint64_t west = 0, east = 0;
+        for(unsigned int y = 0; y < UNBOUNDED_TILE_SIZE; y++)
+        {
+            west |= rows[y] & 1;
+            east |= rows[y] >> (UNBOUNDED_TILE_SIZE - 1);
+        }
+
+        std::uint64_t const top = rows[0];
+        std::uint64_t const bottom = rows[UNBOUNDED_TILE_SIZE - 1];
+
+        bool const needed[3][3] = {
+            { (top & 1) != 0,    top != 0,    (top >> (UNBOUNDED_TILE_SIZE - 1)) != 0    },
+            { west != 0,         true,        east != 0                                  },
+            { (bottom & 1) != 0, bottom != 0, (bottom >> (UNBOUNDED_TILE_SIZE - 1)) != 0 }
+        };
+
+        for(int dy = -1; dy <= 1; dy++)
+        {
+            for(int dx = -1; dx <= 1; dx++)
+            {
+                if(needed[dy + 1][dx + 1])
+                {
+                    TileKey const neighbour = { key.x + dx, key.y + dy };
+                    candidates.insert(neighbour);
+                }
+            }
+        }
+    }
+
+    std::vector<TileKey> const keys(candidates.begin(), candidates.end());
+    std::vector<Tile> next(keys.size());
+
+    auto const step_tile = [&](unsigned int i)
+    {
+        std::uint64_t padded[(UNBOUNDED_TILE_SIZE + 2) * 3];
+        gather(keys[i], padded);
+        step_padded_words(padded, 1, UNBOUNDED_TILE_SIZE, next[i].rows, 1);
+    };
+
+    if(m_pool)
+    {
+        m_pool->parallel_for((unsigned int)keys.size(), step_tile);
+    }
+    else
+    {
+        for(unsigned int i = 0; i < keys.size(); i++)
+        {
+            step_tile(i);
+        }
+    }
+
+    //Only keep tiles that still have live cells.
+    TileMap tiles;
+    tiles.reserve(keys.size());
+
+    for(std::size_t i = 0; i < keys.size(); i++)
+    {
+        std::uint64_t any = 0;
+        for(std::uint64_t row : next[i].rows)
+        {
+            any |= row;
+        }
+
+        if(any != 0)
+        {
+            tiles.insert(std::make_pair(keys[i], next[i]));
+        }
+    }
+
+    m_tiles.swap(tiles);
+    m_generation++;
+}
+
+
+/**
+ * UnboundedWorld::advance(steps)
+ *
+ * Advance multiple steps in the Game of Life.
+ *
+ * @param steps
+ *      The number of steps to advance the world forward.
+ */
+void UnboundedWorld::advance(unsigned int steps)
+{
+    for(unsigned int i = 0; i < steps; i++)
+    {
+        step();
+    }
+}
+
+
+/**
+ * UnboundedWorld::find_rows(tx, ty)
+ *
+ * Private helper returning the rows of a tile, or nullptr if the tile is not stored.
+ */
+std::uint64_t const * UnboundedWorld::find_rows(std::int64_t tx, std::int64_t ty) const
+{
+    TileKey const key = { tx, ty };
+    TileMap::const_iterator const tile = m_tiles.find(key);
+    return (tile == m_tiles.end()) ? nullptr : tile->second.rows;
+}
+
+
+/**
+ * UnboundedWorld::gather(key, padded)
+ *
+ * Private helper copying a tile and the cells around it into 66 rows of 3 words, for step_padded_words.
+ * Missing tiles are dead.
+ */
+void UnboundedWorld::gather(TileKey const & key, std::uint64_t * padded) const
+{
+    std::uint64_t const * around[3][3];
+    for(int dy = -1; dy <= 1; dy++)
+    {
+        for(int dx = -1; dx <= 1; dx++)
+        {
+            around[dy + 1][dx + 1] = find_rows(key.x + dx, key.y + dy);
+        }
+    }
+
+    for(unsigned int r = 0; r < UNBOUNDED_TILE_SIZE + 2; r++)
+    {
+        //Padded row 0 is the last row of the tiles above, and the last padded row is the first row of the tiles below.
+        unsigned int const band = (r == 0) ? 0 : (r <= UNBOUNDED_TILE_SIZE ? 1 : 2);
+        unsigned int const y = (r == 0) ? UNBOUNDED_TILE_SIZE - 1 : (r <= UNBOUNDED_TILE_SIZE ? r - 1 : 0);
+
+        for(unsigned int column = 0; column < 3; column++)
+        {
+            std::uint64_t const * rows = around[band][column];
+            padded[r * 3 + column] = rows ? rows[y] : 0;
+        }
+    }
+}
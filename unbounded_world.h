@@ -0,0 +1,81 @@
+/**
+ * Declares a world on the infinite plane that grows to follow its live cells.
+ * Rich documentation for the api and behaviour the UnboundedWorld class can be found in unbounded_world.cpp.
+ *
+ * @author 963653
+ * @date October, 2026
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "grid.h"
+#include "thread_pool.h"
+
+/**
+ * The edge size in cells of the tiles an UnboundedWorld is stored in, one word per row.
+ */
+#define UNBOUNDED_TILE_SIZE 64
+
+/**
+ * Declare the structure of the UnboundedWorld class.
+ *
+ * Cells are stored in 64x64 tiles packed one bit per cell, in a hash map keyed by tile coordinates.
+ * Only tiles with live cells are stored, so memory follows the population rather than the area it covers.
+ */
+class UnboundedWorld {
+
+private:
+
+    struct TileKey {
+        std::int64_t x, y;
+
+        bool operator==(TileKey const & other) const { return x == other.x && y == other.y; }
+    };
+
+    struct TileKeyHash {
+        std::size_t operator()(TileKey const & key) const;
+    };
+
+    /**
+     * Row y of a tile is rows[y], with the cell at x in bit x.
+     */
+    struct Tile {
+        std::uint64_t rows[UNBOUNDED_TILE_SIZE];
+    };
+
+    typedef std::unordered_map<TileKey, Tile, TileKeyHash> TileMap;
+
+    TileMap m_tiles;
+    std::uint64_t m_generation;
+
+    std::shared_ptr<ThreadPool> m_pool;     //Null when stepping on the calling thread only.
+
+    std::uint64_t const * find_rows(std::int64_t tx, std::int64_t ty) const;
+    void gather(TileKey const & key, std::uint64_t * padded) const;
+
+public:
+
+    UnboundedWorld();
+    explicit UnboundedWorld(Grid const & initial_state, std::int64_t x0 = 0, std::int64_t y0 = 0);
+
+    Cell get(std::int64_t x, std::int64_t y) const;
+    void set(std::int64_t x, std::int64_t y, Cell value);
+
+    std::uint64_t get_alive_cells() const;
+    std::size_t get_tile_count() const;
+    std::uint64_t get_generation() const;
+    bool get_bounds(std::int64_t & x0, std::int64_t & y0, std::int64_t & x1, std::int64_t & y1) const;
+
+    Grid to_grid(std::int64_t x0, std::int64_t y0, unsigned int width, unsigned int height) const;
+
+    void set_threads(unsigned int threads);
+    unsigned int get_threads() const;
+
+    void step();
+    void advance(unsigned int steps);
+};
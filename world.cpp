@@ -10,6 +10,7 @@
  *
  *      - Stepping a world forward in time applies the rules of Conway's Game of Life.
  *          - https://en.wikipedia.org/wiki/Conway%27s_Game_of_Life
+ *          - Any other life-like rule can be chosen instead, such as HighLife (B36/S23), see World::set_rule(rule).
  *
  *      - Worlds have a private helper function used to count the number of alive cells in a 3x3 neighbours
  *        around a given cell.
@@ -18,6 +19,45 @@
  *          - Moving off the left edge you appear on the right edge and vice versa.
  *          - Moving off the top edge you appear on the bottom edge and vice versa.
  *
+ *      - Worlds can step with different engines, see StepEngine and World::set_engine(engine).
+ *          - StepEngine::Reference steps the Grid buffers one cell at a time with World::count_neighbours.
+ *          - StepEngine::Halo also steps one cell at a time, but first copies the grid into a buffer with a
+ *            one cell halo, zero in bounded mode and wrapped in toroidal mode. The loop over cells then has
+ *            no edge checks and no branches, see load_halo_rows in step_kernels.cpp.
+ *          - StepEngine::Table packs the grid into bit rows and steps it 2x2 cells at a time, each 4x4 block of the
+ *            current state indexing a 65536 entry table of results, built once per rule, see block_table in step_kernels.cpp.
+ *          - StepEngine::Columns keeps each column's sum over the rows above, through and below the current row
+ *            and slides it down the grid, so each cell costs three byte adds, see step_column_sums in step_kernels.cpp.
+ *          - StepEngine::Bytewise steps the Grid buffers with vectorized byte adds, see step_kernels.cpp.
+ *          - StepEngine::Bitwise steps two packed BitGrid buffers 64 cells per word, see step_kernels.cpp.
+ *          - StepEngine::Tiled steps the packed buffers in 1024x64 cell tiles, clearing tiles with no live
+ *            cells nearby without computing them.
+ *          - The tiled engine remembers which tiles changed each step, and the next step recomputes only those
+ *            tiles and their neighbours, so still and empty regions cost nothing, see World::get_active_tiles().
+ *          - StepEngine::Temporal steps the packed buffers in bands of rows sized to fit in cache. World::advance takes
+ *            each band STEP_TEMPORAL_GENERATIONS generations forward at a time from the rows around it, so a world
+ *            much larger than the cache is read and written once per pass rather than once per generation,
+ *            see step_bits_generations in step_kernels.cpp.
+ *          - The vectorized kernels pick AVX-512, AVX2 or scalar code at runtime, see cpu_features.cpp.
+ *
+ *      - Worlds count the generations they have stepped, and can watch for the state repeating, see World::set_cycle_window(window).
+ *          - Each generation's state is hashed tile by tile, the world's hash being the XOR of its tiles' hashes.
+ *            After a tiled step only the tiles that changed are rehashed, other engines rehash every tile.
+ *          - The hashes of the last few generations are kept in a ring. A generation whose hash is in the ring
+ *            repeats the state P generations ago, so the world has settled into a cycle of period P.
+ *          - Once stable, World::advance(steps, toroidal) can skip whole periods, see World::set_fast_forward(fast_forward).
+ *
+ *      - Steps can run on several threads, see World::set_threads(threads).
+ *          - The grid is split into horizontal bands of rows which are stepped in parallel by a persistent ThreadPool.
+ *          - Every engine reads only the current state and writes only its own rows of the next state,
+ *            so bands need no synchronization beyond waiting for the step to finish, in either topology.
+ *          - The tiled engine runs one task per tile instead. Each thread starts on a contiguous run of tiles
+ *            and steals from the others when it runs out, so a world whose live cells are bunched in one
+ *            region still keeps every thread busy.
+ *          - Only one representation holds the state at a time, the world converts between them when
+ *            the engine changes or when the other representation is asked for, and releases the buffers
+ *            it is no longer using. A packed world therefore needs one bit per cell per buffer.
+ *
  * @author 963653
  * @date April, 2020
  */
@@ -25,6 +65,85 @@
 
 // Include the minimal number of headers needed to support your implementation.
 // #include ...
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+
+#include "step_kernels.h"
+
+/**
+ * parse_step_engine(name)
+ *
+ * Look up a step engine by the name used on the command line.
+ *
+ * @param name
+ *      One of "reference", "halo", "table", "columns", "bytewise", "bitwise", "tiled" or "temporal".
+ *
+ * @return
+ *      The named engine.
+ *
+ * @throws
+ *      std::invalid_argument if the name is not a known engine.
+ */
+StepEngine parse_step_engine(std::string const & name)
+{
+    if(name == "reference")
+    {
+        return StepEngine::Reference;
+    }
+    else if(name == "halo")
+    {
+        return StepEngine::Halo;
+    }
+    else if(name == "table")
+    {
+        return StepEngine::Table;
+    }
+    else if(name == "columns")
+    {
+        return StepEngine::Columns;
+    }
+    else if(name == "bytewise")
+    {
+        return StepEngine::Bytewise;
+    }
+    else if(name == "bitwise")
+    {
+        return StepEngine::Bitwise;
+    }
+    else if(name == "tiled")
+    {
+        return StepEngine::Tiled;
+    }
+    else if(name == "temporal")
+    {
+        return StepEngine::Temporal;
+    }
+    else
+    {
+        throw std::invalid_argument("Unknown step engine: " + name);
+    }
+}
+
+/**
+ * to_string(engine)
+ *
+ * The command line name of a step engine, the inverse of parse_step_engine(name).
+ */
+std::string to_string(StepEngine engine)
+{
+    switch(engine)
+    {
+        case StepEngine::Halo:      return "halo";
+        case StepEngine::Table:     return "table";
+        case StepEngine::Columns:   return "columns";
+        case StepEngine::Bytewise:  return "bytewise";
+        case StepEngine::Bitwise:   return "bitwise";
+        case StepEngine::Tiled:     return "tiled";
+        case StepEngine::Temporal:  return "temporal";
+        default:                    return "reference";
+    }
+}
 
 /**
  * World::World()
@@ -86,7 +205,10 @@ World::World(unsigned int const & square_size)
  *      The height of the world.
  */
 World::World(unsigned int const & width, unsigned int const & height)
-        :m_curr_buff(Grid(width, height)) , m_next_buff(Grid(width, height)) 
+        :m_curr_buff(Grid(width, height)) , m_next_buff(Grid(width, height)),
+         m_engine(StepEngine::Reference), m_packed(false),
+         m_tiles_toroidal(false), m_active_tiles(0), m_generation(0),
+         m_cycle_window(0), m_fast_forward(false), m_hash(0), m_hashed_since(0), m_stable_generation(0), m_period(0)
 {
 
 }
@@ -111,7 +233,61 @@ World::World(unsigned int const & width, unsigned int const & height)
  *      The state of the constructed world.
  */
 World::World(Grid const & initial_state)
-    : m_curr_buff(initial_state), m_next_buff(initial_state)
+    : m_curr_buff(initial_state), m_next_buff(initial_state),
+      m_engine(StepEngine::Reference), m_packed(false),
+      m_tiles_toroidal(false), m_active_tiles(0), m_generation(0),
+      m_cycle_window(0), m_fast_forward(false), m_hash(0), m_hashed_since(0), m_stable_generation(0), m_period(0)
+{
+
+}
+
+
+/**
+ * World::World(initial_state)
+ *
+ * Construct a world using the size and values of an existing packed grid.
+ * The world keeps its state packed and steps with StepEngine::Bitwise.
+ *
+ * @example
+ *
+ *      // Make a 32768x32768 world without ever allocating a byte per cell
+ *      World world(BitGrid(32768, 32768));
+ *
+ * @param initial_state
+ *      The state of the constructed world.
+ */
+World::World(BitGrid const & initial_state)
+    : m_curr_bits(initial_state), m_next_bits(initial_state.get_width(), initial_state.get_height()),
+      m_engine(StepEngine::Bitwise), m_packed(true),
+      m_tiles_toroidal(false), m_active_tiles(0), m_generation(0),
+      m_cycle_window(0), m_fast_forward(false), m_hash(0), m_hashed_since(0), m_stable_generation(0), m_period(0)
+{
+
+}
+
+
+/**
+ * World::World(initial_state)
+ *
+ * Construct a world taking over an existing packed grid rather than copying it.
+ * The buffer the next state is stepped into is only allocated by the first step, so construction costs nothing.
+ * A grid borrowing its words, such as one mapped from a file, is only ever read: the first step copies it into
+ * a buffer of the world's own, clearing any bits set past the width, and lets go of it, so the world steps
+ * between two buffers it owns and the mapping is never written.
+ *
+ * @example
+ *
+ *      // Step a saved world without reading it into memory first
+ *      World world(Zoo::map_binary("path/to/file.bgol", rule, generation));
+ *
+ * @param initial_state
+ *      The state of the constructed world.
+ */
+World::World(BitGrid && initial_state)
+    : m_curr_bits(std::move(initial_state)), m_next_bits(),
+      m_engine(StepEngine::Bitwise), m_packed(true),
+      m_tiles_toroidal(false), m_active_tiles(0), m_generation(0),
+      m_cycle_window(0), m_fast_forward(false), m_hash(0), m_hashed_since(0), m_stable_generation(0), m_period(0)
 {
 
 }
@@ -140,7 +316,7 @@ World::World(Grid const & initial_state)
  * @return
  *      The width of the world.
  */
-unsigned int const & World::get_width() const { return m_curr_buff.get_width(); }
+unsigned int const & World::get_width() const { return m_packed ? m_curr_bits.get_width() : m_curr_buff.get_width(); }
 
 
 /**
@@ -166,7 +342,7 @@ unsigned int const & World::get_width() const { return m_curr_buff.get_width();
  * @return
  *      The height of the world.
  */
-unsigned int const & World::get_height() const { return m_curr_buff.get_height(); }
+unsigned int const & World::get_height() const { return m_packed ? m_curr_bits.get_height() : m_curr_buff.get_height(); }
 
 
 /**
@@ -192,7 +368,7 @@ unsigned int const & World::get_height() const { return m_curr_buff.get_height()
  * @return
  *      The number of total cells.
  */
-unsigned int const World::get_total_cells() const {  return m_curr_buff.get_total_cells(); }
+unsigned int const World::get_total_cells() const {  return get_width() * get_height(); }
 
 
 /**
@@ -218,7 +394,7 @@ unsigned int const World::get_total_cells() const {  return m_curr_buff.get_tota
  * @return
  *      The number of alive cells.
  */
-unsigned int const World::get_alive_cells() const { return m_curr_buff.get_alive_cells(); }
+unsigned int const World::get_alive_cells() const { return m_packed ? m_curr_bits.get_alive_cells() : m_curr_buff.get_alive_cells(); }
 
 /**
  * World::get_dead_cells()
@@ -243,7 +419,7 @@ unsigned int const World::get_alive_cells() const { return m_curr_buff.get_alive
  * @return
  *      The number of dead cells.
  */
-unsigned int const World::get_dead_cells() const { return m_curr_buff.get_dead_cells(); }
+unsigned int const World::get_dead_cells() const { return get_total_cells() - get_alive_cells(); }
 
 /**
  * World::get_state()
@@ -266,10 +442,470 @@ unsigned int const World::get_dead_cells() const { return m_curr_buff.get_dead_c
  *      // Print the current state of the world to the console without copy
  *      std::cout << read_only_world.get_state() << std::endl;
  *
+ * If the world is stepping with a packed engine the state is unpacked into a Grid first,
+ * and the returned reference is only valid until the next step.
+ * Cells changed through the reference are not seen by cycle detection, call World::set_cycle_window(window)
+ * again after editing the state to forget the generations before the edit.
+ *
  * @return
  *      A reference to the current state.
  */
-Grid & World::get_state() { return m_curr_buff; }
+Grid & World::get_state()
+{
+    unpack();
+    return m_curr_buff;
+}
+
+
+/**
+ * World::get_packed_state()
+ *
+ * Return a read-only reference to the current state packed one bit per cell.
+ * The state is packed first if the world is stepping with the reference engine,
+ * and the returned reference is only valid until the next step.
+ *
+ * @return
+ *      A reference to the current packed state.
+ */
+BitGrid const & World::get_packed_state()
+{
+    pack();
+    return m_curr_bits;
+}
+
+
+/**
+ * World::set_engine(engine)
+ *
+ * Choose the kernel used by World::step(toroidal). Every engine produces the same generations,
+ * the state is converted to the engine's representation on the next step.
+ *
+ * @example
+ *
+ *      // Step 64 cells at a time
+ *      World world(Zoo::r_pentomino());
+ *      world.set_engine(StepEngine::Bitwise);
+ *      world.advance(100);
+ *
+ * @param engine
+ *      The engine to step with.
+ */
+void World::set_engine(StepEngine engine) { m_engine = engine; }
+
+
+/**
+ * World::get_engine()
+ *
+ * Gets the engine used by World::step(toroidal).
+ */
+StepEngine World::get_engine() const { return m_engine; }
+
+
+/**
+ * World::set_rule(rule)
+ *
+ * Choose the life-like rule World::step(toroidal) applies. Every engine supports every rule.
+ *
+ * @example
+ *
+ *      // Watch a HighLife replicator copy itself
+ *      World world(256, 256);
+ *      world.set_rule(Rule::parse("B36/S23"));
+ *      world.advance(100);
+ *
+ * @param rule
+ *      The rule to step with. Worlds start with Conway's Game of Life, B3/S23.
+ */
+void World::set_rule(Rule const & rule)
+{
+    if(rule != m_rule)
+    {
+        m_rule = rule;
+
+        //Tiles that settled under the old rule may not be settled under the new one.
+        m_tile_changed.clear();
+        forget_cycle();
+    }
+}
+
+
+/**
+ * World::get_rule()
+ *
+ * Gets the rule used by World::step(toroidal).
+ */
+Rule const & World::get_rule() const { return m_rule; }
+
+
+/**
+ * World::set_threads(threads)
+ *
+ * Choose how many threads World::step(toroidal) runs on. The worker threads are started here
+ * and reused by every step. Copies of a world share its threads.
+ *
+ * @example
+ *
+ *      // Step on every core of the machine
+ *      World world(grid);
+ *      world.set_threads(0);
+ *
+ * @param threads
+ *      The number of threads to step with including the calling thread, or 0 for one per hardware thread.
+ */
+void World::set_threads(unsigned int threads)
+{
+    if(threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    if(threads == get_threads())
+    {
+        return;
+    }
+
+    m_pool = (threads > 1) ? std::make_shared<ThreadPool>(threads) : nullptr;
+}
+
+
+/**
+ * World::get_threads()
+ *
+ * Gets the number of threads World::step(toroidal) runs on.
+ */
+unsigned int World::get_threads() const
+{
+    return m_pool ? m_pool->get_threads() : 1;
+}
+
+
+/**
+ * World::get_tiles()
+ *
+ * Gets the number of 1024x64 cell tiles StepEngine::Tiled splits the world into.
+ */
+unsigned int World::get_tiles() const
+{
+    unsigned int const words = (get_width() + BITGRID_WORD_BITS - 1) / BITGRID_WORD_BITS;
+    return ((words + STEP_TILE_WORDS - 1) / STEP_TILE_WORDS) * ((get_height() + STEP_TILE_ROWS - 1) / STEP_TILE_ROWS);
+}
+
+
+/**
+ * World::get_active_tiles()
+ *
+ * Gets the number of tiles the last World::step(toroidal) recomputed. Only StepEngine::Tiled skips tiles,
+ * the other engines recompute all World::get_tiles() of them. A tiled world that has settled into still
+ * lifes reports 0.
+ *
+ * @example
+ *
+ *      // See how much of a world is still active
+ *      World world(Zoo::load_ascii("soup.gol"));
+ *      world.set_engine(StepEngine::Tiled);
+ *      world.step();
+ *      std::cout << world.get_active_tiles() << " of " << world.get_tiles() << std::endl;
+ *
+ * @return
+ *      The number of tiles recomputed, 0 before the first step.
+ */
+unsigned int World::get_active_tiles() const
+{
+    return m_active_tiles;
+}
+
+
+/**
+ * World::get_generation()
+ *
+ * Gets the number of generations the world has been stepped or advanced since it was made,
+ * including generations skipped by fast forwarding.
+ */
+std::uint64_t World::get_generation() const { return m_generation; }
+
+
+/**
+ * World::set_cycle_window(window)
+ *
+ * Watch for the world settling into a still life or oscillator. From the next step each generation's state is
+ * hashed and compared with the hashes of the last window generations. When it matches the generation P steps earlier,
+ * the world has been cycling with period P since then and World::is_stable() becomes true.
+ * States are compared by 64 bit hashes, so a different state with the same hash would be taken for a repeat,
+ * which for any one pair of states happens with a chance of 1 in 2^64.
+ *
+ * @example
+ *
+ *      // Find when a random soup settles down
+ *      World world(soup);
+ *      world.set_cycle_window(64);
+ *      world.advance(10000);
+ *      if(world.is_stable())
+ *      {
+ *          std::cout << "Stabilized at generation " << world.get_stable_generation()
+ *                    << " with period " << world.get_period() << std::endl;
+ *      }
+ *
+ * @param window
+ *      The longest period to detect, 0 to stop detecting cycles. Setting the window forgets any cycle already found.
+ */
+void World::set_cycle_window(unsigned int window)
+{
+    m_cycle_window = window;
+    forget_cycle();
+}
+
+
+/**
+ * World::get_cycle_window()
+ *
+ * Gets the longest period World::step(toroidal) watches for, 0 when not detecting cycles.
+ */
+unsigned int World::get_cycle_window() const { return m_cycle_window; }
+
+
+/**
+ * World::set_fast_forward(fast_forward)
+ *
+ * Choose whether World::advance(steps, toroidal) skips whole periods once the world is stable. As the state
+ * repeats every World::get_period() generations, only the remainder of the steps modulo the period are stepped,
+ * and the generation count still moves on by every step.
+ *
+ * @param fast_forward
+ *      True to skip, false to step every generation. Worlds start stepping every generation.
+ */
+void World::set_fast_forward(bool fast_forward) { m_fast_forward = fast_forward; }
+
+
+/**
+ * World::is_stable()
+ *
+ * Gets whether cycle detection has seen the state repeat, see World::set_cycle_window(window).
+ */
+bool World::is_stable() const { return m_period != 0; }
+
+
+/**
+ * World::get_stable_generation()
+ *
+ * Gets the first generation of the cycle the world settled into, every later generation repeats a generation
+ * from this one on. 0 if the world is not known to be stable.
+ */
+std::uint64_t World::get_stable_generation() const { return m_stable_generation; }
+
+
+/**
+ * World::get_period()
+ *
+ * Gets the period of the cycle the world settled into, 1 for still lifes. 0 if the world is not known to be stable.
+ */
+unsigned int World::get_period() const { return m_period; }
+
+
+/**
+ * World::hash_tiles(changed_only)
+ *
+ * Private helper bringing m_tile_hashes and m_hash up to date with the current state. If changed_only is true
+ * only the tiles the last tiled step flagged as changed are rehashed, otherwise every tile is.
+ */
+void World::hash_tiles(bool changed_only)
+{
+    unsigned int const words = (get_width() + BITGRID_WORD_BITS - 1) / BITGRID_WORD_BITS;
+    unsigned int const tiles_x = (words + STEP_TILE_WORDS - 1) / STEP_TILE_WORDS;
+    unsigned int const tiles = get_tiles();
+
+    std::vector<unsigned int> stale;
+
+    if(changed_only)
+    {
+        for(unsigned int tile = 0; tile < tiles; tile++)
+        {
+            if(m_tile_changed[tile])
+            {
+                stale.push_back(tile);
+            }
+        }
+    }
+    else
+    {
+        m_tile_hashes.assign(tiles, 0);
+        m_hash = 0;
+
+        stale.resize(tiles);
+        for(unsigned int tile = 0; tile < tiles; tile++)
+        {
+            stale[tile] = tile;
+        }
+    }
+
+    std::vector<std::uint64_t> hashes(stale.size());
+
+    auto const hash_tile = [&](unsigned int i)
+    {
+        unsigned int const tx = stale[i] % tiles_x, ty = stale[i] / tiles_x;
+        hashes[i] = m_packed ? hash_bits_tile(m_curr_bits, tx, ty) : hash_cells_tile(m_curr_buff, tx, ty);
+    };
+
+    if(m_pool)
+    {
+        m_pool->parallel_for((unsigned int)stale.size(), hash_tile);
+    }
+    else
+    {
+        for(unsigned int i = 0; i < stale.size(); i++)
+        {
+            hash_tile(i);
+        }
+    }
+
+    //XOR the old hash of each tile out of the world's hash and the new one in.
+    for(unsigned int i = 0; i < stale.size(); i++)
+    {
+        m_hash ^= m_tile_hashes[stale[i]] ^ hashes[i];
+        m_tile_hashes[stale[i]] = hashes[i];
+    }
+}
+
+
+/**
+ * World::track_cycle()
+ *
+ * Private helper run after every step while detecting cycles. Hashes the new generation and looks for its hash
+ * among the last m_cycle_window generations, the nearest match giving the period. World::step(toroidal) also
+ * calls it before the first step, which starts the ring with the generation detection starts from.
+ */
+void World::track_cycle()
+{
+    if(m_cycle_window == 0 || m_period != 0)
+    {
+        return;
+    }
+
+    bool const started = !m_recent_hashes.empty();
+
+    //A tiled step leaves a flag per tile, and a tile that did not change keeps its hash.
+    hash_tiles(started && m_tile_changed.size() == m_tile_hashes.size());
+
+    if(!started)
+    {
+        m_recent_hashes.assign(m_cycle_window, 0);
+        m_hashed_since = m_generation;
+    }
+    else
+    {
+        std::uint64_t const known = std::min<std::uint64_t>(m_cycle_window, m_generation - m_hashed_since);
+
+        for(unsigned int period = 1; period <= known; period++)
+        {
+            if(m_recent_hashes[(m_generation - period) % m_cycle_window] == m_hash)
+            {
+                m_stable_generation = m_generation - period;
+                m_period = period;
+                break;
+            }
+        }
+    }
+
+    m_recent_hashes[m_generation % m_cycle_window] = m_hash;
+}
+
+
+/**
+ * World::forget_cycle()
+ *
+ * Private helper dropping the hashes and any cycle found, for when the state or rule changes other than by stepping.
+ * Detection restarts from the current generation on the next step.
+ */
+void World::forget_cycle()
+{
+    m_tile_hashes.clear();
+    m_recent_hashes.clear();
+    m_hash = 0;
+    m_hashed_since = m_generation;
+    m_stable_generation = 0;
+    m_period = 0;
+}
+
+
+/**
+ * World::for_each_band(height, step_rows)
+ *
+ * Private helper calling step_rows(y0, y1) for horizontal bands covering rows [0, height),
+ * in parallel if the world has more than one thread.
+ *
+ * There are a few bands per thread so a thread that finishes early can take another band.
+ */
+void World::for_each_band(unsigned int height, std::function<void(unsigned int, unsigned int)> const & step_rows)
+{
+    unsigned int const min_band_rows = 16;
+    unsigned int const bands = std::min(get_threads() * 4, std::max(1u, height / min_band_rows));
+
+    if(!m_pool || bands <= 1)
+    {
+        step_rows(0, height);
+        return;
+    }
+
+    m_pool->parallel_for(bands, [&](unsigned int band)
+    {
+        step_rows((unsigned int)(std::uint64_t(height) * band / bands),
+                  (unsigned int)(std::uint64_t(height) * (band + 1) / bands));
+    });
+}
+
+
+/**
+ * World::unpack()
+ *
+ * Private helper making m_curr_buff hold the current state, releasing the packed buffers.
+ */
+void World::unpack()
+{
+    if(m_packed)
+    {
+        m_curr_buff = m_curr_bits.to_grid();
+        m_curr_bits = BitGrid();
+        m_next_bits = BitGrid();
+        m_tile_changed.clear();
+        m_packed = false;
+    }
+}
+
+
+/**
+ * World::own_packed()
+ *
+ * Private helper copying a packed state that borrows its words, such as one mapped from a file, into words of
+ * the world's own before it is stepped. The copy clears any bits past the width, which the kernels read as cells,
+ * and the borrowed words are never written.
+ */
+void World::own_packed()
+{
+    if(m_packed && m_curr_bits.is_external())
+    {
+        m_curr_bits = BitGrid(m_curr_bits);
+        m_tile_changed.clear();
+    }
+}
+
+
+/**
+ * World::pack()
+ *
+ * Private helper making m_curr_bits hold the current state, releasing the Grid buffers.
+ */
+void World::pack()
+{
+    if(!m_packed)
+    {
+        m_curr_bits = BitGrid(m_curr_buff);
+        m_curr_buff = Grid();
+        m_next_buff = Grid();
+        m_halo = std::vector<std::uint8_t>();
+        m_blocks = std::vector<std::uint8_t>();
+        m_tile_changed.clear();
+        m_packed = true;
+    }
+}
 
 /**
  * World::resize(square_size)
@@ -321,9 +957,19 @@ void World::resize(unsigned int square_size)
  */
 void World::resize(unsigned int const & new_width, unsigned int const & new_height)
 {
+    if(m_packed)
+    {
+        m_curr_bits.resize(new_width, new_height);
+        m_next_bits = BitGrid(new_width, new_height);
+        m_tile_changed.clear();
+    }
+    else
+    {
+        m_curr_buff.resize(new_width, new_height);
+        m_next_buff = Grid(new_width, new_height);
+    }
 
-    m_curr_buff.resize(new_width, new_height);
-    m_next_buff = Grid(new_width, new_height);
+    forget_cycle();
 }
 
 
@@ -427,7 +1073,7 @@ unsigned int World::count_neighbours(unsigned int x, unsigned int y, bool toroid
 /**
  * World::step(toroidal)
  *
- * Take one step in Conway's Game of Life.
+ * Take one step in Conway's Game of Life, or the life-like rule chosen with World::set_rule(rule).
  *
  * Reads from the current state grid and writes to the next state grid. Then swaps the grids.
  * Should be implemented by invoking World::count_neighbours(x, y, toroidal).
@@ -440,50 +1086,379 @@ unsigned int World::count_neighbours(unsigned int x, unsigned int y, bool toroid
  *      - Any live cell with more than three live neighbours dies, as if by overpopulation.
  *      - Any dead cell with exactly three live neighbours becomes a live cell, as if by reproduction.
  *
+ * The step is performed by the engine chosen with World::set_engine(engine), on the number of threads
+ * chosen with World::set_threads(threads). Toroidal worlds less than
+ * 2 cells wide or high always use the reference engine, as there the wrapped neighbourhood overlaps
+ * the cell itself and World::count_neighbours skips every copy of the centre.
+ *
  * @param toroidal
  *      Optional parameter. If true then the step will consider the grid as a torus, where the left edge
  *      wraps to the right edge and the top to the bottom. Defaults to false.
  */
 void World::step(bool toroidal)
 {
-    for(unsigned int i = 0; i < m_curr_buff.get_height(); i++)
-    {   
-        for(unsigned int j = 0; j < m_curr_buff.get_width(); j++)
-        {
+    bool const degenerate = toroidal && (get_width() < 2 || get_height() < 2);
 
-            unsigned int num_neighbours = this->count_neighbours(j, i, toroidal);
-            
-            // - Any live cell with fewer than two live neighbours dies, as if by underpopulation.
-            if((m_curr_buff.get(j, i) == Cell::ALIVE) && (num_neighbours < 2))
-            {
-                m_next_buff.set(j,i, Cell::DEAD);
-            }
+    own_packed();
 
-            // - Any live cell with two or three live neighbours lives on to the next generation.
-            else if((m_curr_buff.get(j, i) == Cell::ALIVE)
-                    && (num_neighbours == 2 || num_neighbours == 3))
-            {
-                m_next_buff.set(j, i, Cell::ALIVE);
-            }
-            // - Any live cell with more than three live neighbours dies, as if by overpopulation.
-            else if((m_curr_buff.get(j, i) == Cell::ALIVE) && (num_neighbours > 3))
+    if(m_recent_hashes.empty())
+    {
+        track_cycle();
+    }
+
+    m_active_tiles = get_tiles();
+
+    switch(degenerate ? StepEngine::Reference : m_engine)
+    {
+        case StepEngine::Halo:      step_halo(toroidal);        break;
+        case StepEngine::Table:     step_table(toroidal);       break;
+        case StepEngine::Columns:   step_columns(toroidal);     break;
+        case StepEngine::Bytewise:  step_bytewise(toroidal);    break;
+        case StepEngine::Bitwise:   step_bitwise(toroidal);     break;
+        case StepEngine::Tiled:     step_tiled(toroidal);       break;
+        case StepEngine::Temporal:  step_temporal(toroidal, 1); break;
+        default:                    step_reference(toroidal);   break;
+    }
+
+    m_generation++;
+    track_cycle();
+}
+
+
+/**
+ * World::step_reference(toroidal)
+ *
+ * Private helper taking one step on the Grid buffers, one cell at a time.
+ */
+void World::step_reference(bool toroidal)
+{
+    unpack();
+
+    if(m_next_buff.get_width() != m_curr_buff.get_width() || m_next_buff.get_height() != m_curr_buff.get_height())
+    {
+        m_next_buff = Grid(m_curr_buff.get_width(), m_curr_buff.get_height());
+    }
+
+    for_each_band(m_curr_buff.get_height(), [&](unsigned int y0, unsigned int y1)
+    {
+        for(unsigned int i = y0; i < y1; i++)
+        {   
+            for(unsigned int j = 0; j < m_curr_buff.get_width(); j++)
             {
-                m_next_buff.set(j, i, Cell::DEAD);
-            }
-            // - Any dead cell with exactly three live neighbours becomes a live cell, as if by reproduction.
-            else if((m_curr_buff.get(j, i) == Cell::DEAD) && (num_neighbours == 3))
+
+                unsigned int num_neighbours = this->count_neighbours(j, i, toroidal);
+
+                // - Live cells survive on the rule's survival counts, two or three for Conway's Game of Life,
+                //   and die of underpopulation or overpopulation otherwise.
+                // - Dead cells become live on the rule's birth counts, exactly three for Conway's Game of Life.
+                bool const alive = (m_curr_buff.get(j, i) == Cell::ALIVE);
+                m_next_buff.set(j, i, m_rule.next(alive, num_neighbours) ? Cell::ALIVE : Cell::DEAD);
+            }       
+        }
+    });
+
+    std::swap(m_curr_buff, m_next_buff);
+
+}
+
+
+/**
+ * World::step_halo(toroidal)
+ *
+ * Private helper taking one step on the Grid buffers one cell at a time, through m_halo.
+ * The halo is refreshed every step, then every cell is computed by the same branch free loop.
+ */
+void World::step_halo(bool toroidal)
+{
+    unpack();
+
+    unsigned int const width = m_curr_buff.get_width();
+    unsigned int const height = m_curr_buff.get_height();
+
+    if(m_next_buff.get_width() != width || m_next_buff.get_height() != height)
+    {
+        m_next_buff = Grid(width, height);
+    }
+
+    m_halo.resize(std::size_t(width + 2) * (height + 2));
+
+    //Bands read the halo rows either side of them, so every band must be loaded before any is stepped.
+    for_each_band(height, [&](unsigned int y0, unsigned int y1)
+    {
+        load_halo_rows(m_curr_buff, toroidal, &m_halo[0], y0, y1);
+    });
+
+    for_each_band(height, [&](unsigned int y0, unsigned int y1)
+    {
+        step_halo_rows(&m_halo[0], m_next_buff, y0, y1, m_rule);
+    });
+
+    std::swap(m_curr_buff, m_next_buff);
+}
+
+
+/**
+ * World::step_table(toroidal)
+ *
+ * Private helper taking one step on the Grid buffers 2x2 cells at a time, through m_blocks and m_block_table.
+ * The table is built on the first step and again only when the rule changes.
+ */
+void World::step_table(bool toroidal)
+{
+    unpack();
+
+    unsigned int const width = m_curr_buff.get_width();
+    unsigned int const height = m_curr_buff.get_height();
+
+    if(m_next_buff.get_width() != width || m_next_buff.get_height() != height)
+    {
+        m_next_buff = Grid(width, height);
+    }
+
+    if(m_block_table.empty() || m_block_rule != m_rule)
+    {
+        m_block_table.resize(STEP_BLOCK_TABLE_SIZE);
+        block_table(m_rule, &m_block_table[0]);
+        m_block_rule = m_rule;
+    }
+
+    m_blocks.resize(block_row_bytes(width) * (height + 3));
+
+    //Bands read the packed rows either side of them, so every band must be loaded before any is stepped.
+    for_each_band(height, [&](unsigned int y0, unsigned int y1)
+    {
+        load_block_rows(m_curr_buff, toroidal, &m_blocks[0], y0, y1);
+    });
+
+    for_each_band(height, [&](unsigned int y0, unsigned int y1)
+    {
+        step_block_rows(&m_blocks[0], &m_block_table[0], m_next_buff, y0, y1);
+    });
+
+    std::swap(m_curr_buff, m_next_buff);
+}
+
+
+/**
+ * World::step_columns(toroidal)
+ *
+ * Private helper taking one step on the Grid buffers from running column sums. Each band keeps its own sums.
+ */
+void World::step_columns(bool toroidal)
+{
+    unpack();
+
+    if(m_next_buff.get_width() != m_curr_buff.get_width() || m_next_buff.get_height() != m_curr_buff.get_height())
+    {
+        m_next_buff = Grid(m_curr_buff.get_width(), m_curr_buff.get_height());
+    }
+
+    for_each_band(m_curr_buff.get_height(), [&](unsigned int y0, unsigned int y1)
+    {
+        step_column_sums(m_curr_buff, m_next_buff, toroidal, y0, y1, m_rule);
+    });
+
+    std::swap(m_curr_buff, m_next_buff);
+}
+
+
+/**
+ * World::step_bytewise(toroidal)
+ *
+ * Private helper taking one step on the Grid buffers with the vectorized byte kernels.
+ */
+void World::step_bytewise(bool toroidal)
+{
+    unpack();
+
+    if(m_next_buff.get_width() != m_curr_buff.get_width() || m_next_buff.get_height() != m_curr_buff.get_height())
+    {
+        m_next_buff = Grid(m_curr_buff.get_width(), m_curr_buff.get_height());
+    }
+
+    for_each_band(m_curr_buff.get_height(), [&](unsigned int y0, unsigned int y1)
+    {
+        step_bytes(m_curr_buff, m_next_buff, toroidal, y0, y1, m_rule);
+    });
+
+    std::swap(m_curr_buff, m_next_buff);
+}
+
+
+/**
+ * World::step_bitwise(toroidal)
+ *
+ * Private helper taking one step on the packed BitGrid buffers, 64 cells per word.
+ */
+void World::step_bitwise(bool toroidal)
+{
+    pack();
+
+    if(m_next_bits.get_width() != m_curr_bits.get_width() || m_next_bits.get_height() != m_curr_bits.get_height())
+    {
+        m_next_bits = BitGrid(m_curr_bits.get_width(), m_curr_bits.get_height());
+    }
+
+    for_each_band(m_curr_bits.get_height(), [&](unsigned int y0, unsigned int y1)
+    {
+        step_bits(m_curr_bits, m_next_bits, toroidal, y0, y1, m_rule);
+    });
+
+    std::swap(m_curr_bits, m_next_bits);
+    m_tile_changed.clear();
+}
+
+
+/**
+ * World::step_tiled(toroidal)
+ *
+ * Private helper taking one step on the packed BitGrid buffers one 1024x64 cell tile at a time.
+ * Tiles are numbered row by row, so the runs of tiles the pool hands each thread are horizontal strips.
+ *
+ * Only tiles that changed in the last tiled step, and the tiles around them, are recomputed. The flags are
+ * dropped whenever the packed buffers are replaced or stepped another way, making the next step recompute every tile.
+ */
+void World::step_tiled(bool toroidal)
+{
+    pack();
+
+    if(m_next_bits.get_width() != m_curr_bits.get_width() || m_next_bits.get_height() != m_curr_bits.get_height())
+    {
+        m_next_bits = BitGrid(m_curr_bits.get_width(), m_curr_bits.get_height());
+    }
+
+    unsigned int const tiles_x = (m_curr_bits.get_words_per_row() + STEP_TILE_WORDS - 1) / STEP_TILE_WORDS;
+    unsigned int const tiles_y = (m_curr_bits.get_height() + STEP_TILE_ROWS - 1) / STEP_TILE_ROWS;
+    unsigned int const tiles = tiles_x * tiles_y;
+
+    std::vector<unsigned int> active;
+
+    if(m_tile_changed.size() != tiles || m_tiles_toroidal != toroidal)
+    {
+        //No flags for these buffers yet, so every tile is recomputed.
+        active.resize(tiles);
+        for(unsigned int tile = 0; tile < tiles; tile++)
+        {
+            active[tile] = tile;
+        }
+    }
+    else
+    {
+        //A tile can only change if it or one of its eight neighbours changed last generation.
+        std::vector<std::uint8_t> marked(tiles, 0);
+
+        for(unsigned int ty = 0; ty < tiles_y; ty++)
+        {
+            for(unsigned int tx = 0; tx < tiles_x; tx++)
             {
-                m_next_buff.set(j, i, Cell::ALIVE);
+                if(!m_tile_changed[ty * tiles_x + tx])
+                {
+                    continue;
+                }
+
+                for(int dy = -1; dy <= 1; dy++)
+                {
+                    for(int dx = -1; dx <= 1; dx++)
+                    {
+                        int nx = (int)tx + dx;
+                        int ny = (int)ty + dy;
+
+                        if(toroidal)
+                        {
+                            nx = (nx + (int)tiles_x) % (int)tiles_x;
+                            ny = (ny + (int)tiles_y) % (int)tiles_y;
+                        }
+                        else if(nx < 0 || ny < 0 || nx >= (int)tiles_x || ny >= (int)tiles_y)
+                        {
+                            continue;
+                        }
+
+                        marked[ny * tiles_x + nx] = 1;
+                    }
+                }
             }
-            else
+        }
+
+        for(unsigned int tile = 0; tile < tiles; tile++)
+        {
+            if(marked[tile])
             {
-                 m_next_buff.set(j, i, Cell::DEAD);
+                active.push_back(tile);
             }
-        }       
+        }
     }
 
-    std::swap(m_curr_buff, m_next_buff);
+    //Skipped tiles did not change last step, so m_next_bits still holds the same cells as m_curr_bits there.
+    std::vector<std::uint8_t> changed(tiles, 0);
+
+    auto const step_tile = [&](unsigned int i)
+    {
+        unsigned int const tile = active[i];
+        changed[tile] = step_bits_tile(m_curr_bits, m_next_bits, toroidal, tile % tiles_x, tile / tiles_x, m_rule);
+    };
+
+    if(m_pool)
+    {
+        m_pool->parallel_for((unsigned int)active.size(), step_tile);
+    }
+    else
+    {
+        for(unsigned int i = 0; i < active.size(); i++)
+        {
+            step_tile(i);
+        }
+    }
+
+    m_tile_changed.swap(changed);
+    m_tiles_toroidal = toroidal;
+    m_active_tiles = (unsigned int)active.size();
+
+    std::swap(m_curr_bits, m_next_bits);
+}
+
+
+/**
+ * World::step_temporal(toroidal, generations)
+ *
+ * Private helper advancing the packed BitGrid buffers by several generations in one pass, a band of rows at a time.
+ * Bands are as many rows as keep the scratch buffers of step_bits_generations within STEP_TEMPORAL_BAND_BYTES, but at
+ * least twice the generations, as each band also steps the generations rows either side of it.
+ */
+void World::step_temporal(bool toroidal, unsigned int generations)
+{
+    pack();
+
+    if(m_next_bits.get_width() != m_curr_bits.get_width() || m_next_bits.get_height() != m_curr_bits.get_height())
+    {
+        m_next_bits = BitGrid(m_curr_bits.get_width(), m_curr_bits.get_height());
+    }
+
+    unsigned int const height = m_curr_bits.get_height();
+    std::size_t const row_bytes = (m_curr_bits.get_words_per_row() + 2) * sizeof(std::uint64_t);
+    unsigned int const fit = (unsigned int)(STEP_TEMPORAL_BAND_BYTES / (2 * row_bytes));
+    unsigned int const band_rows = std::max(fit, 4 * generations) - 2 * generations;
+    unsigned int const bands = (height + band_rows - 1) / band_rows;
 
+    auto const step_band = [&](unsigned int band)
+    {
+        step_bits_generations(m_curr_bits, m_next_bits, toroidal, band * band_rows,
+                              std::min(height, (band + 1) * band_rows), generations, m_rule);
+    };
+
+    if(m_pool)
+    {
+        m_pool->parallel_for(bands, step_band);
+    }
+    else
+    {
+        for(unsigned int band = 0; band < bands; band++)
+        {
+            step_band(band);
+        }
+    }
+
+    std::swap(m_curr_bits, m_next_bits);
+    m_tile_changed.clear();
 }
 
 /**
@@ -492,6 +1467,11 @@ void World::step(bool toroidal)
  * Advance multiple steps in the Game of Life.
  * Should be implemented by invoking World::step(toroidal).
  *
+ * The temporal engine advances STEP_TEMPORAL_GENERATIONS generations per pass of the world instead of stepping,
+ * see World::step_temporal(toroidal, generations).
+ * Once cycle detection has found the world stable, fast forwarding skips whole periods of the steps,
+ * see World::set_fast_forward(fast_forward).
+ *
  * @param steps
  *      The number of steps to advance the world forward.
  *
@@ -501,8 +1481,39 @@ void World::step(bool toroidal)
  */
 void World::advance(unsigned int steps, bool toroidal)
 {
+    bool const degenerate = toroidal && (get_width() < 2 || get_height() < 2);
+
+    //Cycle detection needs every generation's hash, so then the temporal engine steps one generation at a time.
+    if(m_engine == StepEngine::Temporal && !degenerate && m_cycle_window == 0)
+    {
+        own_packed();
+        m_active_tiles = get_tiles();
+
+        for(unsigned int done = 0; done < steps; )
+        {
+            unsigned int const generations = std::min(steps - done, (unsigned int)STEP_TEMPORAL_GENERATIONS);
+            step_temporal(toroidal, generations);
+            m_generation += generations;
+            done += generations;
+        }
+        return;
+    }
+
     for(unsigned int i = 0; i < steps; i++)
     {
+        if(m_fast_forward && m_period != 0)
+        {
+            //The state repeats every period, so whole periods of the remaining steps change nothing.
+            unsigned int const skipped = (steps - i) - (steps - i) % m_period;
+            m_generation += skipped;
+            i += skipped;
+
+            if(i == steps)
+            {
+                break;
+            }
+        }
+
         step(toroidal);
     }    
 }
@@ -13,14 +13,51 @@
 // Add the minimal number of includes you need in order to declare the class.
 // #include ...
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "grid.h"
+#include "bitgrid.h"
+#include "rule.h"
+#include "thread_pool.h"
+
+/**
+ * The kernels World can use to step its state.
+ *      - Reference steps a Grid one cell at a time with World::count_neighbours.
+ *      - Halo steps a Grid one cell at a time from a copy with a one cell halo, with no branches per cell.
+ *      - Table steps a Grid 2x2 cells at a time, looking each 4x4 block of the current state up in a 65536 entry table.
+ *      - Columns steps a Grid from running sums of each column over three rows, three byte adds per cell.
+ *      - Bytewise steps a Grid with byte adds, vectorized with the widest SIMD the CPU has.
+ *      - Bitwise steps a packed BitGrid 64 cells per word with bitwise full adders, vectorized likewise.
+ *      - Tiled steps a packed BitGrid in 1024x64 cell tiles scheduled by work stealing, recomputing only
+ *        the tiles that changed last generation and their neighbours.
+ *      - Temporal steps a packed BitGrid like Bitwise, but World::advance takes each cache sized band of rows
+ *        several generations forward in one pass of the grid.
+ */
+enum class StepEngine {
+    Reference,
+    Halo,
+    Table,
+    Columns,
+    Bytewise,
+    Bitwise,
+    Tiled,
+    Temporal
+};
 
+StepEngine parse_step_engine(std::string const & name);
+std::string to_string(StepEngine engine);
 
 /**
  * Declare the structure of the World class for representing a 2d grid world.
  *
  * A World holds two equally sized Grid objects for the current state and next state.
  *      - These buffers should be swapped using std::swap after each update step.
+ *
+ * Packed engines keep the state in two BitGrid buffers instead, converting to a Grid only when asked for it.
  */
 class World {
     // How to draw an owl:
@@ -32,19 +69,93 @@ private:
     Grid m_curr_buff;
     Grid m_next_buff;
 
+    BitGrid m_curr_bits;
+    BitGrid m_next_bits;
+
+    StepEngine m_engine;
+    Rule m_rule;
+    bool m_packed;      //True when m_curr_bits holds the current state rather than m_curr_buff.
+
+    std::shared_ptr<ThreadPool> m_pool;     //Null when stepping on the calling thread only.
+
+    std::vector<std::uint8_t> m_tile_changed;   //Per tile, set if the last tiled step changed it. Empty when unknown.
+    bool m_tiles_toroidal;                      //The topology m_tile_changed was computed with.
+    unsigned int m_active_tiles;                //Tiles recomputed by the last step.
+
+    std::uint64_t m_generation;                 //Generations stepped since the world was made.
+
+    unsigned int m_cycle_window;                //Generations looked back over for a repeat, 0 when not detecting cycles.
+    bool m_fast_forward;                        //True to skip whole periods of advance once the world is stable.
+    std::vector<std::uint64_t> m_tile_hashes;   //Per tile hash of the current state. Empty until detection starts.
+    std::uint64_t m_hash;                       //The XOR of m_tile_hashes, the hash of the current state.
+    std::vector<std::uint64_t> m_recent_hashes; //Hashes of recent generations, generation g at g % m_cycle_window.
+    std::uint64_t m_hashed_since;               //The first generation with a hash in m_recent_hashes.
+    std::uint64_t m_stable_generation;          //The first generation of the cycle the world entered.
+    unsigned int m_period;                      //The cycle's period, 0 until a repeat is found.
+
+    std::vector<std::uint8_t> m_halo;           //0/1 copy of m_curr_buff with a one cell halo, used by the halo engine.
+
+    std::vector<std::uint8_t> m_blocks;         //Bit packed copy of m_curr_buff with a one cell halo, used by the table engine.
+    std::vector<std::uint8_t> m_block_table;    //The table engine's 2x2 results for every 4x4 block, for m_block_rule.
+    Rule m_block_rule;
+
     unsigned int count_neighbours(unsigned int x, unsigned int y, bool toroidal = false);
 
+    void unpack();
+    void pack();
+    void own_packed();
+
+    void hash_tiles(bool changed_only);
+    void track_cycle();
+    void forget_cycle();
+
+    void for_each_band(unsigned int height, std::function<void(unsigned int, unsigned int)> const & step_rows);
+
+    void step_reference(bool toroidal);
+    void step_halo(bool toroidal);
+    void step_table(bool toroidal);
+    void step_columns(bool toroidal);
+    void step_bytewise(bool toroidal);
+    void step_bitwise(bool toroidal);
+    void step_tiled(bool toroidal);
+    void step_temporal(bool toroidal, unsigned int generations);
+
 public:
 
     World();
     explicit World(unsigned int const & square_size);
     World(unsigned int const & width, unsigned int const & height);
     explicit World(Grid const & initial_state);
+    explicit World(BitGrid const & initial_state);
+    explicit World(BitGrid && initial_state);
     
     unsigned int const & get_width() const; 
     unsigned int const & get_height() const; 
     
     Grid & get_state();
+    BitGrid const & get_packed_state();
+
+    void set_engine(StepEngine engine);
+    StepEngine get_engine() const;
+
+    void set_rule(Rule const & rule);
+    Rule const & get_rule() const;
+
+    void set_threads(unsigned int threads);
+    unsigned int get_threads() const;
+
+    unsigned int get_tiles() const;
+    unsigned int get_active_tiles() const;
+
+    std::uint64_t get_generation() const;
+
+    void set_cycle_window(unsigned int window);
+    unsigned int get_cycle_window() const;
+    void set_fast_forward(bool fast_forward);
+
+    bool is_stable() const;
+    std::uint64_t get_stable_generation() const;
+    unsigned int get_period() const;
 
     unsigned int const get_total_cells() const;
     unsigned int const get_alive_cells() const;
@@ -9,30 +9,76 @@
  *              - followed by (height) number of lines, each containing (width) number of characters,
  *                terminated by a newline character.
  *              - (space) ' ' is Cell::DEAD, (hash) '#' is Cell::ALIVE.
+ *          - Ascii files are read a block of rows at a time and their cells copied straight into the grid's rows,
+ *            and written a block of rows at a time by Grid::write_ascii().
  *
- *      - Grids can be loaded from and saved to an binary file format.
+ *      - Grids can be loaded from and saved to an binary file format of any size.
  *          - Binary files are composed of:
+ *              - a BGOL_HEADER_BYTES header of the magic "BGOL", the format version, the grid width and height,
+ *                the rule's birth and survival mask, the 64 bit words per row and the generation, see BgolHeader.
+ *              - followed by each row as (width + 63) / 64 64 bit words, cell x of a row being
+ *                bit (x % 64) of word (x / 64), with the bits past the width 0. This is the layout of a BitGrid,
+ *                so the payload is written and read with single bulk copies, or mapped into memory and
+ *                stepped from directly, see Zoo::map_binary().
+ *              - the header fields and words are copied in the host's byte order, so the format, which is
+ *                little endian, only builds for little endian hosts.
+ *              - a 0 bit should be considered Cell::DEAD, a 1 bit should be considered Cell::ALIVE.
+ *          - Legacy binary files, from before the format was versioned, can still be read. They are composed of:
  *              - a 4 byte int representing the grid width
  *              - a 4 byte int representing the grid height
  *              - followed by (width * height) number of individual bits in C-style row/column format,
- *                padded with zero or more 0 bits.
- *              - a 0 bit should be considered Cell::DEAD, a 1 bit should be considered Cell::ALIVE.
+ *                padded with zero or more 0 bits, for at most 64 cells.
+ *
+ *      - Grids can be loaded from and saved to the RLE format most pattern collections are shared in.
+ *          - RLE files are composed of:
+ *              - zero or more comment lines starting with #.
+ *              - a header line "x = <width>, y = <height>, rule = <rulestring>", the rule being optional.
+ *              - the rows as runs of a count, left out when it is 1, and a tag, b for Cell::DEAD and o for Cell::ALIVE,
+ *                each row ended by $ and the pattern by !. Dead cells at the end of a row may be left out,
+ *                and the whitespace and line breaks between runs are ignored.
+ *          - RLE files are parsed as they are read, so files of any size are never held in memory whole.
+ *
+ *      - Worlds of Generations rules can be loaded from and saved to ascii and binary files, see generations.h.
+ *          - Ascii files have a header line of the width, height and B/S/C rulestring separated by spaces,
+ *            followed by the rows as for grids, with dying states written as their hex digit, 2 to f.
+ *          - Binary files have 4 byte ints for the width, height, number of states and the rule's birth and
+ *            survival mask, followed by each cell's state in bits per cell bits, least significant bit first,
+ *            in C-style row/column format, padded with zero or more 0 bits.
  *
  * @author 963653
  * @date April, 2020
  */
 #include "zoo.h"
+#include "generations.h"
+#include "cpu_features.h"
 #include <iostream>
 #include <fstream>
 #include <stdexcept>
 #include <bitset>
+#include <cctype>
+#include <cstring>
+#include <limits>
 #include <math.h>  
 #include <bits/stdc++.h> 
 
-#define BGOL_FILE_GRID_BYTE_CAPACITY 8
+#if SIMD_X86
+#include <immintrin.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #define BGOL_FILE_GRID_BIT_CAPACITY 64
 #define BYTE_SIZE 8
-#define BYTE_SIZE_DOUBLE 8.0
+
+/**
+ * The bytes of an ascii file read at once, enough rows to read large files at the speed of the disk.
+ */
+#define ASCII_BLOCK_BYTES (1 << 20)
 // Include the minimal number of headers needed to support your implementation.
 // #include ...
 
@@ -144,11 +190,73 @@ Grid Zoo::light_weight_spaceship()
  }
 
 
+/**
+ * Whether every character of a row of an ascii file is a cell, Cell::ALIVE or Cell::DEAD.
+ */
+static bool valid_cells_scalar(char const * cells, std::size_t count)
+{
+    bool invalid = false;
+
+    //No early exit, so the compiler can compare many characters at once
+    for(std::size_t i = 0; i < count; i++)
+    {
+        invalid |= (cells[i] != char(Cell::ALIVE)) & (cells[i] != char(Cell::DEAD));
+    }
+
+    return !invalid;
+}
+
+#if SIMD_X86
+
+/**
+ * valid_cells_scalar for 32 characters at a time.
+ */
+TARGET_AVX2
+static bool valid_cells_avx2(char const * cells, std::size_t count)
+{
+    __m256i const alive = _mm256_set1_epi8(char(Cell::ALIVE));
+    __m256i const dead = _mm256_set1_epi8(char(Cell::DEAD));
+    std::size_t i = 0;
+
+    for(; i + 32 <= count; i += 32)
+    {
+        __m256i const chars = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(cells + i));
+        __m256i const valid = _mm256_or_si256(_mm256_cmpeq_epi8(chars, alive), _mm256_cmpeq_epi8(chars, dead));
+
+        if(_mm256_movemask_epi8(valid) != -1)
+        {
+            return false;
+        }
+    }
+
+    return valid_cells_scalar(cells + i, count - i);
+}
+
+#endif
+
+/**
+ * Whether every character of a row of an ascii file is a cell, with the widest compares the CPU supports.
+ */
+static bool valid_cells(char const * cells, std::size_t count)
+{
+#if SIMD_X86
+    if(active_simd_level() != SimdLevel::Scalar)
+    {
+        return valid_cells_avx2(cells, count);
+    }
+#endif
+    return valid_cells_scalar(cells, count);
+}
+
+
 /**
  * Zoo::load_ascii(path)
  *
  * Load an ascii file and parse it as a grid of cells.
- * Should be implemented using std::ifstream.
+ * The rows are read a block at a time, each row's characters checked with the widest compares the CPU supports
+ * and then copied straight into the grid's row, as a Cell is the very character it is written as.
+ * The file's length is checked against its size before anything is allocated.
+ * Lines may end in \n or, as written on Windows, \r\n, every row ending the same way as the header.
  *
  * @example
  *
@@ -164,69 +272,93 @@ Grid Zoo::light_weight_spaceship()
  * @throws
  *      Throws std::runtime_error or sub-class if:
  *          - The file cannot be opened.
- *          - The parsed width or height is not a positive integer.
+ *          - The parsed width or height is negative or not an integer.
  *          - Newline characters are not found when expected during parsing.
  *          - The character for a cell is not the ALIVE or DEAD character.
+ *          - The file ends unexpectedly.
  */
 Grid Zoo::load_ascii(std::string path)
 {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
 
-    unsigned int width;
-    unsigned int height;
+    if(!file)
+    {
+        throw std::runtime_error("Unable to open file.");
+    }
 
-    char c;
+    //Read the size signed, so a negative one is rejected rather than wrapping round to a huge one
+    long long width = 0;
+    long long height = 0;
+    file >> width >> height;
 
-    std::ifstream file(path);
+    long long const largest = std::numeric_limits<unsigned int>::max();
+    if(file.fail() || width < 0 || height < 0 || width > largest || height > largest)
+    {
+        throw std::runtime_error("Invalid grid size.");
+    }
 
-    if(!file)
-    {   
-        file.close();
-        throw std::runtime_error("Unable to open file.");
+    //Lines written on Windows end in \r\n, which the text mode stream this once read through turned into \n.
+    //The header's line ending is taken as every row's, so the rows are still a fixed length.
+    int newline = file.get();
+    bool const crlf = (newline == '\r');
+
+    if(crlf)
+    {
+        newline = file.get();
     }
-    else
+
+    if(newline != '\n')
+    {
+        throw std::runtime_error("Expected new line character.");
+    }
+
+    //Check the rows are all there before allocating for them, so a corrupt size cannot ask for terabytes
+    std::uint64_t const line = std::uint64_t(width) + (crlf ? 2 : 1);
+    std::uint64_t const start = std::uint64_t(file.tellg());
+
+    file.seekg(0, std::ios::end);
+    std::uint64_t const length = std::uint64_t(file.tellg());
+    file.seekg(start);
+
+    if(length - start < line * std::uint64_t(height))
+    {
+        throw std::runtime_error("Unexpected end to file.");
+    }
+
+    Grid grid((unsigned int)width, (unsigned int)height);
+
+    std::uint64_t const rows_per_block = std::max<std::uint64_t>(1, ASCII_BLOCK_BYTES / line);
+    std::vector<char> block(std::size_t(std::min<std::uint64_t>(rows_per_block, height) * line));
+
+    for(std::uint64_t y0 = 0; y0 < std::uint64_t(height); y0 += rows_per_block)
     {
-        file >> width;
-        file >> height; 
-        file.get(c);
+        std::uint64_t const rows = std::min<std::uint64_t>(rows_per_block, height - y0);
+        file.read(block.data(), std::streamsize(rows * line));
 
-        Grid g(width, height);
+        if(file.fail())
+        {
+            throw std::runtime_error("Unexpected end to file.");
+        }
 
-        if(c == '\n')
+        for(std::uint64_t r = 0; r < rows; r++)
         {
-            for(unsigned int i = 0; i < height; i++)
+            char const * const text = block.data() + r * line;
+
+            if(!valid_cells(text, std::size_t(width)))
+            {
+                throw std::runtime_error("Invalid Character.");
+            }
+
+            if((crlf && text[width] != '\r') || text[line - 1] != '\n')
             {
-                for(unsigned int j = 0; j < width + 1; j++)
-                {
-                    file.get(c);
-
-                    if(c == char(Cell::ALIVE))
-                    {
-                        g.set(j, i, Cell::ALIVE);
-                    }
-                    else if(c == char(Cell::DEAD))
-                    {
-                         g.set(j, i, Cell::DEAD);
-                    }
-                    else if(c == '\n' && j == width)
-                    {
-                        //Do nothing, move to next char.
-                    }
-                    else
-                    {
-                        file.close();
-                        throw std::runtime_error("Invalid Character.");
-                    }
-                }
+                throw std::runtime_error("Expected new line character.");
             }
 
-            file.close();
-            return g;
+            std::memcpy(grid.row((unsigned int)(y0 + r)), text, std::size_t(width));
         }
-        else
-        {
-            throw std::runtime_error("Expected new line character.");
-        } 
     }
+
+    return grid;
 }
 
 
@@ -235,6 +367,7 @@ Grid Zoo::load_ascii(std::string path)
  *
  * Save a grid as an ascii .gol file according to the specified file format.
  * Should be implemented using std::ofstream.
+ * The rows are written a block at a time, see Grid::write_ascii().
  *
  * @example
  *
@@ -256,7 +389,7 @@ Grid Zoo::load_ascii(std::string path)
  *      The grid to be written out to file.
  *
  * @throws
- *      Throws std::runtime_error or sub-class if the file cannot be opened.
+ *      Throws std::runtime_error or sub-class if the file cannot be opened or written.
  */
 void Zoo::save_ascii(std::string path, Grid const & grid)
 {
@@ -273,35 +406,143 @@ void Zoo::save_ascii(std::string path, Grid const & grid)
     }
     else
     {
-
         outdata << width << " " << height << '\n';
 
-        for(unsigned int i = 0; i < height; i++)
+        grid.write_ascii(outdata, false);
+    }
+
+    outdata.close();
+
+    if(outdata.fail())
+    {
+        throw std::runtime_error("Error writing grid values to file.");
+    }
+}
+
+
+/**
+ * The header of a version 2 binary file. Every field is little endian, and the header is padded to
+ * BGOL_HEADER_BYTES so that the payload after it starts on a cache line.
+ *
+ * The header and the payload's words are copied to and from the file as they are held in memory, with no
+ * byte swapping, which is what lets Zoo::map_binary() step the file's words directly. That is only little
+ * endian on a little endian host, so building for any other is refused below.
+ */
+struct BgolHeader {
+    char magic[4];                  //BGOL_MAGIC, which no legacy file can start with as its width would be far over 64 cells.
+    std::uint32_t version;
+    std::uint32_t width;
+    std::uint32_t height;
+    std::uint32_t rule;             //The birth and survival mask, see Rule::get_mask().
+    std::uint32_t words_per_row;    //64 bit words per row of the payload, (width + 63) / 64.
+    std::uint64_t generation;
+    char reserved[BGOL_HEADER_BYTES - 32];
+};
+
+static_assert(sizeof(BgolHeader) == BGOL_HEADER_BYTES, "The .bgol header must be exactly BGOL_HEADER_BYTES");
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "The .bgol format is read and written in host order, so needs a little endian host");
+#endif
+
+
+/**
+ * Check the version and row size of a version 2 header and return the rule it holds.
+ */
+static Rule check_header(BgolHeader const & header)
+{
+    if(header.version != BGOL_VERSION)
+    {
+        throw std::runtime_error("Unsupported .bgol version " + std::to_string(header.version) + ".");
+    }
+
+    std::uint32_t const words_per_row = (std::uint32_t(header.width) + BITGRID_WORD_BITS - 1) / BITGRID_WORD_BITS;
+    if(header.words_per_row != words_per_row)
+    {
+        throw std::runtime_error("Invalid row size.");
+    }
+
+    try
+    {
+        return Rule(header.rule);
+    }
+    catch(std::invalid_argument const & ex)
+    {
+        throw std::runtime_error(ex.what());
+    }
+}
+
+
+/**
+ * Check that no row of a grid read from a file has a cell set past its width.
+ */
+static void check_padding(BitGrid const & grid)
+{
+    std::uint64_t const padding = ~grid.last_word_mask();
+    unsigned int const words_per_row = grid.get_words_per_row();
+
+    for(unsigned int y = 0; y < grid.get_height() && words_per_row > 0 && padding != 0; y++)
+    {
+        if(grid.row(y)[words_per_row - 1] & padding)
         {
-            for(unsigned int j = 0; j < width + 1; j++)
-            {
+            throw std::runtime_error("Unexpected cell past the end of a row.");
+        }
+    }
+}
 
-                if(j == width)
-                {
-                    outdata << '\n';
-                }
-                else
-                {
-                    outdata << char(grid.get(j,i));
-                }
-            }
+
+/**
+ * Read the cells of a legacy binary file, a 4 byte width and height then (width * height) bits packed least
+ * significant bit first, holding at most BGOL_FILE_GRID_BIT_CAPACITY cells.
+ */
+static BitGrid load_legacy_binary(std::ifstream & file)
+{
+    std::uint32_t size[2];
+    file.read(reinterpret_cast<char *>(size), sizeof(size));
+
+    if(file.fail())
+    {
+        throw std::runtime_error("Unexpected end to file.");
+    }
+
+    unsigned int const width = size[0];
+    unsigned int const height = size[1];
+    std::uint64_t const cells = std::uint64_t(width) * height;
+
+    //Evaluates whether the grid specified can be described in 8 bytes.
+    if(cells > BGOL_FILE_GRID_BIT_CAPACITY)
+    {
+        throw std::overflow_error("File/Grid is too large to be read or is invalid.");
+    }
+
+    std::vector<unsigned char> buff((cells + BYTE_SIZE - 1) / BYTE_SIZE);
+    file.read(reinterpret_cast<char *>(buff.data()), buff.size());
+
+    //If the file was unable to read that amount of bits then the file must be shorter than expected.
+    if(file.fail())
+    {
+        throw std::runtime_error("Unexpected end to file.");
+    }
+
+    BitGrid grid(width, height);
+
+    for(unsigned int k = 0; k < cells; k++)
+    {
+        if((buff[k / BYTE_SIZE] >> (k % BYTE_SIZE)) & 1u)
+        {
+            grid.set(k % width, k / width, Cell::ALIVE);
         }
     }
 
-    outdata.close();
+    return grid;
 }
 
 
 /**
  * Zoo::load_binary(path)
  *
- * Load a binary file and parse it as a grid of cells.
- * Should be implemented using std::ifstream.
+ * Load a binary file and parse it as a grid of cells, in either the versioned format or the legacy one.
+ * Any rule and generation the file holds are ignored, see Zoo::load_binary(path, rule, generation).
  *
  * @example
  *
@@ -318,178 +559,1046 @@ void Zoo::save_ascii(std::string path, Grid const & grid)
  *      Throws std::runtime_error or sub-class if:
  *          - The file cannot be opened.
  *          - The file ends unexpectedly.
+ *          - The header is invalid or of an unknown version.
  */
 Grid Zoo::load_binary(std::string path)
 {
-    unsigned int size;
-    unsigned int width, height;
-    char* buff;
-    std::string string_bitset;
-   
-    std::ifstream file(path, std::ios::in|std::ios::binary);
-   
-    if (file.is_open())
+    Rule rule;
+    std::uint64_t generation = 0;
+
+    return load_packed_binary(path, rule, generation).to_grid();
+}
+
+
+/**
+ * Zoo::load_binary(path, rule, generation)
+ *
+ * Load a binary file and parse it as a grid of cells, along with the rule and generation it was saved with.
+ * A legacy file has neither and reads as Conway's Game of Life at generation 0.
+ *
+ * @example
+ *
+ *      // Carry on where a saved world left off
+ *      Rule rule;
+ *      std::uint64_t generation = 0;
+ *      Grid grid = Zoo::load_binary("path/to/file.bgol", rule, generation);
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @param rule
+ *      Set to the rule in the file.
+ *
+ * @param generation
+ *      Set to the generation in the file.
+ *
+ * @return
+ *      Returns the parsed grid.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class, as Zoo::load_binary(path).
+ */
+Grid Zoo::load_binary(std::string path, Rule & rule, std::uint64_t & generation)
+{
+    return load_packed_binary(path, rule, generation).to_grid();
+}
+
+
+/**
+ * Zoo::load_packed_binary(path, rule, generation)
+ *
+ * Load a binary file as a packed grid, along with the rule and generation it was saved with.
+ * The payload of a versioned file is the BitGrid's own layout, so it is read with a single bulk read
+ * straight into the grid's words, and the file's length is checked against its header before anything is allocated.
+ *
+ * @example
+ *
+ *      // Step a saved world with the packed engines without unpacking it
+ *      BitGrid bits = Zoo::load_packed_binary("path/to/file.bgol", rule, generation);
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @param rule
+ *      Set to the rule in the file, Conway's Game of Life for a legacy file.
+ *
+ * @param generation
+ *      Set to the generation in the file, 0 for a legacy file.
+ *
+ * @return
+ *      Returns the parsed grid.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The file cannot be opened.
+ *          - The file ends unexpectedly.
+ *          - The header is invalid or of an unknown version, or bits past the width of a row are set.
+ */
+BitGrid Zoo::load_packed_binary(std::string path, Rule & rule, std::uint64_t & generation)
+{
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+
+    if(!file.is_open())
     {
+        throw std::runtime_error("File couldnt be opened.");
+    }
 
-        //Read Header of file, to get width and height.
-        file.read((char*)&width, sizeof(width));
-        file.read((char*)&height, sizeof(height));
-        
-        //Calculate the size 
-        size = std::ceil( (width*height) / BYTE_SIZE_DOUBLE);
+    char magic[4];
+    file.read(magic, sizeof(magic));
 
-        //Evaluates whether the grid specified can be described in 8 bytes.
-        if(size > BGOL_FILE_GRID_BYTE_CAPACITY)
-        {
-            throw std::overflow_error("File/Grid is too large to be read or is invalid.");
-        }
-        else
-        {
-            //Construct grid with parsed width and height.
-            Grid g(width, height);
+    if(file.fail())
+    {
+        throw std::runtime_error("Unexpected end to file.");
+    }
 
-            buff = new char[size];
-            
-            file.read(buff, size);
+    file.seekg(0);
 
-            //If the file was unable to read that amount of bits then the file must be shorter than expected.
-            if(file.fail())
-            {
-                delete buff;
-                throw std::runtime_error("Unexpected end to file.");
-            }
-            else
-            {
-                for(unsigned int i = 0; i < size; i++)
-                {       
-                    std::bitset<BYTE_SIZE> bitset = buff[i];
-
-                    std::string temp = bitset.to_string();
-
-                    //Flip the byte to correct bit endianness.
-                    std::reverse(temp.begin(), temp.end());
-                
-                    string_bitset += temp;
-                }
-                
-                for(unsigned int i = 0, k = 0; i < height; i++)
-                {
-                    for(unsigned int j = 0; j < width; j++, k++)
-                    {
-                        if(string_bitset[k] == '0')
-                        {
-                            g.set(j, i, Cell::DEAD);
-                        }
-                        else if(string_bitset[k] == '1')
-                        {
-                            g.set(j, i, Cell::ALIVE);
-                        }
-                        else
-                        {
-                            delete buff;
-                            throw std::runtime_error("Unexpected character.");
-                        }
-                    }   
-                }
-                
-                delete buff;
-                file.close();
-                return g;
-            } 
-        }    
+    if(std::memcmp(magic, BGOL_MAGIC, sizeof(magic)) != 0)
+    {
+        rule = Rule::conway();
+        generation = 0;
+        return load_legacy_binary(file);
     }
-    else
+
+    BgolHeader header;
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+
+    if(file.fail())
     {
-        throw std::runtime_error("File couldnt be opened.");
+        throw std::runtime_error("Unexpected end to file.");
+    }
+
+    rule = check_header(header);
+
+    //Check the payload is all there before allocating for it, so a corrupt size cannot ask for terabytes
+    std::uint64_t const bytes = std::uint64_t(header.height) * header.words_per_row * sizeof(std::uint64_t);
+
+    file.seekg(0, std::ios::end);
+    std::uint64_t const length = std::uint64_t(file.tellg());
+    file.seekg(sizeof(header));
+
+    if(length < sizeof(header) + bytes)
+    {
+        throw std::runtime_error("Unexpected end to file.");
     }
-    
+
+    BitGrid grid(header.width, header.height);
+
+    if(bytes > 0)
+    {
+        file.read(reinterpret_cast<char *>(grid.row(0)), bytes);
+
+        if(file.fail())
+        {
+            throw std::runtime_error("Unexpected end to file.");
+        }
+    }
+
+    check_padding(grid);
+
+    generation = header.generation;
+    return grid;
 }
 
+
 /**
- * Zoo::save_binary(path, grid)
+ * Zoo::map_binary(path, rule, generation)
  *
- * Save a grid as an binary .bgol file according to the specified file format.
- * Should be implemented using std::ofstream.
+ * Map a binary file into memory as a packed grid, along with the rule and generation it was saved with.
+ * The grid borrows the file's payload as its words, so opening the file reads only its header, and the cells
+ * are paged in from disk as they are first read. The mapping is private, so writing to the grid copies just the
+ * pages written and never changes the file, though a World moved from the grid only ever reads it, see
+ * World::World(BitGrid &&). The payload starts a header's length past the page aligned start
+ * of the mapping, so its rows are 64 byte aligned for the vectorized kernels.
  *
- * @example
+ * Unlike Zoo::load_packed_binary(), the bits past the width of each row are not checked, as that would read the
+ * last word of every row and so page in the whole file. The grid ignores them instead, and clears them when its
+ * words are copied, see BitGrid(width, height, words).
  *
- *      // Make an 8x8 grid
- *      Grid grid(8);
+ * A legacy file, or any file on a system without mmap, is read with Zoo::load_packed_binary() instead.
  *
- *      // Save a grid to an binary file in a directory
- *      try {
- *          Zoo::save_binary("path/to/file.bgol", grid);
- *      }
- *      catch (const std::exception &ex) {
- *          std::cerr << ex.what() << std::endl;
- *      }
+ * @example
+ *
+ *      // Open a world of billions of cells at once, the first step reading straight from the mapping
+ *      Rule rule;
+ *      std::uint64_t generation = 0;
+ *      World world(Zoo::map_binary("path/to/file.bgol", rule, generation));
+ *      world.set_rule(rule);
+ *      world.step();
  *
  * @param path
- *      The std::string path to the file to write to.
+ *      The std::string path to the file to map.
  *
- * @param grid
- *      The grid to be written out to file.
+ * @param rule
+ *      Set to the rule in the file, Conway's Game of Life for a legacy file.
+ *
+ * @param generation
+ *      Set to the generation in the file, 0 for a legacy file.
+ *
+ * @return
+ *      Returns a grid borrowing the mapped cells, see BitGrid::is_external().
  *
  * @throws
- *      Throws std::runtime_error or sub-class if the file cannot be opened.
+ *      Throws std::runtime_error or sub-class, as Zoo::load_packed_binary() but for cells past the end of a row,
+ *      or if the file cannot be mapped.
  */
-void Zoo::save_binary(std::string path, Grid const & grid)
+BitGrid Zoo::map_binary(std::string path, Rule & rule, std::uint64_t & generation)
 {
-    
-    unsigned int width = grid.get_width();
-    unsigned int height = grid.get_height();
+#if defined(__unix__) || defined(__APPLE__)
+    //Closes the file however the function is left, the mapping staying valid after it is closed
+    struct Descriptor {
+        int fd;
+        ~Descriptor() { if(fd >= 0) { close(fd); } }
+    } const file = { open(path.c_str(), O_RDONLY) };
 
-    std::ofstream outdata(path, std::ios::binary);
-    if(!outdata)
+    if(file.fd < 0)
     {
-        throw std::runtime_error("Unable to open file.");
+        throw std::runtime_error("File couldnt be opened.");
     }
-    else
-    {   
-        outdata.write(reinterpret_cast<const char *>(&width), sizeof(width));
-        outdata.write(reinterpret_cast<const char *>(&height), sizeof(height));
 
-        if(outdata.fail())
-        {
-            throw std::runtime_error("Error writing width and/or height to file.");
-        }else
-        {
-            std::bitset<BGOL_FILE_GRID_BIT_CAPACITY> bit;
+    struct stat info;
+    BgolHeader header;
 
-            for(unsigned int i = 0, k = 0; i < height; i++)
-            {
-                for(unsigned int j = 0; j < width; j++, k++)
-                {
-                    char c = char(grid.get(j,i));
-
-                    if(c == char(Cell::DEAD))
-                    {
-                        bit[k] = 0;
-                    }
-                    else if(c == char(Cell::ALIVE))
-                    {
-                        bit[k] = 1;
-                    }      
-                }
-            }
+    if(fstat(file.fd, &info) != 0 || std::uint64_t(info.st_size) < sizeof(header)
+       || pread(file.fd, &header, sizeof(header), 0) != ssize_t(sizeof(header))
+       || std::memcmp(header.magic, BGOL_MAGIC, sizeof(header.magic)) != 0)
+    {
+        return load_packed_binary(path, rule, generation);
+    }
 
-            outdata.write(reinterpret_cast<const char *>(&bit), sizeof(bit));
+    Rule const file_rule = check_header(header);
 
-            if(outdata.fail())
-            {
-                outdata.close();
-                throw std::runtime_error("Error writing grid values to file.");
-            }
-            else
-            {
-                outdata.close();
+    std::uint64_t const bytes = std::uint64_t(header.height) * header.words_per_row * sizeof(std::uint64_t);
+
+    if(std::uint64_t(info.st_size) < sizeof(header) + bytes)
+    {
+        throw std::runtime_error("Unexpected end to file.");
+    }
+
+    if(bytes == 0)
+    {
+        rule = file_rule;
+        generation = header.generation;
+        return BitGrid(header.width, header.height);
+    }
+
+    std::size_t const length = std::size_t(sizeof(header) + bytes);
+    void * const base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, file.fd, 0);
+
+    if(base == MAP_FAILED)
+    {
+        throw std::runtime_error("File couldnt be mapped.");
+    }
+
+    std::shared_ptr<char> const mapping(static_cast<char *>(base), [length](char * start) { munmap(start, length); });
+    std::shared_ptr<std::uint64_t> words(mapping, reinterpret_cast<std::uint64_t *>(mapping.get() + sizeof(header)));
+
+    BitGrid grid(header.width, header.height, std::move(words));
+
+    rule = file_rule;
+    generation = header.generation;
+    return grid;
+#else
+    return load_packed_binary(path, rule, generation);
+#endif
+}
+
+
+/**
+ * Zoo::save_binary(path, grid)
+ *
+ * Save a grid as an binary .bgol file in the versioned format, as Conway's Game of Life at generation 0.
+ *
+ * @example
+ *
+ *      // Make an 8x8 grid
+ *      Grid grid(8);
+ *
+ *      // Save a grid to an binary file in a directory
+ *      try {
+ *          Zoo::save_binary("path/to/file.bgol", grid);
+ *      }
+ *      catch (const std::exception &ex) {
+ *          std::cerr << ex.what() << std::endl;
+ *      }
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param grid
+ *      The grid to be written out to file.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be opened or written.
+ */
+void Zoo::save_binary(std::string path, Grid const & grid)
+{
+    save_binary(path, BitGrid(grid), Rule::conway(), 0);
+}
+
+
+/**
+ * Zoo::save_binary(path, grid, rule, generation)
+ *
+ * Save a grid as an binary .bgol file in the versioned format, with the rule it steps by and its generation.
+ *
+ * @example
+ *
+ *      Zoo::save_binary("path/to/file.bgol", world.get_state(), world.get_rule(), world.get_generation());
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param grid
+ *      The grid to be written out to file.
+ *
+ * @param rule
+ *      The rule to record in the file.
+ *
+ * @param generation
+ *      The generation to record in the file.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be opened or written.
+ */
+void Zoo::save_binary(std::string path, Grid const & grid, Rule const & rule, std::uint64_t generation)
+{
+    save_binary(path, BitGrid(grid), rule, generation);
+}
+
+
+/**
+ * Zoo::save_binary(path, grid, rule, generation)
+ *
+ * Save a packed grid as an binary .bgol file in the versioned format. The payload is the grid's own words,
+ * so the whole of it is written with a single bulk write.
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param grid
+ *      The packed grid to be written out to file.
+ *
+ * @param rule
+ *      The rule to record in the file.
+ *
+ * @param generation
+ *      The generation to record in the file.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be opened or written.
+ */
+void Zoo::save_binary(std::string path, BitGrid const & grid, Rule const & rule, std::uint64_t generation)
+{
+    std::ofstream outdata(path, std::ios::binary);
+
+    if(!outdata)
+    {
+        throw std::runtime_error("Unable to open file.");
+    }
+
+    BgolHeader header = {};
+    std::memcpy(header.magic, BGOL_MAGIC, sizeof(header.magic));
+    header.version = BGOL_VERSION;
+    header.width = grid.get_width();
+    header.height = grid.get_height();
+    header.rule = rule.get_mask();
+    header.words_per_row = grid.get_words_per_row();
+    header.generation = generation;
+
+    outdata.write(reinterpret_cast<char const *>(&header), sizeof(header));
+
+    std::size_t const bytes = std::size_t(grid.get_height()) * grid.get_words_per_row() * sizeof(std::uint64_t);
+    if(bytes > 0)
+    {
+        outdata.write(reinterpret_cast<char const *>(grid.row(0)), bytes);
+    }
+
+    if(outdata.fail())
+    {
+        throw std::runtime_error("Error writing grid values to file.");
+    }
+}
+
+
+/**
+ * Read a size from an RLE header, a whole number that fits in an unsigned int.
+ */
+static unsigned int parse_rle_size(std::string const & value)
+{
+    if(value.empty() || value.size() > 10 || value.find_first_not_of("0123456789") != std::string::npos)
+    {
+        throw std::runtime_error("Invalid grid size.");
+    }
+
+    unsigned long long const size = std::stoull(value);
+    if(size > std::numeric_limits<unsigned int>::max())
+    {
+        throw std::runtime_error("Invalid grid size.");
+    }
+
+    return (unsigned int)size;
+}
+
+
+/**
+ * Read an RLE header line, "x = <width>, y = <height>" optionally followed by ", rule = <rulestring>".
+ * The rule is everything after its =, up to any :<topology> suffix, which is ignored.
+ */
+static void parse_rle_header(std::string const & header, unsigned int & width, unsigned int & height, Rule & rule)
+{
+    auto const trim = [](std::string const & text)
+    {
+        std::size_t const first = text.find_first_not_of(" \t\r");
+        std::size_t const last = text.find_last_not_of(" \t\r");
+        return (first == std::string::npos) ? std::string() : text.substr(first, last - first + 1);
+    };
+
+    bool found_width = false;
+    bool found_height = false;
+    std::size_t start = 0;
+
+    while(start < header.size())
+    {
+        std::size_t const equals = header.find('=', start);
+        if(equals == std::string::npos)
+        {
+            throw std::runtime_error("Invalid RLE header.");
+        }
+
+        std::string const key = trim(header.substr(start, equals - start));
+        std::size_t const end = (key == "rule") ? std::string::npos : header.find(',', equals);
+        std::string const value = trim(header.substr(equals + 1, (end == std::string::npos) ? end : end - equals - 1));
+
+        if(key == "x")
+        {
+            width = parse_rle_size(value);
+            found_width = true;
+        }
+        else if(key == "y")
+        {
+            height = parse_rle_size(value);
+            found_height = true;
+        }
+        else if(key == "rule")
+        {
+            try
+            {
+                rule = Rule::parse(value.substr(0, value.find(':')));
+            }
+            catch(std::invalid_argument const & ex)
+            {
+                throw std::runtime_error(ex.what());
+            }
+        }
+
+        start = (end == std::string::npos) ? header.size() : end + 1;
+    }
+
+    if(!found_width || !found_height)
+    {
+        throw std::runtime_error("Invalid RLE header.");
+    }
+}
+
+
+/**
+ * Zoo::load_rle(path)
+ *
+ * Load an RLE file, the format most pattern collections are shared in, and parse it as a grid of cells.
+ * Any rule the file holds is ignored, see Zoo::load_rle(path, rule).
+ *
+ * @example
+ *
+ *      // Load a pattern from a collection
+ *      Grid gun = Zoo::load_rle("path/to/gosper_glider_gun.rle");
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @return
+ *      Returns the parsed grid.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class, as Zoo::load_rle(path, rule).
+ */
+Grid Zoo::load_rle(std::string path)
+{
+    Rule rule;
+
+    return load_rle(path, rule);
+}
+
+
+/**
+ * Zoo::load_rle(path, rule)
+ *
+ * Load an RLE file and parse it as a grid of cells, along with the rule in its header.
+ *
+ * The pattern is parsed a character at a time straight from the file's buffer, so a file of any size is read
+ * in one pass without ever being held in memory. Each run is checked against the width once and then filled
+ * into the grid's row whole, rather than setting and checking its cells one by one.
+ *
+ * @example
+ *
+ *      // Load a pattern along with the rule it runs under
+ *      Rule rule;
+ *      Grid pattern = Zoo::load_rle("path/to/file.rle", rule);
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @param rule
+ *      Set to the rule in the header, Conway's Game of Life if it has none.
+ *
+ * @return
+ *      Returns the parsed grid.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The file cannot be opened.
+ *          - The header has no width or height, they are not whole numbers, or the rule is invalid.
+ *          - The header asks for more than RLE_MAX_CELLS cells.
+ *          - A run goes past the width or height in the header.
+ *          - A character is not a count, a cell, $ (end of row), ! (end of pattern) or whitespace.
+ *          - The file ends before the !.
+ */
+Grid Zoo::load_rle(std::string path, Rule & rule)
+{
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+
+    if(!file)
+    {
+        throw std::runtime_error("Unable to open file.");
+    }
+
+    //Lines of # are comments, the first line after them is the header
+    std::string header;
+    while(std::getline(file, header))
+    {
+        bool const comment = !header.empty() && header[0] == '#';
+        bool const blank = header.find_first_not_of(" \t\r") == std::string::npos;
+
+        if(!comment && !blank)
+        {
+            break;
+        }
+    }
+
+    if(file.fail())
+    {
+        throw std::runtime_error("Expected RLE header.");
+    }
+
+    unsigned int width = 0;
+    unsigned int height = 0;
+    Rule file_rule = Rule::conway();
+    parse_rle_header(header, width, height, file_rule);
+
+    //Both sizes fit in 32 bits, so their product cannot overflow 64
+    if(std::uint64_t(width) * height > RLE_MAX_CELLS)
+    {
+        throw std::runtime_error("Invalid grid size.");
+    }
+
+    Grid grid(width, height);
+
+    std::streambuf * const input = file.rdbuf();
+    std::uint64_t count = 0;
+    std::uint64_t x = 0;
+    std::uint64_t y = 0;
+
+    for(int c = input->sbumpc(); ; c = input->sbumpc())
+    {
+        if(c == std::char_traits<char>::eof())
+        {
+            throw std::runtime_error("Unexpected end to file.");
+        }
+
+        if(c >= '0' && c <= '9')
+        {
+            count = count * 10 + std::uint64_t(c - '0');
+
+            if(count > std::numeric_limits<unsigned int>::max())
+            {
+                throw std::runtime_error("Invalid run length.");
             }
+            continue;
+        }
+
+        if(c == ' ' || c == '\n' || c == '\r' || c == '\t')
+        {
+            continue;
         }
+
+        std::uint64_t const run = (count == 0) ? 1 : count;
+        count = 0;
+
+        if(c == '!')
+        {
+            break;
+        }
+        else if(c == '$')
+        {
+            y += run;
+            x = 0;
+        }
+        else if(c == 'b' || c == '.')
+        {
+            x += run;
+        }
+        else if(std::isalpha(c))
+        {
+            //Every state but dead is alive, as in a two state rule
+            if(y >= height || x + run > width)
+            {
+                throw std::runtime_error("Pattern runs past its width or height.");
+            }
+
+            std::memset(grid.row((unsigned int)y) + x, Cell::ALIVE, std::size_t(run));
+            x += run;
+        }
+        else
+        {
+            throw std::runtime_error("Invalid Character.");
+        }
+
+        if(x > width)
+        {
+            throw std::runtime_error("Pattern runs past its width or height.");
+        }
+    }
+
+    rule = file_rule;
+    return grid;
+}
+
+
+/**
+ * Zoo::save_rle(path, grid)
+ *
+ * Save a grid as an RLE file, as Conway's Game of Life.
+ *
+ * @example
+ *
+ *      Zoo::save_rle("path/to/file.rle", Zoo::glider());
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param grid
+ *      The grid to be written out to file.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be opened or written.
+ */
+void Zoo::save_rle(std::string path, Grid const & grid)
+{
+    save_rle(path, grid, Rule::conway());
+}
+
+
+/**
+ * Zoo::save_rle(path, grid, rule)
+ *
+ * Save a grid as an RLE file with the rule it steps by in its header.
+ *
+ * Each row is written as runs of o (alive) and b (dead), leaving out the dead cells at its end, with rows
+ * ended by $ and runs of empty rows by a single count of $, and the pattern ended by !. Lines are wrapped
+ * at RLE_LINE_LENGTH characters, never inside a run, and written out a block at a time.
+ *
+ * @example
+ *
+ *      // Writes
+ *      //      x = 3, y = 3, rule = B3/S23
+ *      //      bo$2bo$3o!
+ *      Zoo::save_rle("path/to/file.rle", Zoo::glider(), Rule::conway());
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param grid
+ *      The grid to be written out to file.
+ *
+ * @param rule
+ *      The rule to record in the header.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be opened or written.
+ */
+void Zoo::save_rle(std::string path, Grid const & grid, Rule const & rule)
+{
+    std::ofstream outdata(path, std::ios::binary);
+
+    if(!outdata)
+    {
+        throw std::runtime_error("Unable to open file.");
+    }
+
+    outdata << "x = " << grid.get_width() << ", y = " << grid.get_height() << ", rule = " << rule.to_string() << '\n';
+
+    std::string buffer;
+    std::size_t line = 0;
+
+    //Append a run as its count, left out when it is 1, and its tag, wrapping the line first if it would not fit
+    auto const write_run = [&](std::uint64_t run, char tag)
+    {
+        char token[24];
+        char * end = token + sizeof(token);
+        char * begin = end;
+
+        *--begin = tag;
+        for(std::uint64_t n = run; run > 1 && n > 0; n /= 10)
+        {
+            *--begin = char('0' + n % 10);
+        }
+
+        std::size_t const length = std::size_t(end - begin);
+        if(line + length > RLE_LINE_LENGTH)
+        {
+            buffer += '\n';
+            line = 0;
+        }
+
+        buffer.append(begin, length);
+        line += length;
+
+        if(buffer.size() >= GRID_WRITE_BLOCK_BYTES)
+        {
+            outdata.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    };
+
+    unsigned int cursor = 0;   //The row the runs written so far end on.
+
+    for(unsigned int y = 0; y < grid.get_height(); y++)
+    {
+        Cell const * cells = grid.row(y);
+
+        unsigned int end = grid.get_width();
+        while(end > 0 && cells[end - 1] == Cell::DEAD)
+        {
+            end--;
+        }
+
+        if(end == 0)
+        {
+            continue;
+        }
+
+        if(y > cursor)
+        {
+            write_run(y - cursor, '$');
+            cursor = y;
+        }
+
+        for(unsigned int x = 0; x < end; )
+        {
+            Cell const value = cells[x];
+            unsigned int run = 1;
+
+            while(x + run < end && cells[x + run] == value)
+            {
+                run++;
+            }
+
+            write_run(run, (value == Cell::ALIVE) ? 'o' : 'b');
+            x += run;
+        }
+    }
+
+    write_run(1, '!');
+    buffer += '\n';
+    outdata.write(buffer.data(), buffer.size());
+
+    outdata.close();
+
+    if(outdata.fail())
+    {
+        throw std::runtime_error("Error writing grid values to file.");
+    }
+}
+
+
+/**
+ * Zoo::load_generations_ascii(path)
+ *
+ * Load an ascii file and parse it as a world of a Generations rule.
+ *
+ * @example
+ *
+ *      // Load a Brian's Brain world from a directory
+ *      GenerationsWorld world = Zoo::load_generations_ascii("path/to/file.gen");
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @return
+ *      Returns the parsed world.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The file cannot be opened.
+ *          - The header is not a width, height and Generations rulestring.
+ *          - Newline characters are not found when expected during parsing.
+ *          - The character for a cell is not a state of the rule.
+ */
+GenerationsWorld Zoo::load_generations_ascii(std::string path)
+{
+    unsigned int width;
+    unsigned int height;
+    std::string rulestring;
+
+    std::ifstream file(path);
+
+    if(!file)
+    {
+        throw std::runtime_error("Unable to open file.");
+    }
+
+    file >> width >> height >> rulestring;
+
+    if(!file)
+    {
+        throw std::runtime_error("Invalid header.");
+    }
+
+    GenerationsRule rule;
+    try
+    {
+        rule = GenerationsRule::parse(rulestring);
+    }
+    catch(std::invalid_argument const & ex)
+    {
+        throw std::runtime_error(ex.what());
+    }
+
+    GenerationsWorld world(width, height, rule);
+
+    char c;
+    file.get(c);
+
+    if(!file || c != '\n')
+    {
+        throw std::runtime_error("Expected new line character.");
+    }
+
+    std::string line;
+
+    for(unsigned int y = 0; y < height; y++)
+    {
+        if(!std::getline(file, line) || line.size() != width)
+        {
+            throw std::runtime_error("Expected new line character.");
+        }
+
+        for(unsigned int x = 0; x < width; x++)
+        {
+            int const state = generations_char_state(line[x]);
+
+            if(state < 0 || (unsigned int)state >= rule.get_states())
+            {
+                throw std::runtime_error("Invalid Character.");
+            }
+            else if(state != 0)
+            {
+                world.set(x, y, (unsigned int)state);
+            }
+        }
+    }
+
+    return world;
+}
+
+
+/**
+ * Zoo::save_generations_ascii(path, world)
+ *
+ * Save a world of a Generations rule as an ascii file, see Zoo::load_generations_ascii(path).
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param world
+ *      The world to be written out to file.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be opened.
+ */
+void Zoo::save_generations_ascii(std::string path, GenerationsWorld const & world)
+{
+    std::ofstream outdata(path);
+
+    if(!outdata)
+    {
+        throw std::runtime_error("Unable to open file.");
+    }
+
+    outdata << world.get_width() << " " << world.get_height() << " " << world.get_rule().to_string() << '\n';
+
+    std::string line(world.get_width(), ' ');
+
+    for(unsigned int y = 0; y < world.get_height(); y++)
+    {
+        for(unsigned int x = 0; x < world.get_width(); x++)
+        {
+            line[x] = generations_state_char(world.get(x, y));
+        }
+        outdata << line << '\n';
+    }
+
+    if(outdata.fail())
+    {
+        throw std::runtime_error("Error writing world to file.");
+    }
+}
+
+
+/**
+ * Zoo::load_generations_binary(path)
+ *
+ * Load a binary file and parse it as a world of a Generations rule.
+ *
+ * @example
+ *
+ *      // Load a Star Wars world from a directory
+ *      GenerationsWorld world = Zoo::load_generations_binary("path/to/file.bgen");
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @return
+ *      Returns the parsed world.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The file cannot be opened.
+ *          - The number of states or the rule is invalid.
+ *          - A cell's state is not a state of the rule.
+ *          - The file ends unexpectedly.
+ */
+GenerationsWorld Zoo::load_generations_binary(std::string path)
+{
+    std::uint32_t header[4];
+
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+
+    if(!file.is_open())
+    {
+        throw std::runtime_error("File couldnt be opened.");
+    }
+
+    file.read(reinterpret_cast<char *>(header), sizeof(header));
+
+    if(file.fail())
+    {
+        throw std::runtime_error("Unexpected end to file.");
+    }
+
+    unsigned int const width = header[0];
+    unsigned int const height = header[1];
+
+    GenerationsRule rule;
+    try
+    {
+        rule = GenerationsRule(Rule(header[3]), header[2]);
+    }
+    catch(std::invalid_argument const & ex)
+    {
+        throw std::runtime_error(ex.what());
+    }
+
+    GenerationsWorld world(width, height, rule);
+
+    unsigned int const bits = world.get_bits_per_cell();
+    std::size_t const size = (std::size_t(width) * height * bits + BYTE_SIZE - 1) / BYTE_SIZE;
+
+    std::vector<unsigned char> buff(size);
+    file.read(reinterpret_cast<char *>(buff.data()), size);
+
+    if(file.fail())
+    {
+        throw std::runtime_error("Unexpected end to file.");
+    }
+
+    for(unsigned int y = 0, k = 0; y < height; y++)
+    {
+        for(unsigned int x = 0; x < width; x++)
+        {
+            unsigned int state = 0;
+            for(unsigned int b = 0; b < bits; b++, k++)
+            {
+                state |= ((buff[k / BYTE_SIZE] >> (k % BYTE_SIZE)) & 1u) << b;
+            }
+
+            if(state >= rule.get_states())
+            {
+                throw std::runtime_error("Invalid state.");
+            }
+            else if(state != 0)
+            {
+                world.set(x, y, state);
+            }
+        }
+    }
+
+    return world;
+}
+
+
+/**
+ * Zoo::save_generations_binary(path, world)
+ *
+ * Save a world of a Generations rule as a binary file, see Zoo::load_generations_binary(path).
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param world
+ *      The world to be written out to file.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be opened.
+ */
+void Zoo::save_generations_binary(std::string path, GenerationsWorld const & world)
+{
+    unsigned int const width = world.get_width();
+    unsigned int const height = world.get_height();
+    unsigned int const bits = world.get_bits_per_cell();
+
+    std::ofstream outdata(path, std::ios::binary);
+
+    if(!outdata)
+    {
+        throw std::runtime_error("Unable to open file.");
+    }
+
+    std::uint32_t const header[4] = { width, height, world.get_rule().get_states(), world.get_rule().get_rule().get_mask() };
+    outdata.write(reinterpret_cast<char const *>(header), sizeof(header));
+
+    std::vector<unsigned char> buff((std::size_t(width) * height * bits + BYTE_SIZE - 1) / BYTE_SIZE, 0);
+
+    for(unsigned int y = 0, k = 0; y < height; y++)
+    {
+        for(unsigned int x = 0; x < width; x++)
+        {
+            unsigned int const state = world.get(x, y);
+            for(unsigned int b = 0; b < bits; b++, k++)
+            {
+                buff[k / BYTE_SIZE] |= (unsigned char)(((state >> b) & 1u) << (k % BYTE_SIZE));
+            }
+        }
+    }
+
+    outdata.write(reinterpret_cast<char const *>(buff.data()), buff.size());
+
+    if(outdata.fail())
+    {
+        throw std::runtime_error("Error writing world to file.");
     }
 }
 
-#undef BGOL_FILE_GRID_BYTE_CAPACITY
 #undef BGOL_FILE_GRID_BIT_CAPACITY
 #undef BYTE_SIZE 
-#undef BYTE_SIZE_DOUBLE
 
@@ -14,7 +14,40 @@
 // Add the minimal number of includes you need in order to declare the namespace.
 // #include ...
 
+#include <cstdint>
+#include <string>
+
 #include "grid.h"
+#include "bitgrid.h"
+#include "rule.h"
+
+/**
+ * The first four bytes of a versioned binary .bgol file.
+ */
+#define BGOL_MAGIC "BGOL"
+
+/**
+ * The version of the binary .bgol format written, the legacy format having no version.
+ */
+#define BGOL_VERSION 2
+
+/**
+ * The size of a versioned binary .bgol file's header, a cache line so that the cells after it start on one.
+ */
+#define BGOL_HEADER_BYTES 64
+
+/**
+ * The longest line of an RLE file written, as the format recommends.
+ */
+#define RLE_LINE_LENGTH 70
+
+/**
+ * The most cells an RLE file's header may ask for, a gigabyte of Grid. Runs compress a pattern to far less than
+ * its size, so unlike an ascii file's, an RLE file's length cannot bound the grid its header describes.
+ */
+#define RLE_MAX_CELLS (1ULL << 30)
+
+class GenerationsWorld;
 
 /**
  * Declare the interface of the Zoo namespace for constructing lifeforms and saving and loading them from file.
@@ -32,5 +65,21 @@ namespace Zoo {
     void save_ascii(std::string path, Grid const & grid);
 
     Grid load_binary(std::string path);
+    Grid load_binary(std::string path, Rule & rule, std::uint64_t & generation);
+    BitGrid load_packed_binary(std::string path, Rule & rule, std::uint64_t & generation);
+    BitGrid map_binary(std::string path, Rule & rule, std::uint64_t & generation);
     void save_binary(std::string path, Grid const & grid);
+    void save_binary(std::string path, Grid const & grid, Rule const & rule, std::uint64_t generation);
+    void save_binary(std::string path, BitGrid const & grid, Rule const & rule, std::uint64_t generation);
+
+    Grid load_rle(std::string path);
+    Grid load_rle(std::string path, Rule & rule);
+    void save_rle(std::string path, Grid const & grid);
+    void save_rle(std::string path, Grid const & grid, Rule const & rule);
+
+    GenerationsWorld load_generations_ascii(std::string path);
+    void save_generations_ascii(std::string path, GenerationsWorld const & world);
+
+    GenerationsWorld load_generations_binary(std::string path);
+    void save_generations_binary(std::string path, GenerationsWorld const & world);
 };
\ No newline at end of file